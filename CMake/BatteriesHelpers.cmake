@@ -250,6 +250,57 @@ function(batteries_cc_test)
   add_test(NAME ${_NAME} COMMAND ${_NAME})
 endfunction()
 
+# batteries_cc_benchmark()
+#
+# CMake function to build a benchmark binary. It takes the parameters of
+# batteries_cc_test but isn't added to the ctest list: benchmarks only
+# report throughput, run them from an optimized build and compare the
+# numbers before and after a change.
+#
+# Usage:
+# batteries_cc_benchmark(
+#   NAME
+#     awesome_benchmark
+#   SRCS
+#     "awesome_benchmark.cc"
+#   DEPS
+#     batteries::awesome
+# )
+function(batteries_cc_benchmark)
+  if(NOT BATT_RUN_TESTS)
+    return()
+  endif()
+
+  cmake_parse_arguments(BATT_CC_BENCHMARK
+    ""
+    "NAME"
+    "SRCS;COPTS;DEFINES;LINKOPTS;DEPS"
+    ${ARGN}
+  )
+
+  set(_NAME "batteries_${BATT_CC_BENCHMARK_NAME}")
+  add_executable(${_NAME} "")
+  target_sources(${_NAME} PRIVATE ${BATT_CC_BENCHMARK_SRCS})
+  target_include_directories(${_NAME}
+    PUBLIC ${BATT_COMMON_INCLUDE_DIRS}
+  )
+  target_compile_definitions(${_NAME}
+    PUBLIC ${BATT_CC_BENCHMARK_DEFINES}
+  )
+  target_compile_options(${_NAME}
+    PRIVATE ${BATT_CC_BENCHMARK_COPTS}
+  )
+  target_link_libraries(${_NAME}
+    PUBLIC ${BATT_CC_BENCHMARK_DEPS}
+    PRIVATE ${BATT_CC_BENCHMARK_LINKOPTS}
+  )
+  # Add all Batteries targets to a a folder in the IDE for organization.
+  set_property(TARGET ${_NAME} PROPERTY FOLDER ${BATT_IDE_FOLDER}/benchmark)
+
+  set_property(TARGET ${_NAME} PROPERTY CXX_STANDARD ${BATT_CXX_STANDARD})
+  set_property(TARGET ${_NAME} PROPERTY CXX_STANDARD_REQUIRED ON)
+endfunction()
+
 
 function(check_target my_target)
   if(NOT TARGET ${my_target})
@@ -57,6 +57,16 @@ else()
   set(BATT_TEST_COPTS "")
 endif()
 
+if(DEFINED BATT_USE_EXCEPTIONS AND NOT BATT_USE_EXCEPTIONS)
+  if(MSVC)
+    set(BATT_NO_EXCEPTIONS_FLAGS "/EHs-c-;/D_HAS_EXCEPTIONS=0")
+  else()
+    set(BATT_NO_EXCEPTIONS_FLAGS "-fno-exceptions")
+  endif()
+  list(APPEND BATT_DEFAULT_COPTS ${BATT_NO_EXCEPTIONS_FLAGS})
+  list(APPEND BATT_TEST_COPTS ${BATT_NO_EXCEPTIONS_FLAGS})
+endif()
+
 if("${CMAKE_CXX_STANDARD}" EQUAL 98)
   message(FATAL_ERROR "Batteries requires at least C++11")
 elseif(NOT "${CMAKE_CXX_STANDARD}")
@@ -14,9 +14,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <ostream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
 
+#include <absl/base/config.h>
 #include <absl/strings/str_cat.h>
 
 namespace batteries {
@@ -56,7 +66,7 @@ struct generic_error_category : std::error_category {
     }
 };
 
-static const generic_error_category theGenericErrorCategory{};
+inline const generic_error_category theGenericErrorCategory{};
 
 } // namespace detail
 
@@ -64,40 +74,143 @@ inline std::error_code make_error_code(generic_error_code e) {
     return {static_cast<int>(e), detail::theGenericErrorCategory};
 }
 
+/**
+ * A static_message wraps text that outlives every error that refers to it,
+ * such as a string literal, so that the error stores only a pointer.
+ */
+struct static_message {
+    const char* text;
+};
+
+namespace detail {
+
+// The text of a message too long to store inline, shared by the copies of an
+// error.
+struct shared_message {
+    std::atomic<uint32_t> references;
+    std::string text;
+};
+
+} // namespace detail
+
+/**
+ * An error is an error code plus a small payload that describes it: up to
+ * context_capacity bytes of context stored inline, a pointer to a static
+ * message, or for longer messages a shared copy. The payload may also hold a
+ * byte offset into the input that failed. The message is only formatted when
+ * message() is called, so errors built from a static message or from an
+ * offset and context never allocate.
+ */
 class error {
 
   public:
+    // The most bytes of context stored inline
+    static constexpr std::size_t context_capacity = 16;
+    // The offset of an error that has none
+    static constexpr std::size_t npos = UINT32_MAX;
+
     error()
-        : error_code_(generic_error_code::no_error)
-        , message_() {}
+        : error_code_(generic_error_code::no_error) {}
 
     explicit error(std::error_code error_code)
-        : error_code_(error_code)
-        , message_() {}
+        : error_code_(error_code) {}
 
     explicit error(const std::string& error_message)
-        : error_code_(generic_error_code::generic_error)
-        , message_(error_message) {}
+        : error(generic_error_code::generic_error,
+                std::string_view(error_message)) {}
 
     explicit error(std::string_view error_message)
-        : error_code_(generic_error_code::generic_error)
-        , message_(error_message) {}
+        : error(generic_error_code::generic_error, error_message) {}
 
     explicit error(const char* error_message)
-        : error_code_(generic_error_code::generic_error)
-        , message_(error_message) {}
+        : error(generic_error_code::generic_error,
+                std::string_view(error_message)) {}
 
     explicit error(std::error_code error_code, const std::string& error_message)
-        : error_code_(error_code)
-        , message_(error_message) {}
+        : error(error_code, std::string_view(error_message)) {}
 
     explicit error(std::error_code error_code, std::string_view error_message)
-        : error_code_(error_code)
-        , message_(error_message) {}
+        : error_code_(error_code) {
+        if (error_message.length() <= context_capacity) {
+            set_context(error_message, payload::context);
+        } else if (!error_message.empty()) {
+            payload_ = payload::shared;
+            shared_ = new detail::shared_message{{1},
+                                                 std::string(error_message)};
+        }
+    }
 
     explicit error(std::error_code error_code, const char* error_message)
+        : error(error_code, std::string_view(error_message)) {}
+
+    /**
+     * @brief Creates an error whose message is static text.
+     */
+    error(std::error_code error_code, static_message error_message)
+        : error_code_(error_code) {
+        payload_ = payload::static_text;
+        static_ = error_message.text;
+    }
+
+    /**
+     * @brief Creates an error at a byte offset of the input with the input
+     * around it as context. The context is truncated to context_capacity
+     * bytes.
+     */
+    error(std::error_code error_code, std::size_t offset,
+          std::string_view context)
         : error_code_(error_code)
-        , message_(error_message) {}
+        , offset_(static_cast<uint32_t>(std::min<std::size_t>(offset, npos))) {
+        if (context.length() <= context_capacity) {
+            set_context(context, payload::context);
+        } else {
+            set_context(context.substr(0, context_capacity),
+                        payload::truncated_context);
+        }
+    }
+
+    error(const error& rhs)
+        : error_code_(rhs.error_code_)
+        , offset_(rhs.offset_)
+        , payload_(rhs.payload_)
+        , length_(rhs.length_) {
+        std::memcpy(context_, rhs.context_, context_capacity);
+        if (payload_ == payload::shared) {
+            shared_->references.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    error(error&& rhs) noexcept
+        : error_code_(rhs.error_code_)
+        , offset_(rhs.offset_)
+        , payload_(rhs.payload_)
+        , length_(rhs.length_) {
+        std::memcpy(context_, rhs.context_, context_capacity);
+        rhs.payload_ = payload::none;
+    }
+
+    error& operator=(const error& rhs) {
+        if (this != &rhs) {
+            error copy(rhs);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    error& operator=(error&& rhs) noexcept {
+        if (this != &rhs) {
+            release();
+            error_code_ = rhs.error_code_;
+            offset_ = rhs.offset_;
+            payload_ = rhs.payload_;
+            length_ = rhs.length_;
+            std::memcpy(context_, rhs.context_, context_capacity);
+            rhs.payload_ = payload::none;
+        }
+        return *this;
+    }
+
+    ~error() { release(); }
 
     std::error_code error_code() const noexcept { return error_code_; }
 
@@ -107,14 +220,23 @@ class error {
         return error_code_.category();
     }
 
+    /**
+     * @brief offset returns the byte offset of the error in the input that
+     * failed, or npos if it has none.
+     */
+    std::size_t offset() const noexcept { return offset_; }
+
     std::string message() const {
-        if (message_.empty()) {
+        auto text = details();
+        if (text.empty()) {
             return error_code_.message();
-        } else if (error_code_.message().empty()) {
-            return message_;
-        } else {
-            return absl::StrCat(error_code_.message(), ": ", message_);
         }
+        auto ellipsis = payload_ == payload::truncated_context ? "..." : "";
+        auto code_message = error_code_.message();
+        if (code_message.empty()) {
+            return absl::StrCat(text, ellipsis);
+        }
+        return absl::StrCat(code_message, ": ", text, ellipsis);
     }
 
     std::string what() const { return message(); }
@@ -123,6 +245,19 @@ class error {
         return std::runtime_error(what());
     }
 
+    /**
+     * @brief raise throws as_exception(). Built without exceptions it writes
+     * the message to stderr and aborts instead.
+     */
+    [[noreturn]] void raise() const {
+#ifdef ABSL_HAVE_EXCEPTIONS
+        throw as_exception();
+#else
+        std::fprintf(stderr, "%s\n", what().c_str());
+        std::abort();
+#endif
+    }
+
     bool operator==(const error& rhs) const {
         return (error_code_.value() ==
                 rhs.error_code_.value()); // && message_ == rhs.message_);
@@ -143,9 +278,54 @@ class error {
                   << ", message: " << error.message();
     }
 
+  private:
+    enum class payload : uint8_t {
+        none,
+        context,
+        truncated_context,
+        static_text,
+        shared,
+    };
+
+    void set_context(std::string_view context, payload kind) {
+        payload_ = context.empty() ? payload::none : kind;
+        length_ = static_cast<uint8_t>(context.length());
+        std::copy(context.begin(), context.end(), context_);
+    }
+
+    // The message without the message of the error code
+    std::string_view details() const {
+        switch (payload_) {
+        case payload::context:
+        case payload::truncated_context:
+            return std::string_view(context_, length_);
+        case payload::static_text:
+            return static_;
+        case payload::shared:
+            return shared_->text;
+        default:
+            return std::string_view();
+        }
+    }
+
+    void release() {
+        if (payload_ == payload::shared &&
+            shared_->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete shared_;
+        }
+        payload_ = payload::none;
+    }
+
   private:
     std::error_code error_code_;
-    std::string message_;
+    union {
+        char context_[context_capacity] = {};
+        const char* static_;
+        detail::shared_message* shared_;
+    };
+    uint32_t offset_ = npos;
+    payload payload_ = payload::none;
+    uint8_t length_ = 0;
 };
 
 static const error no_error;
@@ -0,0 +1,259 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+#include "error.hpp"
+
+namespace batteries {
+
+namespace errors {
+
+// Whether errors are counted, set by defining BATT_ERROR_COUNTERS
+#ifdef BATT_ERROR_COUNTERS
+constexpr bool error_counters_enabled = true;
+#else
+constexpr bool error_counters_enabled = false;
+#endif
+
+/**
+ * An error_count is how many errors of one category and code were counted
+ * by every thread, exited threads included.
+ */
+struct error_count {
+    // The category, or nullptr for categories past the first
+    // counted_categories ones seen
+    const std::error_category* category;
+    // The error value, or other_code for values past the counted ones
+    int code;
+    uint64_t count;
+
+    // The code of errors whose value isn't counted separately
+    static constexpr int other_code = -1;
+};
+
+#ifdef BATT_ERROR_COUNTERS
+
+namespace detail {
+
+// Categories are numbered in the order they are first counted
+constexpr std::size_t counted_categories = 8;
+// Error values 0 to counted_codes - 2 are counted separately, the last
+// counter is for every other value
+constexpr std::size_t counted_codes = 64;
+constexpr std::size_t cache_line_size = 64;
+
+// The counter of the error value, the last one if it isn't counted separately
+inline std::size_t code_column(int value) {
+    constexpr int other = static_cast<int>(counted_codes) - 1;
+    return static_cast<std::size_t>(value >= 0 && value < other ? value
+                                                                : other);
+}
+
+// The counters of a single thread. Only that thread writes them, so an
+// increment is a relaxed load and store rather than a locked instruction,
+// and the alignment keeps the counters of two threads off the same cache
+// line. The last row is for categories that didn't get a number.
+struct alignas(cache_line_size) counter_block {
+    std::atomic<uint64_t> counts[counted_categories + 1][counted_codes] = {};
+};
+
+// The counters of every thread. The lock is only taken when a thread counts
+// its first error, when it exits and when the counters are read.
+class counter_registry {
+
+  public:
+    static counter_registry& instance() {
+        static counter_registry registry;
+        return registry;
+    }
+
+    // The row of category. Numbering a category is lock-free, afterwards
+    // finding it only reads the shared table.
+    std::size_t category_index(const std::error_category& category) {
+        for (std::size_t i = 0; i < counted_categories; i++) {
+            auto current = categories_[i].load(std::memory_order_acquire);
+            if (current == nullptr) {
+                categories_[i].compare_exchange_strong(
+                    current, &category, std::memory_order_acq_rel);
+                if (current == nullptr) {
+                    return i;
+                }
+            }
+            if (current == &category) {
+                return i;
+            }
+        }
+        return counted_categories;
+    }
+
+    void attach(counter_block* block) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        blocks_.push_back(block);
+    }
+
+    // Keeps the counts of an exiting thread
+    void detach(counter_block* block) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::size_t row = 0; row <= counted_categories; row++) {
+            for (std::size_t col = 0; col < counted_codes; col++) {
+                auto& retired = retired_.counts[row][col];
+                retired.store(retired.load(std::memory_order_relaxed) +
+                                  block->counts[row][col].load(
+                                      std::memory_order_relaxed),
+                              std::memory_order_relaxed);
+            }
+        }
+        blocks_.erase(std::find(blocks_.begin(), blocks_.end(), block));
+    }
+
+    std::vector<error_count> snapshot() {
+        std::vector<error_count> counts;
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::size_t row = 0; row <= counted_categories; row++) {
+            const std::error_category* category =
+                row < counted_categories
+                    ? categories_[row].load(std::memory_order_acquire)
+                    : nullptr;
+            for (std::size_t col = 0; col < counted_codes; col++) {
+                uint64_t count =
+                    retired_.counts[row][col].load(std::memory_order_relaxed);
+                for (auto block : blocks_) {
+                    count +=
+                        block->counts[row][col].load(std::memory_order_relaxed);
+                }
+                if (count != 0) {
+                    int code = col + 1 < counted_codes
+                                   ? static_cast<int>(col)
+                                   : error_count::other_code;
+                    counts.push_back(error_count{category, code, count});
+                }
+            }
+        }
+        return counts;
+    }
+
+  private:
+    std::array<std::atomic<const std::error_category*>, counted_categories>
+        categories_{};
+    std::mutex mutex_;
+    std::vector<counter_block*> blocks_;
+    counter_block retired_;
+};
+
+// Registers the counters of the current thread for as long as it runs
+class thread_counters {
+
+  public:
+    thread_counters()
+        : block_(new counter_block) {
+        counter_registry::instance().attach(block_);
+    }
+
+    thread_counters(const thread_counters&) = delete;
+    thread_counters& operator=(const thread_counters&) = delete;
+
+    ~thread_counters() {
+        counter_registry::instance().detach(block_);
+        delete block_;
+    }
+
+    void increment(std::size_t row, std::size_t col) {
+        auto& counter = block_->counts[row][col];
+        counter.store(counter.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    }
+
+  private:
+    counter_block* block_;
+};
+
+inline thread_counters& local_counters() {
+    thread_local thread_counters counters;
+    return counters;
+}
+
+} // namespace detail
+
+#endif
+
+/**
+ * @brief count_error counts err by its category and code in counters of the
+ * calling thread. Errors that aren't set aren't counted and touch no
+ * counter. Without BATT_ERROR_COUNTERS it does nothing.
+ */
+inline void count_error(const error& err) {
+#ifdef BATT_ERROR_COUNTERS
+    if (!err) {
+        return;
+    }
+    auto code = err.error_code();
+    auto row =
+        detail::counter_registry::instance().category_index(code.category());
+    detail::local_counters().increment(row, detail::code_column(code.value()));
+#else
+    static_cast<void>(err);
+#endif
+}
+
+/**
+ * @brief snapshot_error_counts adds up the counters of every thread. It
+ * doesn't stop threads from counting, so counts of other threads may be a
+ * little behind.
+ * @returns The counts that aren't zero, by category and then by code. Empty
+ * without BATT_ERROR_COUNTERS.
+ */
+inline std::vector<error_count> snapshot_error_counts() {
+#ifdef BATT_ERROR_COUNTERS
+    return detail::counter_registry::instance().snapshot();
+#else
+    return {};
+#endif
+}
+
+/**
+ * @brief total_error_count returns how many errors with code were counted
+ * by every thread. Values that aren't counted separately share a counter,
+ * so for those it is the count of error_count::other_code of the category.
+ * Categories past the first counted ones aren't told apart and return 0.
+ */
+inline uint64_t total_error_count(std::error_code code) {
+#ifdef BATT_ERROR_COUNTERS
+    auto value = detail::code_column(code.value()) + 1 < detail::counted_codes
+                     ? code.value()
+                     : error_count::other_code;
+    uint64_t total = 0;
+    for (const auto& count : snapshot_error_counts()) {
+        if (count.category == &code.category() && count.code == value) {
+            total += count.count;
+        }
+    }
+    return total;
+#else
+    static_cast<void>(code);
+    return 0;
+#endif
+}
+
+} // namespace errors
+
+} // namespace batteries
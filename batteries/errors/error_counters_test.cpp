@@ -0,0 +1,86 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "error_counters.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using batteries::errors::count_error;
+using batteries::errors::error;
+using batteries::errors::error_count;
+using batteries::errors::error_counters_enabled;
+using batteries::errors::generic_error_code;
+using batteries::errors::snapshot_error_counts;
+using batteries::errors::total_error_count;
+
+TEST(ErrorCounters, CountsAcrossThreads) {
+    auto code = batteries::errors::make_error_code(
+        generic_error_code::generic_error);
+    auto before = total_error_count(code);
+
+    count_error(error(code, "counted"));
+    count_error(batteries::errors::no_error);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([code] {
+            for (int j = 0; j < 1000; j++) {
+                count_error(error(code));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (error_counters_enabled) {
+        EXPECT_EQ(total_error_count(code), before + 4001);
+        EXPECT_EQ(total_error_count(batteries::errors::make_error_code(
+                      generic_error_code::no_error)),
+                  0u);
+    } else {
+        EXPECT_EQ(total_error_count(code), 0u);
+        EXPECT_TRUE(snapshot_error_counts().empty());
+    }
+}
+
+TEST(ErrorCounters, OtherCodes) {
+    const auto& category = batteries::errors::make_error_code(
+                               generic_error_code::generic_error)
+                               .category();
+    auto other = [&category] {
+        for (const auto& count : snapshot_error_counts()) {
+            if (count.category == &category &&
+                count.code == error_count::other_code) {
+                return count.count;
+            }
+        }
+        return uint64_t(0);
+    };
+    auto before = other();
+
+    count_error(error(std::error_code(1000, category)));
+    count_error(error(std::error_code(-5, category)));
+
+    EXPECT_EQ(other(), error_counters_enabled ? before + 2 : 0u);
+    EXPECT_EQ(total_error_count(std::error_code(1000, category)), other());
+    EXPECT_EQ(total_error_count(std::error_code(-5, category)), other());
+}
+
+} // namespace
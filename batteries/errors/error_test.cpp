@@ -57,4 +57,50 @@ TEST(Errors, CustomError) {
     EXPECT_FALSE(!errorWithMessage);
 }
 
+TEST(Errors, Size) {
+    EXPECT_LE(sizeof(batteries::errors::error), 40u);
+}
+
+TEST(Errors, StaticMessage) {
+    batteries::errors::error error(
+        batteries::errors::generic_error_code::generic_error,
+        batteries::errors::static_message{"a message longer than the context"});
+
+    EXPECT_TRUE(error);
+    EXPECT_EQ(error.offset(), batteries::errors::error::npos);
+    EXPECT_EQ(error.message(),
+              "Generic error type: a message longer than the context");
+}
+
+TEST(Errors, OffsetAndContext) {
+    batteries::errors::error error(
+        batteries::errors::generic_error_code::generic_error, 3, "%zz");
+    EXPECT_EQ(error.offset(), 3u);
+    EXPECT_EQ(error.message(), "Generic error type: %zz");
+
+    batteries::errors::error truncated(
+        batteries::errors::generic_error_code::generic_error, 0,
+        "0123456789abcdefghij");
+    EXPECT_EQ(truncated.offset(), 0u);
+    EXPECT_EQ(truncated.message(), "Generic error type: 0123456789abcdef...");
+}
+
+TEST(Errors, LongMessage) {
+    std::string errorMessage(100, 'x');
+    batteries::errors::error error(errorMessage);
+    EXPECT_EQ(error.message(), "Generic error type: " + errorMessage);
+
+    batteries::errors::error copy(error);
+    batteries::errors::error assigned;
+    assigned = copy;
+    batteries::errors::error moved(std::move(error));
+    EXPECT_EQ(copy.message(), "Generic error type: " + errorMessage);
+    EXPECT_EQ(assigned.message(), "Generic error type: " + errorMessage);
+    EXPECT_EQ(moved.message(), "Generic error type: " + errorMessage);
+
+    assigned = batteries::errors::error("short");
+    EXPECT_EQ(assigned.message(), "Generic error type: short");
+    EXPECT_EQ(copy.message(), "Generic error type: " + errorMessage);
+}
+
 } // namespace
\ No newline at end of file
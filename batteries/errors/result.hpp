@@ -0,0 +1,242 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "error.hpp"
+
+namespace batteries {
+
+template <typename T> class result;
+
+namespace detail {
+
+template <typename T> struct is_result : std::false_type {};
+template <typename T> struct is_result<result<T>> : std::true_type {};
+
+} // namespace detail
+
+/**
+ * A result holds either a value or the error that prevented computing it,
+ * like std::expected. It is returned in place of std::tuple<T, error> so the
+ * value is constructed once, moved out rather than copied, and can't be read
+ * without looking at whether there is one. T may be move-only. Operations
+ * that produce no value return an errors::error.
+ */
+template <typename T> class result {
+
+    static_assert(!std::is_reference_v<T>, "result of a reference");
+    static_assert(!std::is_same_v<std::decay_t<T>, errors::error>,
+                  "result of an error");
+
+  public:
+    using value_type = T;
+
+    /**
+     * @brief Creates a result holding a default constructed value.
+     */
+    template <typename U = T,
+              typename = std::enable_if_t<std::is_default_constructible_v<U>>>
+    result()
+        : storage_(std::in_place_index<0>) {}
+
+    /**
+     * @brief Creates a result holding a value.
+     */
+    template <typename U = T,
+              typename = std::enable_if_t<
+                  std::is_constructible_v<T, U&&> &&
+                  !std::is_same_v<std::decay_t<U>, result> &&
+                  !std::is_same_v<std::decay_t<U>, errors::error> &&
+                  !std::is_same_v<std::decay_t<U>, std::in_place_t>>>
+    result(U&& value)
+        : storage_(std::in_place_index<0>, std::forward<U>(value)) {}
+
+    /**
+     * @brief Creates a result holding a value constructed from args.
+     */
+    template <typename... Args>
+    explicit result(std::in_place_t, Args&&... args)
+        : storage_(std::in_place_index<0>, std::forward<Args>(args)...) {}
+
+    /**
+     * @brief Creates a result holding an error, which must be set.
+     */
+    result(const errors::error& err)
+        : storage_(std::in_place_index<1>, err) {}
+
+    result(errors::error&& err)
+        : storage_(std::in_place_index<1>, std::move(err)) {}
+
+    /**
+     * @brief has_value returns whether the result holds a value.
+     */
+    bool has_value() const noexcept { return storage_.index() == 0; }
+
+    explicit operator bool() const noexcept { return has_value(); }
+
+    /**
+     * @brief value returns the value.
+     * @throws The error as a std::runtime_error if there is no value, see
+     * errors::error::raise.
+     */
+    T& value() & {
+        check();
+        return *std::get_if<0>(&storage_);
+    }
+
+    const T& value() const& {
+        check();
+        return *std::get_if<0>(&storage_);
+    }
+
+    T&& value() && {
+        check();
+        return std::move(*std::get_if<0>(&storage_));
+    }
+
+    /**
+     * @brief Accesses the value, which must be present.
+     */
+    T& operator*() & { return *std::get_if<0>(&storage_); }
+    const T& operator*() const& { return *std::get_if<0>(&storage_); }
+    T&& operator*() && { return std::move(*std::get_if<0>(&storage_)); }
+
+    T* operator->() { return std::get_if<0>(&storage_); }
+    const T* operator->() const { return std::get_if<0>(&storage_); }
+
+    /**
+     * @brief error returns the error, or errors::no_error if there is a
+     * value.
+     */
+    const errors::error& error() const& noexcept {
+        auto err = std::get_if<1>(&storage_);
+        return err == nullptr ? errors::no_error : *err;
+    }
+
+    /**
+     * @brief value_or returns the value, or fallback if there is none.
+     */
+    template <typename U> T value_or(U&& fallback) const& {
+        return has_value() ? **this : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    template <typename U> T value_or(U&& fallback) && {
+        return has_value() ? std::move(**this)
+                           : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    /**
+     * @brief and_then calls f with the value, f returning a result, or
+     * passes the error on.
+     */
+    template <typename F> auto and_then(F&& f) & {
+        return and_then_impl(*this, std::forward<F>(f));
+    }
+
+    template <typename F> auto and_then(F&& f) const& {
+        return and_then_impl(*this, std::forward<F>(f));
+    }
+
+    template <typename F> auto and_then(F&& f) && {
+        return and_then_impl(std::move(*this), std::forward<F>(f));
+    }
+
+    /**
+     * @brief transform calls f with the value and returns a result holding
+     * what f returns, or passes the error on.
+     */
+    template <typename F> auto transform(F&& f) & {
+        return transform_impl(*this, std::forward<F>(f));
+    }
+
+    template <typename F> auto transform(F&& f) const& {
+        return transform_impl(*this, std::forward<F>(f));
+    }
+
+    template <typename F> auto transform(F&& f) && {
+        return transform_impl(std::move(*this), std::forward<F>(f));
+    }
+
+    /**
+     * @brief or_else calls f with the error, f returning a result<T>, or
+     * passes the value on.
+     */
+    template <typename F> result or_else(F&& f) const& {
+        if (has_value()) {
+            return *this;
+        }
+        return std::invoke(std::forward<F>(f), error());
+    }
+
+    template <typename F> result or_else(F&& f) && {
+        if (has_value()) {
+            return std::move(*this);
+        }
+        return std::invoke(std::forward<F>(f), error());
+    }
+
+    /**
+     * @brief to_tuple moves the result into the std::tuple<T, error> form of
+     * APIs that predate result. The value is default constructed on error.
+     */
+    std::tuple<T, errors::error> to_tuple() && {
+        if (has_value()) {
+            return std::tuple<T, errors::error>(std::move(**this),
+                                                errors::no_error);
+        }
+        return std::tuple<T, errors::error>(T(), error());
+    }
+
+  private:
+    void check() const {
+        if (!has_value()) {
+            error().raise();
+        }
+    }
+
+    template <typename Self, typename F>
+    static auto and_then_impl(Self&& self, F&& f) {
+        using R = std::remove_cv_t<std::remove_reference_t<
+            std::invoke_result_t<F, decltype(*std::forward<Self>(self))>>>;
+        static_assert(detail::is_result<R>::value,
+                      "and_then must return a result");
+        if (!self.has_value()) {
+            return R(self.error());
+        }
+        return std::invoke(std::forward<F>(f), *std::forward<Self>(self));
+    }
+
+    template <typename Self, typename F>
+    static auto transform_impl(Self&& self, F&& f) {
+        using U = std::remove_cv_t<std::remove_reference_t<
+            std::invoke_result_t<F, decltype(*std::forward<Self>(self))>>>;
+        if (!self.has_value()) {
+            return result<U>(self.error());
+        }
+        return result<U>(std::in_place, std::invoke(std::forward<F>(f),
+                                                    *std::forward<Self>(self)));
+    }
+
+  private:
+    std::variant<T, errors::error> storage_;
+};
+
+} // namespace batteries
@@ -0,0 +1,111 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "result.hpp"
+
+#include <memory>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using batteries::result;
+using batteries::errors::error;
+using batteries::errors::generic_error_code;
+
+result<int> parse_digit(char c) {
+    if (c < '0' || c > '9') {
+        return error(generic_error_code::generic_error, 0,
+                     std::string_view(&c, 1));
+    }
+    return c - '0';
+}
+
+TEST(Result, ValueAndError) {
+    auto digit = parse_digit('7');
+    EXPECT_TRUE(digit);
+    EXPECT_TRUE(digit.has_value());
+    EXPECT_EQ(*digit, 7);
+    EXPECT_EQ(digit.value(), 7);
+    EXPECT_FALSE(digit.error());
+
+    auto letter = parse_digit('x');
+    EXPECT_FALSE(letter);
+    EXPECT_EQ(letter.error().message(), "Generic error type: x");
+    EXPECT_EQ(letter.value_or(-1), -1);
+#ifdef ABSL_HAVE_EXCEPTIONS
+    EXPECT_THROW(letter.value(), std::runtime_error);
+#else
+    EXPECT_DEATH(letter.value(), "Generic error type: x");
+#endif
+
+    result<std::string> empty;
+    EXPECT_TRUE(empty);
+    EXPECT_EQ(*empty, "");
+}
+
+TEST(Result, Monadic) {
+    auto twice = [](int i) { return i * 2; };
+    auto odd = [](int i) -> result<int> {
+        if (i % 2 == 0) {
+            return error(generic_error_code::generic_error, "even");
+        }
+        return i;
+    };
+
+    EXPECT_EQ(*parse_digit('3').transform(twice), 6);
+    EXPECT_FALSE(parse_digit('x').transform(twice));
+    EXPECT_EQ(*parse_digit('3').and_then(odd), 3);
+    EXPECT_EQ(parse_digit('4').and_then(odd).error().message(),
+              "Generic error type: even");
+    EXPECT_EQ(parse_digit('x').and_then(odd).error().message(),
+              "Generic error type: x");
+    EXPECT_EQ(*parse_digit('x').or_else([](const error&) {
+        return result<int>(0);
+    }),
+              0);
+    EXPECT_EQ(*parse_digit('5').transform(
+                  [](int i) { return std::to_string(i); }),
+              "5");
+}
+
+TEST(Result, MoveOnly) {
+    result<std::unique_ptr<int>> owned(std::make_unique<int>(5));
+    ASSERT_TRUE(owned);
+    auto moved = std::move(owned).transform(
+        [](std::unique_ptr<int>&& p) { return *p + 1; });
+    EXPECT_EQ(*moved, 6);
+
+    result<std::unique_ptr<int>> other(std::make_unique<int>(2));
+    auto p = *std::move(other);
+    EXPECT_EQ(*p, 2);
+
+    result<std::unique_ptr<int>> failed(
+        error(generic_error_code::generic_error));
+    EXPECT_EQ(std::move(failed).value_or(nullptr), nullptr);
+}
+
+TEST(Result, ToTuple) {
+    auto [value, err] = parse_digit('9').to_tuple();
+    EXPECT_EQ(value, 9);
+    EXPECT_FALSE(err);
+
+    auto [missing, failed] = parse_digit('x').to_tuple();
+    EXPECT_EQ(missing, 0);
+    EXPECT_TRUE(failed);
+}
+
+} // namespace
@@ -37,6 +37,18 @@ struct url_error_category : std::error_category {
             return "Invalid host error";
         case url_error_code::range_error:
             return "The sequence '%' was not followed by two characters";
+        case url_error_code::limit_exceeded:
+            return "Parse limit exceeded";
+        case url_error_code::not_found:
+            return "Key not found";
+        case url_error_code::conversion_error:
+            return "Value could not be converted";
+        case url_error_code::out_of_range:
+            return "Value out of range";
+        case url_error_code::unknown_key:
+            return "Unknown key";
+        case url_error_code::duplicate_key:
+            return "Duplicate key";
         default:
             return "(unrecognized error)";
         }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <limits>
 #include <map>
 #include <string>
 #include <string_view>
@@ -22,6 +23,8 @@
 #include <absl/strings/string_view.h>
 
 #include "batteries/errors/error.hpp"
+#include "batteries/errors/error_counters.hpp"
+#include "batteries/errors/result.hpp"
 
 namespace batteries {
 
@@ -33,6 +36,42 @@ enum class url_error_code {
     escape_error,
     invalid_host_error,
     range_error,
+    limit_exceeded,
+    not_found,
+    conversion_error,
+    out_of_range,
+    unknown_key,
+    duplicate_key,
+};
+
+/**
+ * parse_limits bounds the work done parsing untrusted input. The input is
+ * checked against the limits before anything is decoded or allocated, and
+ * parsing fails with url_error_code::limit_exceeded as soon as one is
+ * crossed. Every limit defaults to unlimited.
+ */
+struct parse_limits {
+    // Maximum length of the input in bytes
+    std::size_t max_length = std::numeric_limits<std::size_t>::max();
+    // Maximum number of query parameters
+    std::size_t max_params = std::numeric_limits<std::size_t>::max();
+    // Maximum length of an escaped query key
+    std::size_t max_key_length = std::numeric_limits<std::size_t>::max();
+    // Maximum length of an escaped query value
+    std::size_t max_value_length = std::numeric_limits<std::size_t>::max();
+    // Maximum number of '%' escapes in the input
+    std::size_t max_escapes = std::numeric_limits<std::size_t>::max();
+};
+
+/**
+ * query_format controls how query parameters are serialized.
+ */
+struct query_format {
+    // The separator written between key=value pairs
+    char separator = '&';
+    // Whether pairs are written sorted by key. Values of the same key keep
+    // their order.
+    bool sorted = false;
 };
 
 // Define types
@@ -58,6 +97,17 @@ namespace net {
 
 std::error_code make_error_code(batteries::net::url_error_code);
 
+/**
+ * @brief url_error_count returns how many times url::parse, url::parse_uri
+ * and query::parse failed with code, in every thread. Each call is counted
+ * once by the function called, so the query of a url is only counted if it
+ * fails the url. It is always 0 unless built with BATT_ERROR_COUNTERS, see
+ * errors::count_error.
+ */
+inline uint64_t url_error_count(url_error_code code) {
+    return errors::total_error_count(make_error_code(code));
+}
+
 }
 
 } // namespace batteries
\ No newline at end of file
@@ -0,0 +1,263 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "cidr_set.hpp"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include <absl/strings/ascii.h>
+#include <absl/strings/str_cat.h>
+
+namespace batteries {
+
+namespace net {
+
+namespace detail {
+
+// ::ffff:0:0/96
+const absl::uint128 mapped_first = absl::MakeUint128(0, 0xffff00000000ull);
+const absl::uint128 mapped_last = absl::MakeUint128(0, 0xffffffffffffull);
+
+inline absl::uint128 to_uint128(const internal::ip_address& address) {
+    uint64_t high = 0;
+    uint64_t low = 0;
+    for (std::size_t i = 0; i < 8; i++) {
+        high = high << 8 | address[i];
+        low = low << 8 | address[i + 8];
+    }
+    return absl::MakeUint128(high, low);
+}
+
+inline bool is_mapped(absl::uint128 address) {
+    return mapped_first <= address && address <= mapped_last;
+}
+
+// Sorts and merges overlapping and adjacent ranges.
+template <typename T>
+void merge(std::vector<std::pair<T, T>>* ranges, std::vector<T>* first,
+           std::vector<T>* last) {
+    std::sort(ranges->begin(), ranges->end());
+    first->clear();
+    last->clear();
+    for (const auto& range : *ranges) {
+        if (!last->empty() &&
+            (range.first <= last->back() || range.first - 1 == last->back())) {
+            last->back() = std::max(last->back(), range.second);
+        } else {
+            first->push_back(range.first);
+            last->push_back(range.second);
+        }
+    }
+    first->shrink_to_fit();
+    last->shrink_to_fit();
+}
+
+// The number of elements of sorted that are less than or equal to value. The
+// loop runs log2(size) times whatever the value, and the compiler turns the
+// comparison into a conditional move.
+template <typename T>
+inline std::size_t count_le(const std::vector<T>& sorted, T value) {
+    std::size_t n = sorted.size();
+    if (n == 0) {
+        return 0;
+    }
+    const T* base = sorted.data();
+    while (n > 1) {
+        std::size_t half = n / 2;
+        base = (base[half] <= value) ? base + half : base;
+        n -= half;
+    }
+    return (base - sorted.data()) + (*base <= value);
+}
+
+template <typename T>
+inline bool in_ranges(const std::vector<T>& first, const std::vector<T>& last,
+                      T value) {
+    auto i = count_le(first, value);
+    return i > 0 && value <= last[i - 1];
+}
+
+// count_le for several values at once. Every search takes the same number of
+// steps, so they advance in lockstep and their loads are independent.
+template <typename T, std::size_t N>
+void in_ranges(const std::vector<T>& first, const std::vector<T>& last,
+               const std::array<T, N>& values, std::size_t count,
+               bool* results) {
+    std::size_t n = first.size();
+    if (n == 0) {
+        std::fill(results, results + count, false);
+        return;
+    }
+    std::array<const T*, N> bases;
+    bases.fill(first.data());
+    while (n > 1) {
+        std::size_t half = n / 2;
+        for (std::size_t k = 0; k < count; k++) {
+            bases[k] = (bases[k][half] <= values[k]) ? bases[k] + half : bases[k];
+        }
+        n -= half;
+    }
+    for (std::size_t k = 0; k < count; k++) {
+        std::size_t i = (bases[k] - first.data()) + (*bases[k] <= values[k]);
+        results[k] = i > 0 && values[k] <= last[i - 1];
+    }
+}
+
+} // namespace detail
+
+cidr_set::cidr_set()
+    : v4_first_()
+    , v4_last_()
+    , v6_first_()
+    , v6_last_() {}
+
+error cidr_set::assign(absl::Span<const std::string_view> cidrs) {
+    std::vector<std::pair<uint32_t, uint32_t>> v4;
+    std::vector<std::pair<absl::uint128, absl::uint128>> v6;
+
+    for (auto cidr : cidrs) {
+        auto slash = cidr.find('/');
+        auto address_part = cidr.substr(0, slash);
+        bool is_v6 = address_part.find(':') != address_part.npos;
+
+        internal::ip_address address;
+        if (!internal::parse_ip(address_part, &address)) {
+            return error(make_error_code(url_error_code::parse_error),
+                         absl::StrCat("invalid address in ", cidr));
+        }
+
+        unsigned bits = 128;
+        if (slash != cidr.npos) {
+            auto length = cidr.substr(slash + 1);
+            if (length.empty() || length.length() > 3) {
+                return error(make_error_code(url_error_code::parse_error),
+                             absl::StrCat("invalid prefix length in ", cidr));
+            }
+            bits = 0;
+            for (byte c : length) {
+                if (!absl::ascii_isdigit(c)) {
+                    return error(
+                        make_error_code(url_error_code::parse_error),
+                        absl::StrCat("invalid prefix length in ", cidr));
+                }
+                bits = bits * 10 + (c - '0');
+            }
+            if (bits > (is_v6 ? 128u : 32u)) {
+                return error(make_error_code(url_error_code::parse_error),
+                             absl::StrCat("invalid prefix length in ", cidr));
+            }
+            if (!is_v6) {
+                bits += 96;
+            }
+        }
+
+        absl::uint128 mask =
+            bits == 0 ? absl::uint128(0) : absl::Uint128Max() << (128 - bits);
+        absl::uint128 first = detail::to_uint128(address) & mask;
+        absl::uint128 last = first | ~mask;
+
+        v6.emplace_back(first, last);
+        // The part of the range that covers IPv4-mapped addresses
+        if (first <= detail::mapped_last && detail::mapped_first <= last) {
+            auto v4_first = std::max(first, detail::mapped_first);
+            auto v4_last = std::min(last, detail::mapped_last);
+            v4.emplace_back(static_cast<uint32_t>(absl::Uint128Low64(v4_first)),
+                            static_cast<uint32_t>(absl::Uint128Low64(v4_last)));
+        }
+    }
+
+    detail::merge(&v4, &v4_first_, &v4_last_);
+    detail::merge(&v6, &v6_first_, &v6_last_);
+    return errors::no_error;
+}
+
+bool cidr_set::contains(std::string_view hostname) const {
+    internal::ip_address address;
+    if (!internal::parse_ip(hostname, &address)) {
+        return false;
+    }
+    return contains(address);
+}
+
+bool cidr_set::contains(const internal::ip_address& address) const {
+    auto value = detail::to_uint128(address);
+    if (detail::is_mapped(value)) {
+        return detail::in_ranges(
+            v4_first_, v4_last_,
+            static_cast<uint32_t>(absl::Uint128Low64(value)));
+    }
+    return detail::in_ranges(v6_first_, v6_last_, value);
+}
+
+std::size_t cidr_set::contains_batch(
+    absl::Span<const std::string_view> hostnames,
+    absl::Span<bool> results) const {
+    constexpr std::size_t batch_size = 16;
+    std::array<uint32_t, batch_size> v4;
+    std::array<absl::uint128, batch_size> v6;
+    std::array<std::size_t, batch_size> v4_index;
+    std::array<std::size_t, batch_size> v6_index;
+    bool found[batch_size];
+    std::size_t contained = 0;
+
+    for (std::size_t batch = 0; batch < hostnames.size();
+         batch += batch_size) {
+        std::size_t count = std::min(batch_size, hostnames.size() - batch);
+        std::size_t v4_count = 0;
+        std::size_t v6_count = 0;
+
+        // Parse the whole batch first and split it by family
+        for (std::size_t i = 0; i < count; i++) {
+            internal::ip_address address;
+            results[batch + i] = false;
+            if (!internal::parse_ip(hostnames[batch + i], &address)) {
+                continue;
+            }
+            auto value = detail::to_uint128(address);
+            if (detail::is_mapped(value)) {
+                v4[v4_count] = static_cast<uint32_t>(absl::Uint128Low64(value));
+                v4_index[v4_count++] = batch + i;
+            } else {
+                v6[v6_count] = value;
+                v6_index[v6_count++] = batch + i;
+            }
+        }
+
+        detail::in_ranges(v4_first_, v4_last_, v4, v4_count, found);
+        for (std::size_t k = 0; k < v4_count; k++) {
+            results[v4_index[k]] = found[k];
+            contained += found[k];
+        }
+        detail::in_ranges(v6_first_, v6_last_, v6, v6_count, found);
+        for (std::size_t k = 0; k < v6_count; k++) {
+            results[v6_index[k]] = found[k];
+            contained += found[k];
+        }
+    }
+
+    return contained;
+}
+
+std::size_t cidr_set::size() const {
+    // Ranges of IPv4 addresses are also in the IPv6 ranges
+    return v6_first_.size();
+}
+
+bool cidr_set::empty() const { return v6_first_.empty(); }
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,101 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <absl/numeric/int128.h>
+#include <absl/types/span.h>
+
+#include "base.hpp"
+#include "internal/parse.hpp"
+
+namespace batteries {
+
+namespace net {
+
+/**
+ * A cidr_set matches IP-literal hostnames against a set of CIDR ranges, such
+ * as the private networks a proxy must not connect to. The ranges are merged
+ * into sorted, disjoint address ranges and looked up with a branch-free
+ * binary search.
+ *
+ * IPv4 addresses and IPv4-mapped IPv6 addresses (::ffff:a.b.c.d) are the same
+ * address, so "10.0.0.0/8" contains "[::ffff:10.1.2.3]" and
+ * "::ffff:0:0/96" contains every IPv4 address. Zones are ignored.
+ */
+class cidr_set {
+
+  public:
+    cidr_set();
+
+    /**
+     * @brief assign replaces the ranges of the set. The set is unchanged if
+     * a range is invalid.
+     * @param cidrs The ranges, such as "10.0.0.0/8", "fe80::/10" or a single
+     * address. Bits past the prefix length are ignored.
+     * @returns An error naming the first invalid range, if any.
+     */
+    error assign(absl::Span<const std::string_view> cidrs);
+
+    /**
+     * @brief contains returns whether hostname is an IP literal in the set.
+     * @param hostname The hostname, as returned by url::hostname().
+     * @returns false if hostname isn't an IP literal or isn't in the set.
+     */
+    bool contains(std::string_view hostname) const;
+
+    /**
+     * @brief contains returns whether address is in the set.
+     */
+    bool contains(const internal::ip_address& address) const;
+
+    /**
+     * @brief contains_batch looks up many hostnames at once. The hostnames
+     * are parsed first and the binary searches of a batch run in lockstep so
+     * their memory accesses overlap.
+     * @param hostnames The hostnames, as returned by url::hostname().
+     * @param results Whether each hostname is in the set, it must be at least
+     * as large as hostnames.
+     * @returns The number of hostnames in the set.
+     */
+    std::size_t contains_batch(absl::Span<const std::string_view> hostnames,
+                               absl::Span<bool> results) const;
+
+    /**
+     * @brief size returns the number of disjoint ranges after merging.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief empty returns whether the set contains no address.
+     */
+    bool empty() const;
+
+  private:
+    // IPv4 and IPv4-mapped addresses, the parts of IPv6 ranges that cover
+    // ::ffff:0:0/96 included.
+    std::vector<uint32_t> v4_first_;
+    std::vector<uint32_t> v4_last_;
+    // All other IPv6 addresses
+    std::vector<absl::uint128> v6_first_;
+    std::vector<absl::uint128> v6_last_;
+};
+
+} // namespace net
+
+} // namespace batteries
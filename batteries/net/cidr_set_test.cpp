@@ -0,0 +1,182 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "cidr_set.hpp"
+
+#include <string>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+
+#include "url.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using batteries::net::cidr_set;
+using batteries::net::url;
+using batteries::net::internal::ip_address;
+using batteries::net::internal::parse_ip;
+
+ip_address v4(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+    return ip_address{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, a, b, c, d};
+}
+
+TEST(ParseIp, IPv4) {
+    ip_address address;
+    ASSERT_TRUE(parse_ip("127.0.0.1", &address));
+    EXPECT_EQ(address, v4(127, 0, 0, 1));
+    ASSERT_TRUE(parse_ip("127.1", &address));
+    EXPECT_EQ(address, v4(127, 0, 0, 1));
+    ASSERT_TRUE(parse_ip("2130706433", &address));
+    EXPECT_EQ(address, v4(127, 0, 0, 1));
+    ASSERT_TRUE(parse_ip("0x7f.0.0.01", &address));
+    EXPECT_EQ(address, v4(127, 0, 0, 1));
+    ASSERT_TRUE(parse_ip("10.1.65535", &address));
+    EXPECT_EQ(address, v4(10, 1, 255, 255));
+
+    for (auto host : {"", "example.com", "1.2.3.4.5", "256.0.0.1", "1..2",
+                      "1.2.3.", "08.0.0.1", "0x", "4294967296", "1.65536.1",
+                      "[1.2.3.4]"}) {
+        EXPECT_FALSE(parse_ip(host, &address)) << host;
+    }
+}
+
+TEST(ParseIp, IPv6) {
+    ip_address address;
+    ASSERT_TRUE(parse_ip("[::1]", &address));
+    EXPECT_EQ(address, (ip_address{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                   0, 1}));
+    ASSERT_TRUE(parse_ip("[2001:db8::8:800:200c:417a]", &address));
+    EXPECT_EQ(address, (ip_address{0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0x08,
+                                   0x08, 0, 0x20, 0x0c, 0x41, 0x7a}));
+    ASSERT_TRUE(parse_ip("[fe80::1%en0]", &address));
+    EXPECT_EQ(address, (ip_address{0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                   0, 0, 1}));
+    ASSERT_TRUE(parse_ip("::ffff:192.168.0.1", &address));
+    EXPECT_EQ(address, v4(192, 168, 0, 1));
+    ASSERT_TRUE(parse_ip("1:2:3:4:5:6:7::", &address));
+    ASSERT_TRUE(parse_ip("::", &address));
+
+    for (auto host : {"[::1", "[]", "[:1]", "[1:::2]", "[1::2::3]",
+                      "[1:2:3:4:5:6:7:8:9]", "[1:2:3:4:5:6:7]", "[12345::]",
+                      "[::1.2.3]", "[::01.2.3.4]", "[1:2:3:4:5:6:7::1.2.3.4]",
+                      "[1:]"}) {
+        EXPECT_FALSE(parse_ip(host, &address)) << host;
+    }
+}
+
+TEST(CidrSet, Contains) {
+    cidr_set set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains("127.0.0.1"));
+
+    const std::vector<std::string_view> cidrs = {
+        "10.0.0.0/8", "127.0.0.0/8", "169.254.169.254", "192.168.1.7/16",
+        "::1/128",    "fe80::/10",   "[fc00::]/7",
+    };
+    ASSERT_FALSE(set.assign(cidrs));
+    EXPECT_FALSE(set.empty());
+
+    for (auto host : {"10.0.0.1", "10.255.255.255", "127.1", "0x7f000001",
+                      "169.254.169.254", "192.168.200.1", "[::1]",
+                      "[fe80::1%25en0]", "[fe80::1%en0]", "[fd00::1]",
+                      "[::ffff:10.1.2.3]", "[::ffff:a01:203]"}) {
+        EXPECT_TRUE(set.contains(host)) << host;
+    }
+    for (auto host : {"11.0.0.0", "9.255.255.255", "169.254.169.253",
+                      "192.169.0.0", "[::2]", "[2001:db8::1]", "[::a00:1]",
+                      "example.com", "", "[::1"}) {
+        EXPECT_FALSE(set.contains(host)) << host;
+    }
+}
+
+TEST(CidrSet, UrlHostname) {
+    cidr_set set;
+    const std::vector<std::string_view> cidrs = {"127.0.0.0/8", "::1"};
+    ASSERT_FALSE(set.assign(cidrs));
+
+    EXPECT_TRUE(set.contains(url("http://127.0.0.1:8080/").hostname()));
+    EXPECT_TRUE(set.contains(url("http://[::1]:8080/").hostname()));
+    EXPECT_FALSE(set.contains(url("http://localhost:8080/").hostname()));
+}
+
+TEST(CidrSet, MappedAndMerged) {
+    cidr_set set;
+    const std::vector<std::string_view> cidrs = {
+        "::ffff:0:0/96", "1.2.3.0/24", "1.2.4.0/24", "2001:db8::/32",
+        "2001:db8:1::/48",
+    };
+    ASSERT_FALSE(set.assign(cidrs));
+    EXPECT_EQ(set.size(), 2u);
+    EXPECT_TRUE(set.contains("8.8.8.8"));
+    EXPECT_TRUE(set.contains("[2001:db8:ffff::1]"));
+    EXPECT_FALSE(set.contains("[2001:db9::]"));
+
+    const std::vector<std::string_view> all = {"::/0"};
+    ASSERT_FALSE(set.assign(all));
+    EXPECT_TRUE(set.contains("0.0.0.0"));
+    EXPECT_TRUE(set.contains("[ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff]"));
+}
+
+TEST(CidrSet, InvalidRanges) {
+    cidr_set set;
+    const std::vector<std::string_view> good = {"10.0.0.0/8"};
+    ASSERT_FALSE(set.assign(good));
+
+    for (std::string_view cidr :
+         {"10.0.0.0/33", "::/129", "10.0.0.0/", "10.0.0.0/a", "example.com/8",
+          "10.0.0.0/8/8"}) {
+        const std::vector<std::string_view> bad = {"1.1.1.1", cidr};
+        EXPECT_TRUE(set.assign(bad)) << cidr;
+    }
+    EXPECT_TRUE(set.contains("10.1.1.1"));
+    EXPECT_FALSE(set.contains("1.1.1.1"));
+}
+
+TEST(CidrSet, Batch) {
+    std::vector<std::string> storage;
+    for (int i = 0; i < 1000; i++) {
+        storage.push_back(absl::StrCat("10.", i % 256, ".", i / 256, ".0/24"));
+        storage.push_back(absl::StrCat("2001:db8:", i, "::/48"));
+    }
+    std::vector<std::string_view> cidrs(storage.begin(), storage.end());
+    cidr_set set;
+    ASSERT_FALSE(set.assign(cidrs));
+
+    std::vector<std::string> host_storage;
+    for (int i = 0; i < 100; i++) {
+        host_storage.push_back(absl::StrCat("10.", i, ".", i % 7, ".1"));
+        host_storage.push_back(absl::StrCat("[2001:db8:", i * 37, "::1]"));
+        host_storage.push_back(absl::StrCat("11.", i, ".0.1"));
+        host_storage.push_back("example.com");
+    }
+    std::vector<std::string_view> hosts(host_storage.begin(),
+                                        host_storage.end());
+    std::unique_ptr<bool[]> results(new bool[hosts.size()]);
+    auto contained =
+        set.contains_batch(hosts, absl::MakeSpan(results.get(), hosts.size()));
+
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < hosts.size(); i++) {
+        EXPECT_EQ(results[i], set.contains(hosts[i])) << hosts[i];
+        expected += results[i];
+    }
+    EXPECT_EQ(contained, expected);
+    EXPECT_GT(contained, 0u);
+}
+
+} // namespace
@@ -0,0 +1,144 @@
+#!/usr/bin/python
+# Copyright 2019 The Batteries Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate the embedded Public Suffix List.
+
+Usage: <path_to_batteries>/net/data/generate_public_suffix_list.py
+
+The rules and section markers of public_suffix_list.dat are written to
+net/internal/GENERATED_public_suffix_list.cpp as string literals. Other
+comments and blank lines are dropped.
+"""
+
+from os import path
+
+# MSVC limits a string literal to 16380 bytes and concatenated literals to
+# 65535, so every chunk stays well below both.
+CHUNK_SIZE = 12000
+
+SECTION_MARKERS = ("===BEGIN PRIVATE DOMAINS===", "===END PRIVATE DOMAINS===")
+
+
+def relative_filename(filename):
+  return path.join(path.dirname(__file__), filename)
+
+
+def file_header_lines():
+  return [
+      "GENERATED! DO NOT MANUALLY EDIT THIS FILE.", "",
+      "(1) Replace batteries/net/data/public_suffix_list.dat.",
+      "(2) Run `python <path_to_batteries>/net/data/"
+      "generate_public_suffix_list.py`.", "",
+      "The rules are those of the Public Suffix List, which is licensed under",
+      "the Mozilla Public License, v. 2.0. If a copy of the MPL was not",
+      "distributed with this file, You can obtain one at",
+      "https://mozilla.org/MPL/2.0/."
+  ]
+
+
+def kept_lines(list_path):
+  with open(list_path, "rb") as f:
+    for line in f.read().split(b"\n"):
+      line = line.rstrip(b"\r")
+      if line.startswith(b"//"):
+        if any(marker.encode() in line for marker in SECTION_MARKERS):
+          yield line
+      elif line.strip():
+        yield line
+
+
+def literal(line):
+  """Returns line plus a newline as a C++ string literal of ASCII text."""
+  out = '"'
+  escaped = False
+  for byte in line + b"\n":
+    c = chr(byte)
+    if escaped and c in "0123456789abcdefABCDEF":
+      # A hex escape would swallow the digit
+      out += '" "'
+    escaped = False
+    if byte >= 0x80:
+      out += "\\x%02x" % byte
+      escaped = True
+    elif c == "\n":
+      out += "\\n"
+    elif c in '"\\':
+      out += "\\" + c
+    else:
+      out += c
+  return out + '"'
+
+
+def chunks(lines):
+  chunk, size = [], 0
+  for line in lines:
+    if chunk and size + len(line) + 1 > CHUNK_SIZE:
+      yield chunk
+      chunk, size = [], 0
+    chunk.append(line)
+    size += len(line) + 1
+  if chunk:
+    yield chunk
+
+
+def generate(list_path, output_path):
+  out = ["// " + line if line else "//" for line in file_header_lines()]
+  out += [
+      "",
+      '#include "batteries/net/internal/public_suffix_list.hpp"',
+      "",
+      "namespace batteries {",
+      "",
+      "namespace net {",
+      "",
+      "namespace internal {",
+      "",
+      "namespace detail {",
+      "",
+      "// Whole lines of the list, in order",
+      "const std::string_view public_suffix_list[] = {",
+  ]
+  for chunk in chunks(kept_lines(list_path)):
+    out += ["    " + literal(line) for line in chunk]
+    out[-1] += ","
+    out.append("")
+  out.pop()
+  out += [
+      "};",
+      "",
+      "} // namespace detail",
+      "",
+      "absl::Span<const std::string_view> vendored_public_suffix_list() {",
+      "    return detail::public_suffix_list;",
+      "}",
+      "",
+      "} // namespace internal",
+      "",
+      "} // namespace net",
+      "",
+      "} // namespace batteries",
+  ]
+  with open(output_path, "w") as f:
+    f.write("\n".join(out) + "\n")
+
+
+def main():
+  generate(
+      relative_filename("public_suffix_list.dat"),
+      relative_filename("../internal/GENERATED_public_suffix_list.cpp"))
+
+
+if __name__ == "__main__":
+  main()
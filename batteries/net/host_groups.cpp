@@ -0,0 +1,184 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "host_groups.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace batteries {
+
+namespace net {
+
+namespace detail {
+
+// 64 bit FNV-1a
+inline uint64_t hash_host(std::string_view host) {
+    uint64_t hash = 14695981039346656037ull;
+    for (byte c : host) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// The first 8 bytes of the path packed big endian so that comparing prefixes
+// as integers orders them like the strings.
+inline uint64_t path_prefix(std::string_view path) {
+    uint64_t prefix = 0;
+    for (std::size_t i = 0; i < 8; i++) {
+        prefix <<= 8;
+        if (i < path.length()) {
+            prefix |= static_cast<byte>(path[i]);
+        }
+    }
+    return prefix;
+}
+
+} // namespace detail
+
+host_groups::host_groups()
+    : keys_()
+    , scratch_()
+    , order_()
+    , runs_() {}
+
+void host_groups::build(absl::Span<const url> urls) {
+    auto n = urls.size();
+
+    keys_.resize(n);
+    for (std::size_t i = 0; i < n; i++) {
+        keys_[i] = sort_key{detail::hash_host(urls[i].hostname()),
+                            detail::path_prefix(urls[i].path()),
+                            static_cast<uint32_t>(i)};
+    }
+
+    radix_sort();
+
+    auto by_host = [&](const sort_key& lhs, const sort_key& rhs) {
+        return urls[lhs.index].hostname() < urls[rhs.index].hostname();
+    };
+    auto by_path = [&](const sort_key& lhs, const sort_key& rhs) {
+        return urls[lhs.index].path() < urls[rhs.index].path();
+    };
+
+    runs_.clear();
+    auto first = keys_.begin();
+    while (first != keys_.end()) {
+        auto last = std::find_if(first, keys_.end(), [&](const sort_key& key) {
+            return key.host_hash != first->host_hash;
+        });
+
+        // Different hosts with the same hash are interleaved by path, so
+        // separate them again. The sort is stable to keep the path order.
+        const auto& hostname = urls[first->index].hostname();
+        bool collision = std::any_of(first, last, [&](const sort_key& key) {
+            return urls[key.index].hostname() != hostname;
+        });
+        if (collision) {
+            std::stable_sort(first, last, by_host);
+        }
+
+        while (first != last) {
+            auto host_last = first + 1;
+            if (collision) {
+                const auto& host = urls[first->index].hostname();
+                while (host_last != last &&
+                       urls[host_last->index].hostname() == host) {
+                    ++host_last;
+                }
+            } else {
+                host_last = last;
+            }
+
+            // Order paths that share the same prefix
+            auto tie = first;
+            while (tie != host_last) {
+                auto tie_last = tie + 1;
+                while (tie_last != host_last &&
+                       tie_last->path_prefix == tie->path_prefix) {
+                    ++tie_last;
+                }
+                if (tie_last - tie > 1) {
+                    std::stable_sort(tie, tie_last, by_path);
+                }
+                tie = tie_last;
+            }
+
+            runs_.push_back(run{static_cast<std::size_t>(first - keys_.begin()),
+                                static_cast<std::size_t>(host_last - first)});
+            first = host_last;
+        }
+    }
+
+    order_.resize(n);
+    for (std::size_t i = 0; i < n; i++) {
+        order_[i] = keys_[i].index;
+    }
+}
+
+const std::vector<uint32_t>& host_groups::order() const { return order_; }
+
+const std::vector<host_groups::run>& host_groups::runs() const {
+    return runs_;
+}
+
+void host_groups::radix_sort() {
+    // LSD radix sort on the 16 bytes of (host_hash, path_prefix), least
+    // significant byte of the path prefix first.
+    constexpr std::size_t passes = 16;
+    auto digit = [](const sort_key& key, std::size_t pass) -> std::size_t {
+        if (pass < 8) {
+            return (key.path_prefix >> (8 * pass)) & 0xff;
+        }
+        return (key.host_hash >> (8 * (pass - 8))) & 0xff;
+    };
+
+    auto n = keys_.size();
+    if (n < 2) {
+        return;
+    }
+
+    // Count every pass up front so the keys are read only once for counting.
+    std::vector<std::array<std::size_t, 256>> counts(passes);
+    for (auto& key : keys_) {
+        for (std::size_t pass = 0; pass < passes; pass++) {
+            counts[pass][digit(key, pass)]++;
+        }
+    }
+
+    scratch_.resize(n);
+    for (std::size_t pass = 0; pass < passes; pass++) {
+        auto& count = counts[pass];
+        // Every key has the same digit, the pass wouldn't move anything.
+        if (count[digit(keys_[0], pass)] == n) {
+            continue;
+        }
+
+        std::size_t offset = 0;
+        for (auto& c : count) {
+            auto size = c;
+            c = offset;
+            offset += size;
+        }
+        for (auto& key : keys_) {
+            scratch_[count[digit(key, pass)]++] = key;
+        }
+        keys_.swap(scratch_);
+    }
+}
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,90 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include "url.hpp"
+
+namespace batteries {
+
+namespace net {
+
+/**
+ * A host_groups orders a batch of urls so that all urls of a host are
+ * contiguous and, within a host, ordered by path. Fixed width keys made of a
+ * hash of url::hostname() and the first bytes of url::path() are extracted
+ * into a separate array and radix sorted, so the urls themselves are only
+ * touched to extract the keys and to break ties.
+ *
+ * The hosts appear in an arbitrary but deterministic order. The buffers are
+ * kept between calls to build so a host_groups can be reused for many
+ * batches.
+ */
+class host_groups {
+
+  public:
+    /**
+     * A run is a range of order() that contains the urls of a single host.
+     */
+    struct run {
+        std::size_t first;
+        std::size_t count;
+    };
+
+    host_groups();
+
+    /**
+     * @brief build groups urls by host and orders them by path within each
+     * host. At most 2^32 - 1 urls can be grouped.
+     * @param urls The urls to group. They must outlive the call only.
+     */
+    void build(absl::Span<const url> urls);
+
+    /**
+     * @brief order returns the indices of the urls passed to build in
+     * grouped order.
+     * @returns The indices of the urls, host contiguous and path ordered.
+     */
+    const std::vector<uint32_t>& order() const;
+
+    /**
+     * @brief runs returns the host contiguous runs of order().
+     * @returns One run per distinct host.
+     */
+    const std::vector<run>& runs() const;
+
+  private:
+    struct sort_key {
+        uint64_t host_hash;
+        uint64_t path_prefix;
+        uint32_t index;
+    };
+
+    void radix_sort();
+
+  private:
+    std::vector<sort_key> keys_;
+    std::vector<sort_key> scratch_;
+    std::vector<uint32_t> order_;
+    std::vector<run> runs_;
+};
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,89 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "host_groups.hpp"
+
+#include <set>
+
+#include <absl/strings/str_cat.h>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using batteries::net::host_groups;
+using batteries::net::url;
+
+TEST(HostGroups, Empty) {
+    host_groups groups;
+    groups.build({});
+    EXPECT_TRUE(groups.order().empty());
+    EXPECT_TRUE(groups.runs().empty());
+}
+
+TEST(HostGroups, GroupsAndOrders) {
+    std::vector<url> urls;
+    const std::vector<std::string> hosts = {"foo.com", "bar.com",
+                                            "example.org", "a.b.c.d"};
+    // Interleave the hosts and use paths that share long prefixes
+    for (int i = 0; i < 200; i++) {
+        urls.emplace_back(absl::StrCat("http://", hosts[(i * 7) % hosts.size()],
+                                       "/path/to/file", (i * 13) % 97));
+    }
+    urls.emplace_back("http://foo.com/");
+    urls.emplace_back("http://foo.com/a");
+
+    host_groups groups;
+    groups.build(urls);
+
+    auto& order = groups.order();
+    ASSERT_EQ(order.size(), urls.size());
+    EXPECT_EQ(std::set<uint32_t>(order.begin(), order.end()).size(),
+              urls.size());
+
+    ASSERT_EQ(groups.runs().size(), hosts.size());
+    std::set<std::string> seen;
+    std::size_t next = 0;
+    for (auto& run : groups.runs()) {
+        EXPECT_EQ(run.first, next);
+        next += run.count;
+
+        auto& hostname = urls[order[run.first]].hostname();
+        EXPECT_TRUE(seen.insert(hostname).second) << hostname;
+        for (std::size_t i = run.first; i < run.first + run.count; i++) {
+            EXPECT_EQ(urls[order[i]].hostname(), hostname);
+            if (i > run.first) {
+                EXPECT_LE(urls[order[i - 1]].path(), urls[order[i]].path());
+            }
+        }
+    }
+    EXPECT_EQ(next, urls.size());
+}
+
+TEST(HostGroups, Reuse) {
+    std::vector<url> first = {url("http://a.com/2"), url("http://b.com/1"),
+                              url("http://a.com/1")};
+    std::vector<url> second = {url("http://c.com/")};
+
+    host_groups groups;
+    groups.build(first);
+    EXPECT_EQ(groups.runs().size(), 2);
+
+    groups.build(second);
+    EXPECT_THAT(groups.order(), ::testing::ElementsAre(0));
+    EXPECT_EQ(groups.runs().size(), 1);
+}
+
+} // namespace
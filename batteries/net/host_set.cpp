@@ -0,0 +1,172 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "host_set.hpp"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+#include <absl/strings/ascii.h>
+#include <absl/strings/match.h>
+
+namespace batteries {
+
+namespace net {
+
+namespace detail {
+
+// The flags of the nodes of the trie
+enum host_flags : uint8_t {
+    match_exact = 1 << 0,
+    match_subdomains = 1 << 1,
+};
+
+// The reader slot of the calling thread
+inline std::size_t reader_slot_index(std::size_t slots) {
+    thread_local std::size_t slot =
+        std::hash<std::thread::id>()(std::this_thread::get_id());
+    return slot % slots;
+}
+
+} // namespace detail
+
+host_set::host_set()
+    : patterns_(new patterns())
+    , epoch_(0) {}
+
+host_set::~host_set() { delete patterns_.load(); }
+
+template <typename F> auto host_set::read(F&& f) const {
+    auto& slot = slots_[detail::reader_slot_index(reader_slots)];
+    auto& readers = slot.readers[epoch_.load() & 1];
+    // The count is raised before the pointer is loaded, so a rebuild that
+    // sees it at zero after swapping the pointer knows this lookup will see
+    // the new patterns.
+    readers.fetch_add(1);
+    auto result = f(*patterns_.load());
+    readers.fetch_sub(1, std::memory_order_release);
+    return result;
+}
+
+void host_set::assign(absl::Span<const std::string_view> patterns) {
+    internal::label_trie::builder builder;
+    builder.reserve(patterns.size());
+    std::size_t size = 0;
+    for (auto pattern : patterns) {
+        insert(&builder, pattern, &size);
+    }
+    publish(&builder, size);
+}
+
+void host_set::load(std::string_view list) {
+    internal::label_trie::builder builder;
+    std::size_t size = 0;
+    while (!list.empty()) {
+        auto eol = list.find('\n');
+        auto line = absl::StripAsciiWhitespace(list.substr(0, eol));
+        list = eol == list.npos ? std::string_view() : list.substr(eol + 1);
+        if (!absl::StartsWith(line, "#")) {
+            insert(&builder, line, &size);
+        }
+    }
+    publish(&builder, size);
+}
+
+bool host_set::matches(std::string_view hostname) const {
+    if (absl::EndsWith(hostname, ".")) {
+        hostname.remove_suffix(1);
+    }
+
+    return read([hostname](const patterns& current) {
+        const auto& trie = current.trie;
+        auto node = internal::label_trie::root;
+        std::size_t end = hostname.length();
+        while (end != hostname.npos) {
+            auto label = internal::next_label(hostname, end);
+            if (label.empty()) {
+                return false;
+            }
+            node = trie.find_child(node, label);
+            if (node == internal::label_trie::npos) {
+                return false;
+            }
+            auto flags = trie.flags(node);
+            if (end == hostname.npos) {
+                return (flags & detail::match_exact) != 0;
+            }
+            if (flags & detail::match_subdomains) {
+                // The rest of the hostname only has to be made of labels
+                auto rest = hostname.substr(0, end);
+                return !rest.empty() && rest.front() != '.' &&
+                       rest.back() != '.' && rest.find("..") == rest.npos;
+            }
+        }
+        return false;
+    });
+}
+
+std::size_t host_set::size() const {
+    return read([](const patterns& current) { return current.size; });
+}
+
+bool host_set::empty() const { return size() == 0; }
+
+std::size_t host_set::memory_usage() const {
+    return read(
+        [](const patterns& current) { return current.trie.memory_usage(); });
+}
+
+void host_set::insert(internal::label_trie::builder* builder,
+                      std::string_view pattern, std::size_t* size) {
+    uint8_t flags = detail::match_exact;
+    if (absl::StartsWith(pattern, "*.")) {
+        pattern.remove_prefix(2);
+        flags = detail::match_subdomains;
+    } else if (absl::StartsWith(pattern, ".")) {
+        pattern.remove_prefix(1);
+        flags = detail::match_exact | detail::match_subdomains;
+    }
+    if (absl::EndsWith(pattern, ".")) {
+        pattern.remove_suffix(1);
+    }
+
+    if (pattern.empty()) {
+        return;
+    }
+    builder->insert(pattern, flags);
+    (*size)++;
+}
+
+void host_set::publish(internal::label_trie::builder* builder,
+                       std::size_t size) {
+    auto old = patterns_.exchange(new patterns{builder->build(), size});
+
+    // Lookups that may still see old counted themselves before the
+    // exchange, in either half. Flipping the epoch sends new lookups to the
+    // other half so that each half drains in turn.
+    for (int flip = 0; flip < 2; flip++) {
+        auto parity = epoch_.fetch_add(1) & 1;
+        for (auto& slot : slots_) {
+            while (slot.readers[parity].load() != 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+    delete old;
+}
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,128 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+#include <absl/types/span.h>
+
+#include "base.hpp"
+#include "internal/label_trie.hpp"
+
+namespace batteries {
+
+namespace net {
+
+/**
+ * A host_set matches hostnames against a set of domain patterns, such as an
+ * allow or block list. The patterns are
+ *
+ *   "example.com"    matches example.com only
+ *   "*.example.com"  matches the subdomains of example.com only
+ *   ".example.com"   matches example.com and its subdomains
+ *
+ * Patterns and hostnames are compared ASCII case-insensitively and a single
+ * trailing dot is ignored. The patterns are compiled into a trie of reversed
+ * labels with every distinct label stored once, and matches walks the labels
+ * of the hostname once from right to left.
+ *
+ * matches may be called from any number of threads while another thread
+ * rebuilds the set; each lookup sees either the old or the new patterns.
+ * Lookups are lock-free: the patterns are published through an atomic
+ * pointer and a lookup only increments and decrements a reader count on a
+ * cache line picked by its thread. A rebuild waits until no lookup can still
+ * see the old patterns before freeing them. Rebuilds must not run
+ * concurrently with each other.
+ */
+class host_set {
+
+  public:
+    host_set();
+    ~host_set();
+
+    host_set(const host_set&) = delete;
+    host_set& operator=(const host_set&) = delete;
+
+    /**
+     * @brief assign compiles patterns and replaces the current patterns.
+     * Empty patterns are ignored.
+     * @param patterns The patterns.
+     */
+    void assign(absl::Span<const std::string_view> patterns);
+
+    /**
+     * @brief load compiles a list with one pattern per line and replaces the
+     * current patterns. Blank lines and lines starting with '#' are ignored.
+     * @param list The list.
+     */
+    void load(std::string_view list);
+
+    /**
+     * @brief matches returns whether hostname matches any pattern.
+     * @param hostname The hostname, as returned by url::hostname().
+     * @returns true if a pattern matches.
+     */
+    bool matches(std::string_view hostname) const;
+
+    /**
+     * @brief size returns the number of patterns.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief empty returns whether there are no patterns.
+     */
+    bool empty() const;
+
+    /**
+     * @brief memory_usage returns the number of bytes used by the compiled
+     * patterns.
+     */
+    std::size_t memory_usage() const;
+
+  private:
+    struct patterns {
+        internal::label_trie trie;
+        std::size_t size = 0;
+    };
+
+    void insert(internal::label_trie::builder* builder,
+                std::string_view pattern, std::size_t* size);
+
+    void publish(internal::label_trie::builder* builder, std::size_t size);
+
+    // Calls f with the current patterns, which stay alive until f returns.
+    template <typename F> auto read(F&& f) const;
+
+    // Lookups of a thread count themselves in one of reader_slots slots,
+    // in the half selected by the parity of epoch_ when they started.
+    static constexpr std::size_t reader_slots = 16;
+
+    struct alignas(64) reader_slot {
+        std::atomic<uint32_t> readers[2] = {};
+    };
+
+  private:
+    std::atomic<const patterns*> patterns_;
+    std::atomic<uint32_t> epoch_;
+    mutable std::array<reader_slot, reader_slots> slots_;
+};
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,121 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "host_set.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using batteries::net::host_set;
+
+TEST(HostSet, Empty) {
+    host_set hosts;
+    EXPECT_TRUE(hosts.empty());
+    EXPECT_FALSE(hosts.matches("example.com"));
+    EXPECT_FALSE(hosts.matches(""));
+}
+
+TEST(HostSet, Patterns) {
+    host_set hosts;
+    const std::vector<std::string_view> patterns = {
+        "exact.com", "*.sub.com", ".both.org", "Mixed.Case.NET.", "", "*.",
+    };
+    hosts.assign(patterns);
+    EXPECT_EQ(hosts.size(), 4u);
+
+    EXPECT_TRUE(hosts.matches("exact.com"));
+    EXPECT_TRUE(hosts.matches("EXACT.com."));
+    EXPECT_FALSE(hosts.matches("www.exact.com"));
+    EXPECT_FALSE(hosts.matches("com"));
+
+    EXPECT_FALSE(hosts.matches("sub.com"));
+    EXPECT_TRUE(hosts.matches("a.sub.com"));
+    EXPECT_TRUE(hosts.matches("a.b.sub.com"));
+    EXPECT_FALSE(hosts.matches("asub.com"));
+
+    EXPECT_TRUE(hosts.matches("both.org"));
+    EXPECT_TRUE(hosts.matches("www.both.org"));
+    EXPECT_FALSE(hosts.matches("org"));
+
+    EXPECT_TRUE(hosts.matches("mixed.case.net"));
+    EXPECT_FALSE(hosts.matches("case.net"));
+
+    EXPECT_FALSE(hosts.matches("a..sub.com"));
+    EXPECT_FALSE(hosts.matches(".both.org"));
+}
+
+TEST(HostSet, Load) {
+    host_set hosts;
+    hosts.load("# blocked\n\nexample.com\r\n  *.ads.example.net  \n#x.com");
+    EXPECT_EQ(hosts.size(), 2u);
+    EXPECT_TRUE(hosts.matches("example.com"));
+    EXPECT_TRUE(hosts.matches("tracker.ads.example.net"));
+    EXPECT_FALSE(hosts.matches("x.com"));
+}
+
+TEST(HostSet, Large) {
+    std::vector<std::string> storage;
+    for (int i = 0; i < 20000; i++) {
+        storage.push_back(absl::StrCat("host", i, ".domain", i % 100, ".com"));
+    }
+    std::vector<std::string_view> patterns(storage.begin(), storage.end());
+    host_set hosts;
+    hosts.assign(patterns);
+    EXPECT_EQ(hosts.size(), storage.size());
+    for (int i = 0; i < 20000; i += 97) {
+        EXPECT_TRUE(hosts.matches(storage[i]));
+        EXPECT_FALSE(hosts.matches(absl::StrCat("x", storage[i])));
+    }
+    // The shared labels are stored once
+    EXPECT_LT(hosts.memory_usage(), storage.size() * 64);
+}
+
+TEST(HostSet, ConcurrentRebuild) {
+    host_set hosts;
+    const std::vector<std::string_view> first = {".a.com"};
+    const std::vector<std::string_view> second = {".a.com", ".b.com"};
+    hosts.assign(first);
+
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&] {
+            while (!done) {
+                if (!hosts.matches("www.a.com")) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 200; i++) {
+        hosts.assign(i % 2 ? first : second);
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(failures, 0);
+}
+
+} // namespace
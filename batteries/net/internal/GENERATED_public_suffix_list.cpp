@@ -0,0 +1,9552 @@
+// GENERATED! DO NOT MANUALLY EDIT THIS FILE.
+//
+// (1) Replace batteries/net/data/public_suffix_list.dat.
+// (2) Run `python <path_to_batteries>/net/data/generate_public_suffix_list.py`.
+//
+// The rules are those of the Public Suffix List, which is licensed under
+// the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at
+// https://mozilla.org/MPL/2.0/.
+
+#include "batteries/net/internal/public_suffix_list.hpp"
+
+namespace batteries {
+
+namespace net {
+
+namespace internal {
+
+namespace detail {
+
+// Whole lines of the list, in order
+const std::string_view public_suffix_list[] = {
+    "ac\n"
+    "com.ac\n"
+    "edu.ac\n"
+    "gov.ac\n"
+    "net.ac\n"
+    "mil.ac\n"
+    "org.ac\n"
+    "ad\n"
+    "nom.ad\n"
+    "ae\n"
+    "co.ae\n"
+    "net.ae\n"
+    "org.ae\n"
+    "sch.ae\n"
+    "ac.ae\n"
+    "gov.ae\n"
+    "mil.ae\n"
+    "aero\n"
+    "accident-investigation.aero\n"
+    "accident-prevention.aero\n"
+    "aerobatic.aero\n"
+    "aeroclub.aero\n"
+    "aerodrome.aero\n"
+    "agents.aero\n"
+    "aircraft.aero\n"
+    "airline.aero\n"
+    "airport.aero\n"
+    "air-surveillance.aero\n"
+    "airtraffic.aero\n"
+    "air-traffic-control.aero\n"
+    "ambulance.aero\n"
+    "amusement.aero\n"
+    "association.aero\n"
+    "author.aero\n"
+    "ballooning.aero\n"
+    "broker.aero\n"
+    "caa.aero\n"
+    "cargo.aero\n"
+    "catering.aero\n"
+    "certification.aero\n"
+    "championship.aero\n"
+    "charter.aero\n"
+    "civilaviation.aero\n"
+    "club.aero\n"
+    "conference.aero\n"
+    "consultant.aero\n"
+    "consulting.aero\n"
+    "control.aero\n"
+    "council.aero\n"
+    "crew.aero\n"
+    "design.aero\n"
+    "dgca.aero\n"
+    "educator.aero\n"
+    "emergency.aero\n"
+    "engine.aero\n"
+    "engineer.aero\n"
+    "entertainment.aero\n"
+    "equipment.aero\n"
+    "exchange.aero\n"
+    "express.aero\n"
+    "federation.aero\n"
+    "flight.aero\n"
+    "fuel.aero\n"
+    "gliding.aero\n"
+    "government.aero\n"
+    "groundhandling.aero\n"
+    "group.aero\n"
+    "hanggliding.aero\n"
+    "homebuilt.aero\n"
+    "insurance.aero\n"
+    "journal.aero\n"
+    "journalist.aero\n"
+    "leasing.aero\n"
+    "logistics.aero\n"
+    "magazine.aero\n"
+    "maintenance.aero\n"
+    "media.aero\n"
+    "microlight.aero\n"
+    "modelling.aero\n"
+    "navigation.aero\n"
+    "parachuting.aero\n"
+    "paragliding.aero\n"
+    "passenger-association.aero\n"
+    "pilot.aero\n"
+    "press.aero\n"
+    "production.aero\n"
+    "recreation.aero\n"
+    "repbody.aero\n"
+    "res.aero\n"
+    "research.aero\n"
+    "rotorcraft.aero\n"
+    "safety.aero\n"
+    "scientist.aero\n"
+    "services.aero\n"
+    "show.aero\n"
+    "skydiving.aero\n"
+    "software.aero\n"
+    "student.aero\n"
+    "trader.aero\n"
+    "trading.aero\n"
+    "trainer.aero\n"
+    "union.aero\n"
+    "workinggroup.aero\n"
+    "works.aero\n"
+    "af\n"
+    "gov.af\n"
+    "com.af\n"
+    "org.af\n"
+    "net.af\n"
+    "edu.af\n"
+    "ag\n"
+    "com.ag\n"
+    "org.ag\n"
+    "net.ag\n"
+    "co.ag\n"
+    "nom.ag\n"
+    "ai\n"
+    "off.ai\n"
+    "com.ai\n"
+    "net.ai\n"
+    "org.ai\n"
+    "al\n"
+    "com.al\n"
+    "edu.al\n"
+    "gov.al\n"
+    "mil.al\n"
+    "net.al\n"
+    "org.al\n"
+    "am\n"
+    "co.am\n"
+    "com.am\n"
+    "commune.am\n"
+    "net.am\n"
+    "org.am\n"
+    "ao\n"
+    "ed.ao\n"
+    "gv.ao\n"
+    "og.ao\n"
+    "co.ao\n"
+    "pb.ao\n"
+    "it.ao\n"
+    "aq\n"
+    "ar\n"
+    "bet.ar\n"
+    "com.ar\n"
+    "coop.ar\n"
+    "edu.ar\n"
+    "gob.ar\n"
+    "gov.ar\n"
+    "int.ar\n"
+    "mil.ar\n"
+    "musica.ar\n"
+    "mutual.ar\n"
+    "net.ar\n"
+    "org.ar\n"
+    "senasa.ar\n"
+    "tur.ar\n"
+    "arpa\n"
+    "e164.arpa\n"
+    "in-addr.arpa\n"
+    "ip6.arpa\n"
+    "iris.arpa\n"
+    "uri.arpa\n"
+    "urn.arpa\n"
+    "as\n"
+    "gov.as\n"
+    "asia\n"
+    "at\n"
+    "ac.at\n"
+    "co.at\n"
+    "gv.at\n"
+    "or.at\n"
+    "sth.ac.at\n"
+    "au\n"
+    "com.au\n"
+    "net.au\n"
+    "org.au\n"
+    "edu.au\n"
+    "gov.au\n"
+    "asn.au\n"
+    "id.au\n"
+    "info.au\n"
+    "conf.au\n"
+    "oz.au\n"
+    "act.au\n"
+    "nsw.au\n"
+    "nt.au\n"
+    "qld.au\n"
+    "sa.au\n"
+    "tas.au\n"
+    "vic.au\n"
+    "wa.au\n"
+    "act.edu.au\n"
+    "catholic.edu.au\n"
+    "nsw.edu.au\n"
+    "nt.edu.au\n"
+    "qld.edu.au\n"
+    "sa.edu.au\n"
+    "tas.edu.au\n"
+    "vic.edu.au\n"
+    "wa.edu.au\n"
+    "qld.gov.au\n"
+    "sa.gov.au\n"
+    "tas.gov.au\n"
+    "vic.gov.au\n"
+    "wa.gov.au\n"
+    "schools.nsw.edu.au\n"
+    "aw\n"
+    "com.aw\n"
+    "ax\n"
+    "az\n"
+    "com.az\n"
+    "net.az\n"
+    "int.az\n"
+    "gov.az\n"
+    "org.az\n"
+    "edu.az\n"
+    "info.az\n"
+    "pp.az\n"
+    "mil.az\n"
+    "name.az\n"
+    "pro.az\n"
+    "biz.az\n"
+    "ba\n"
+    "com.ba\n"
+    "edu.ba\n"
+    "gov.ba\n"
+    "mil.ba\n"
+    "net.ba\n"
+    "org.ba\n"
+    "bb\n"
+    "biz.bb\n"
+    "co.bb\n"
+    "com.bb\n"
+    "edu.bb\n"
+    "gov.bb\n"
+    "info.bb\n"
+    "net.bb\n"
+    "org.bb\n"
+    "store.bb\n"
+    "tv.bb\n"
+    "*.bd\n"
+    "be\n"
+    "ac.be\n"
+    "bf\n"
+    "gov.bf\n"
+    "bg\n"
+    "a.bg\n"
+    "b.bg\n"
+    "c.bg\n"
+    "d.bg\n"
+    "e.bg\n"
+    "f.bg\n"
+    "g.bg\n"
+    "h.bg\n"
+    "i.bg\n"
+    "j.bg\n"
+    "k.bg\n"
+    "l.bg\n"
+    "m.bg\n"
+    "n.bg\n"
+    "o.bg\n"
+    "p.bg\n"
+    "q.bg\n"
+    "r.bg\n"
+    "s.bg\n"
+    "t.bg\n"
+    "u.bg\n"
+    "v.bg\n"
+    "w.bg\n"
+    "x.bg\n"
+    "y.bg\n"
+    "z.bg\n"
+    "0.bg\n"
+    "1.bg\n"
+    "2.bg\n"
+    "3.bg\n"
+    "4.bg\n"
+    "5.bg\n"
+    "6.bg\n"
+    "7.bg\n"
+    "8.bg\n"
+    "9.bg\n"
+    "bh\n"
+    "com.bh\n"
+    "edu.bh\n"
+    "net.bh\n"
+    "org.bh\n"
+    "gov.bh\n"
+    "bi\n"
+    "co.bi\n"
+    "com.bi\n"
+    "edu.bi\n"
+    "or.bi\n"
+    "org.bi\n"
+    "biz\n"
+    "bj\n"
+    "africa.bj\n"
+    "agro.bj\n"
+    "architectes.bj\n"
+    "assur.bj\n"
+    "avocats.bj\n"
+    "co.bj\n"
+    "com.bj\n"
+    "eco.bj\n"
+    "econo.bj\n"
+    "edu.bj\n"
+    "info.bj\n"
+    "loisirs.bj\n"
+    "money.bj\n"
+    "net.bj\n"
+    "org.bj\n"
+    "ote.bj\n"
+    "resto.bj\n"
+    "restaurant.bj\n"
+    "tourism.bj\n"
+    "univ.bj\n"
+    "bm\n"
+    "com.bm\n"
+    "edu.bm\n"
+    "gov.bm\n"
+    "net.bm\n"
+    "org.bm\n"
+    "bn\n"
+    "com.bn\n"
+    "edu.bn\n"
+    "gov.bn\n"
+    "net.bn\n"
+    "org.bn\n"
+    "bo\n"
+    "com.bo\n"
+    "edu.bo\n"
+    "gob.bo\n"
+    "int.bo\n"
+    "org.bo\n"
+    "net.bo\n"
+    "mil.bo\n"
+    "tv.bo\n"
+    "web.bo\n"
+    "academia.bo\n"
+    "agro.bo\n"
+    "arte.bo\n"
+    "blog.bo\n"
+    "bolivia.bo\n"
+    "ciencia.bo\n"
+    "cooperativa.bo\n"
+    "democracia.bo\n"
+    "deporte.bo\n"
+    "ecologia.bo\n"
+    "economia.bo\n"
+    "empresa.bo\n"
+    "indigena.bo\n"
+    "industria.bo\n"
+    "info.bo\n"
+    "medicina.bo\n"
+    "movimiento.bo\n"
+    "musica.bo\n"
+    "natural.bo\n"
+    "nombre.bo\n"
+    "noticias.bo\n"
+    "patria.bo\n"
+    "politica.bo\n"
+    "profesional.bo\n"
+    "plurinacional.bo\n"
+    "pueblo.bo\n"
+    "revista.bo\n"
+    "salud.bo\n"
+    "tecnologia.bo\n"
+    "tksat.bo\n"
+    "transporte.bo\n"
+    "wiki.bo\n"
+    "br\n"
+    "9guacu.br\n"
+    "abc.br\n"
+    "adm.br\n"
+    "adv.br\n"
+    "agr.br\n"
+    "aju.br\n"
+    "am.br\n"
+    "anani.br\n"
+    "aparecida.br\n"
+    "app.br\n"
+    "arq.br\n"
+    "art.br\n"
+    "ato.br\n"
+    "b.br\n"
+    "barueri.br\n"
+    "belem.br\n"
+    "bhz.br\n"
+    "bib.br\n"
+    "bio.br\n"
+    "blog.br\n"
+    "bmd.br\n"
+    "boavista.br\n"
+    "bsb.br\n"
+    "campinagrande.br\n"
+    "campinas.br\n"
+    "caxias.br\n"
+    "cim.br\n"
+    "cng.br\n"
+    "cnt.br\n"
+    "com.br\n"
+    "contagem.br\n"
+    "coop.br\n"
+    "coz.br\n"
+    "cri.br\n"
+    "cuiaba.br\n"
+    "curitiba.br\n"
+    "def.br\n"
+    "des.br\n"
+    "det.br\n"
+    "dev.br\n"
+    "ecn.br\n"
+    "eco.br\n"
+    "edu.br\n"
+    "emp.br\n"
+    "enf.br\n"
+    "eng.br\n"
+    "esp.br\n"
+    "etc.br\n"
+    "eti.br\n"
+    "far.br\n"
+    "feira.br\n"
+    "flog.br\n"
+    "floripa.br\n"
+    "fm.br\n"
+    "fnd.br\n"
+    "fortal.br\n"
+    "fot.br\n"
+    "foz.br\n"
+    "fst.br\n"
+    "g12.br\n"
+    "geo.br\n"
+    "ggf.br\n"
+    "goiania.br\n"
+    "gov.br\n"
+    "ac.gov.br\n"
+    "al.gov.br\n"
+    "am.gov.br\n"
+    "ap.gov.br\n"
+    "ba.gov.br\n"
+    "ce.gov.br\n"
+    "df.gov.br\n"
+    "es.gov.br\n"
+    "go.gov.br\n"
+    "ma.gov.br\n"
+    "mg.gov.br\n"
+    "ms.gov.br\n"
+    "mt.gov.br\n"
+    "pa.gov.br\n"
+    "pb.gov.br\n"
+    "pe.gov.br\n"
+    "pi.gov.br\n"
+    "pr.gov.br\n"
+    "rj.gov.br\n"
+    "rn.gov.br\n"
+    "ro.gov.br\n"
+    "rr.gov.br\n"
+    "rs.gov.br\n"
+    "sc.gov.br\n"
+    "se.gov.br\n"
+    "sp.gov.br\n"
+    "to.gov.br\n"
+    "gru.br\n"
+    "imb.br\n"
+    "ind.br\n"
+    "inf.br\n"
+    "jab.br\n"
+    "jampa.br\n"
+    "jdf.br\n"
+    "joinville.br\n"
+    "jor.br\n"
+    "jus.br\n"
+    "leg.br\n"
+    "lel.br\n"
+    "log.br\n"
+    "londrina.br\n"
+    "macapa.br\n"
+    "maceio.br\n"
+    "manaus.br\n"
+    "maringa.br\n"
+    "mat.br\n"
+    "med.br\n"
+    "mil.br\n"
+    "morena.br\n"
+    "mp.br\n"
+    "mus.br\n"
+    "natal.br\n"
+    "net.br\n"
+    "niteroi.br\n"
+    "*.nom.br\n"
+    "not.br\n"
+    "ntr.br\n"
+    "odo.br\n"
+    "ong.br\n"
+    "org.br\n"
+    "osasco.br\n"
+    "palmas.br\n"
+    "poa.br\n"
+    "ppg.br\n"
+    "pro.br\n"
+    "psc.br\n"
+    "psi.br\n"
+    "pvh.br\n"
+    "qsl.br\n"
+    "radio.br\n"
+    "rec.br\n"
+    "recife.br\n"
+    "rep.br\n"
+    "ribeirao.br\n"
+    "rio.br\n"
+    "riobranco.br\n"
+    "riopreto.br\n"
+    "salvador.br\n"
+    "sampa.br\n"
+    "santamaria.br\n"
+    "santoandre.br\n"
+    "saobernardo.br\n"
+    "saogonca.br\n"
+    "seg.br\n"
+    "sjc.br\n"
+    "slg.br\n"
+    "slz.br\n"
+    "sorocaba.br\n"
+    "srv.br\n"
+    "taxi.br\n"
+    "tc.br\n"
+    "tec.br\n"
+    "teo.br\n"
+    "the.br\n"
+    "tmp.br\n"
+    "trd.br\n"
+    "tur.br\n"
+    "tv.br\n"
+    "udi.br\n"
+    "vet.br\n"
+    "vix.br\n"
+    "vlog.br\n"
+    "wiki.br\n"
+    "zlg.br\n"
+    "bs\n"
+    "com.bs\n"
+    "net.bs\n"
+    "org.bs\n"
+    "edu.bs\n"
+    "gov.bs\n"
+    "bt\n"
+    "com.bt\n"
+    "edu.bt\n"
+    "gov.bt\n"
+    "net.bt\n"
+    "org.bt\n"
+    "bv\n"
+    "bw\n"
+    "co.bw\n"
+    "org.bw\n"
+    "by\n"
+    "gov.by\n"
+    "mil.by\n"
+    "com.by\n"
+    "of.by\n"
+    "bz\n"
+    "com.bz\n"
+    "net.bz\n"
+    "org.bz\n"
+    "edu.bz\n"
+    "gov.bz\n"
+    "ca\n"
+    "ab.ca\n"
+    "bc.ca\n"
+    "mb.ca\n"
+    "nb.ca\n"
+    "nf.ca\n"
+    "nl.ca\n"
+    "ns.ca\n"
+    "nt.ca\n"
+    "nu.ca\n"
+    "on.ca\n"
+    "pe.ca\n"
+    "qc.ca\n"
+    "sk.ca\n"
+    "yk.ca\n"
+    "gc.ca\n"
+    "cat\n"
+    "cc\n"
+    "cd\n"
+    "gov.cd\n"
+    "cf\n"
+    "cg\n"
+    "ch\n"
+    "ci\n"
+    "org.ci\n"
+    "or.ci\n"
+    "com.ci\n"
+    "co.ci\n"
+    "edu.ci\n"
+    "ed.ci\n"
+    "ac.ci\n"
+    "net.ci\n"
+    "go.ci\n"
+    "asso.ci\n"
+    "a\xc3\xa9roport.ci\n"
+    "int.ci\n"
+    "presse.ci\n"
+    "md.ci\n"
+    "gouv.ci\n"
+    "*.ck\n"
+    "!www.ck\n"
+    "cl\n"
+    "co.cl\n"
+    "gob.cl\n"
+    "gov.cl\n"
+    "mil.cl\n"
+    "cm\n"
+    "co.cm\n"
+    "com.cm\n"
+    "gov.cm\n"
+    "net.cm\n"
+    "cn\n"
+    "ac.cn\n"
+    "com.cn\n"
+    "edu.cn\n"
+    "gov.cn\n"
+    "net.cn\n"
+    "org.cn\n"
+    "mil.cn\n"
+    "\xe5\x85\xac\xe5\x8f\xb8.cn\n"
+    "\xe7\xbd\x91\xe7\xbb\x9c.cn\n"
+    "\xe7\xb6\xb2\xe7\xb5\xa1.cn\n"
+    "ah.cn\n"
+    "bj.cn\n"
+    "cq.cn\n"
+    "fj.cn\n"
+    "gd.cn\n"
+    "gs.cn\n"
+    "gz.cn\n"
+    "gx.cn\n"
+    "ha.cn\n"
+    "hb.cn\n"
+    "he.cn\n"
+    "hi.cn\n"
+    "hl.cn\n"
+    "hn.cn\n"
+    "jl.cn\n"
+    "js.cn\n"
+    "jx.cn\n"
+    "ln.cn\n"
+    "nm.cn\n"
+    "nx.cn\n"
+    "qh.cn\n"
+    "sc.cn\n"
+    "sd.cn\n"
+    "sh.cn\n"
+    "sn.cn\n"
+    "sx.cn\n"
+    "tj.cn\n"
+    "xj.cn\n"
+    "xz.cn\n"
+    "yn.cn\n"
+    "zj.cn\n"
+    "hk.cn\n"
+    "mo.cn\n"
+    "tw.cn\n"
+    "co\n"
+    "arts.co\n"
+    "com.co\n"
+    "edu.co\n"
+    "firm.co\n"
+    "gov.co\n"
+    "info.co\n"
+    "int.co\n"
+    "mil.co\n"
+    "net.co\n"
+    "nom.co\n"
+    "org.co\n"
+    "rec.co\n"
+    "web.co\n"
+    "com\n"
+    "coop\n"
+    "cr\n"
+    "ac.cr\n"
+    "co.cr\n"
+    "ed.cr\n"
+    "fi.cr\n"
+    "go.cr\n"
+    "or.cr\n"
+    "sa.cr\n"
+    "cu\n"
+    "com.cu\n"
+    "edu.cu\n"
+    "org.cu\n"
+    "net.cu\n"
+    "gov.cu\n"
+    "inf.cu\n"
+    "cv\n"
+    "com.cv\n"
+    "edu.cv\n"
+    "int.cv\n"
+    "nome.cv\n"
+    "org.cv\n"
+    "cw\n"
+    "com.cw\n"
+    "edu.cw\n"
+    "net.cw\n"
+    "org.cw\n"
+    "cx\n"
+    "gov.cx\n"
+    "cy\n"
+    "ac.cy\n"
+    "biz.cy\n"
+    "com.cy\n"
+    "ekloges.cy\n"
+    "gov.cy\n"
+    "ltd.cy\n"
+    "mil.cy\n"
+    "net.cy\n"
+    "org.cy\n"
+    "press.cy\n"
+    "pro.cy\n"
+    "tm.cy\n"
+    "cz\n"
+    "de\n"
+    "dj\n"
+    "dk\n"
+    "dm\n"
+    "com.dm\n"
+    "net.dm\n"
+    "org.dm\n"
+    "edu.dm\n"
+    "gov.dm\n"
+    "do\n"
+    "art.do\n"
+    "com.do\n"
+    "edu.do\n"
+    "gob.do\n"
+    "gov.do\n"
+    "mil.do\n"
+    "net.do\n"
+    "org.do\n"
+    "sld.do\n"
+    "web.do\n"
+    "dz\n"
+    "art.dz\n"
+    "asso.dz\n"
+    "com.dz\n"
+    "edu.dz\n"
+    "gov.dz\n"
+    "org.dz\n"
+    "net.dz\n"
+    "pol.dz\n"
+    "soc.dz\n"
+    "tm.dz\n"
+    "ec\n"
+    "com.ec\n"
+    "info.ec\n"
+    "net.ec\n"
+    "fin.ec\n"
+    "k12.ec\n"
+    "med.ec\n"
+    "pro.ec\n"
+    "org.ec\n"
+    "edu.ec\n"
+    "gov.ec\n"
+    "gob.ec\n"
+    "mil.ec\n"
+    "edu\n"
+    "ee\n"
+    "edu.ee\n"
+    "gov.ee\n"
+    "riik.ee\n"
+    "lib.ee\n"
+    "med.ee\n"
+    "com.ee\n"
+    "pri.ee\n"
+    "aip.ee\n"
+    "org.ee\n"
+    "fie.ee\n"
+    "eg\n"
+    "com.eg\n"
+    "edu.eg\n"
+    "eun.eg\n"
+    "gov.eg\n"
+    "mil.eg\n"
+    "name.eg\n"
+    "net.eg\n"
+    "org.eg\n"
+    "sci.eg\n"
+    "*.er\n"
+    "es\n"
+    "com.es\n"
+    "nom.es\n"
+    "org.es\n"
+    "gob.es\n"
+    "edu.es\n"
+    "et\n"
+    "com.et\n"
+    "gov.et\n"
+    "org.et\n"
+    "edu.et\n"
+    "biz.et\n"
+    "name.et\n"
+    "info.et\n"
+    "net.et\n"
+    "eu\n"
+    "fi\n"
+    "aland.fi\n"
+    "fj\n"
+    "ac.fj\n"
+    "biz.fj\n"
+    "com.fj\n"
+    "gov.fj\n"
+    "info.fj\n"
+    "mil.fj\n"
+    "name.fj\n"
+    "net.fj\n"
+    "org.fj\n"
+    "pro.fj\n"
+    "*.fk\n"
+    "com.fm\n"
+    "edu.fm\n"
+    "net.fm\n"
+    "org.fm\n"
+    "fm\n"
+    "fo\n"
+    "fr\n"
+    "asso.fr\n"
+    "com.fr\n"
+    "gouv.fr\n"
+    "nom.fr\n"
+    "prd.fr\n"
+    "tm.fr\n"
+    "aeroport.fr\n"
+    "avocat.fr\n"
+    "avoues.fr\n"
+    "cci.fr\n"
+    "chambagri.fr\n"
+    "chirurgiens-dentistes.fr\n"
+    "experts-comptables.fr\n"
+    "geometre-expert.fr\n"
+    "greta.fr\n"
+    "huissier-justice.fr\n"
+    "medecin.fr\n"
+    "notaires.fr\n"
+    "pharmacien.fr\n"
+    "port.fr\n"
+    "veterinaire.fr\n"
+    "ga\n"
+    "gb\n"
+    "edu.gd\n"
+    "gov.gd\n"
+    "gd\n"
+    "ge\n"
+    "com.ge\n"
+    "edu.ge\n"
+    "gov.ge\n"
+    "org.ge\n"
+    "mil.ge\n"
+    "net.ge\n"
+    "pvt.ge\n"
+    "gf\n"
+    "gg\n"
+    "co.gg\n"
+    "net.gg\n"
+    "org.gg\n"
+    "gh\n"
+    "com.gh\n"
+    "edu.gh\n"
+    "gov.gh\n"
+    "org.gh\n"
+    "mil.gh\n"
+    "gi\n"
+    "com.gi\n"
+    "ltd.gi\n"
+    "gov.gi\n"
+    "mod.gi\n"
+    "edu.gi\n"
+    "org.gi\n"
+    "gl\n"
+    "co.gl\n"
+    "com.gl\n"
+    "edu.gl\n"
+    "net.gl\n"
+    "org.gl\n"
+    "gm\n"
+    "gn\n"
+    "ac.gn\n"
+    "com.gn\n"
+    "edu.gn\n"
+    "gov.gn\n"
+    "org.gn\n"
+    "net.gn\n"
+    "gov\n"
+    "gp\n"
+    "com.gp\n"
+    "net.gp\n"
+    "mobi.gp\n"
+    "edu.gp\n"
+    "org.gp\n"
+    "asso.gp\n"
+    "gq\n"
+    "gr\n"
+    "com.gr\n"
+    "edu.gr\n"
+    "net.gr\n"
+    "org.gr\n"
+    "gov.gr\n"
+    "gs\n"
+    "gt\n"
+    "com.gt\n"
+    "edu.gt\n"
+    "gob.gt\n"
+    "ind.gt\n"
+    "mil.gt\n"
+    "net.gt\n"
+    "org.gt\n"
+    "gu\n"
+    "com.gu\n"
+    "edu.gu\n"
+    "gov.gu\n"
+    "guam.gu\n"
+    "info.gu\n"
+    "net.gu\n"
+    "org.gu\n"
+    "web.gu\n"
+    "gw\n"
+    "gy\n"
+    "co.gy\n"
+    "com.gy\n"
+    "edu.gy\n"
+    "gov.gy\n"
+    "net.gy\n"
+    "org.gy\n"
+    "hk\n"
+    "com.hk\n"
+    "edu.hk\n"
+    "gov.hk\n"
+    "idv.hk\n"
+    "net.hk\n"
+    "org.hk\n"
+    "\xe5\x85\xac\xe5\x8f\xb8.hk\n"
+    "\xe6\x95\x99\xe8\x82\xb2.hk\n"
+    "\xe6\x95\x8e\xe8\x82\xb2.hk\n"
+    "\xe6\x94\xbf\xe5\xba\x9c.hk\n"
+    "\xe5\x80\x8b\xe4\xba\xba.hk\n"
+    "\xe4\xb8\xaa\xe4\xba\xba.hk\n"
+    "\xe7\xae\x87\xe4\xba\xba.hk\n"
+    "\xe7\xb6\xb2\xe7\xbb\x9c.hk\n"
+    "\xe7\xbd\x91\xe7\xbb\x9c.hk\n"
+    "\xe7\xbb\x84\xe7\xb9\x94.hk\n"
+    "\xe7\xb6\xb2\xe7\xb5\xa1.hk\n"
+    "\xe7\xbd\x91\xe7\xb5\xa1.hk\n"
+    "\xe7\xbb\x84\xe7\xbb\x87.hk\n"
+    "\xe7\xb5\x84\xe7\xb9\x94.hk\n"
+    "\xe7\xb5\x84\xe7\xbb\x87.hk\n"
+    "hm\n"
+    "hn\n"
+    "com.hn\n"
+    "edu.hn\n"
+    "org.hn\n"
+    "net.hn\n"
+    "mil.hn\n"
+    "gob.hn\n"
+    "hr\n"
+    "iz.hr\n"
+    "from.hr\n"
+    "name.hr\n"
+    "com.hr\n"
+    "ht\n"
+    "com.ht\n"
+    "shop.ht\n"
+    "firm.ht\n"
+    "info.ht\n"
+    "adult.ht\n"
+    "net.ht\n"
+    "pro.ht\n"
+    "org.ht\n"
+    "med.ht\n"
+    "art.ht\n"
+    "coop.ht\n"
+    "pol.ht\n"
+    "asso.ht\n"
+    "edu.ht\n"
+    "rel.ht\n"
+    "gouv.ht\n"
+    "perso.ht\n"
+    "hu\n"
+    "co.hu\n"
+    "info.hu\n"
+    "org.hu\n"
+    "priv.hu\n"
+    "sport.hu\n"
+    "tm.hu\n"
+    "2000.hu\n"
+    "agrar.hu\n"
+    "bolt.hu\n"
+    "casino.hu\n"
+    "city.hu\n"
+    "erotica.hu\n"
+    "erotika.hu\n"
+    "film.hu\n"
+    "forum.hu\n"
+    "games.hu\n"
+    "hotel.hu\n"
+    "ingatlan.hu\n"
+    "jogasz.hu\n"
+    "konyvelo.hu\n"
+    "lakas.hu\n"
+    "media.hu\n"
+    "news.hu\n"
+    "reklam.hu\n"
+    "sex.hu\n"
+    "shop.hu\n"
+    "suli.hu\n"
+    "szex.hu\n"
+    "tozsde.hu\n"
+    "utazas.hu\n"
+    "video.hu\n"
+    "id\n"
+    "ac.id\n"
+    "biz.id\n"
+    "co.id\n"
+    "desa.id\n"
+    "go.id\n"
+    "mil.id\n"
+    "my.id\n"
+    "net.id\n"
+    "or.id\n"
+    "ponpes.id\n"
+    "sch.id\n"
+    "web.id\n"
+    "ie\n"
+    "gov.ie\n"
+    "il\n"
+    "ac.il\n"
+    "co.il\n"
+    "gov.il\n"
+    "idf.il\n"
+    "k12.il\n"
+    "muni.il\n"
+    "net.il\n"
+    "org.il\n"
+    "\xd7\x99\xd7\xa9\xd7\xa8\xd7\x90\xd7\x9c\n"
+    "\xd7\x90\xd7\xa7\xd7\x93\xd7\x9e\xd7\x99\xd7\x94.\xd7\x99\xd7\xa9\xd7\xa8\xd7\x90\xd7\x9c\n"
+    "\xd7\x99\xd7\xa9\xd7\x95\xd7\x91.\xd7\x99\xd7\xa9\xd7\xa8\xd7\x90\xd7\x9c\n"
+    "\xd7\xa6\xd7\x94\xd7\x9c.\xd7\x99\xd7\xa9\xd7\xa8\xd7\x90\xd7\x9c\n"
+    "\xd7\x9e\xd7\x9e\xd7\xa9\xd7\x9c.\xd7\x99\xd7\xa9\xd7\xa8\xd7\x90\xd7\x9c\n"
+    "im\n"
+    "ac.im\n"
+    "co.im\n"
+    "com.im\n"
+    "ltd.co.im\n"
+    "net.im\n"
+    "org.im\n"
+    "plc.co.im\n"
+    "tt.im\n"
+    "tv.im\n"
+    "in\n"
+    "5g.in\n"
+    "6g.in\n"
+    "ac.in\n"
+    "ai.in\n"
+    "am.in\n"
+    "bihar.in\n"
+    "biz.in\n"
+    "business.in\n"
+    "ca.in\n"
+    "cn.in\n"
+    "co.in\n"
+    "com.in\n"
+    "coop.in\n"
+    "cs.in\n"
+    "delhi.in\n"
+    "dr.in\n"
+    "edu.in\n"
+    "er.in\n"
+    "firm.in\n"
+    "gen.in\n"
+    "gov.in\n"
+    "gujarat.in\n"
+    "ind.in\n"
+    "info.in\n"
+    "int.in\n"
+    "internet.in\n"
+    "io.in\n"
+    "me.in\n"
+    "mil.in\n"
+    "net.in\n"
+    "nic.in\n"
+    "org.in\n"
+    "pg.in\n"
+    "post.in\n"
+    "pro.in\n"
+    "res.in\n"
+    "travel.in\n"
+    "tv.in\n"
+    "uk.in\n"
+    "up.in\n"
+    "us.in\n"
+    "info\n"
+    "int\n"
+    "eu.int\n"
+    "io\n"
+    "com.io\n"
+    "iq\n"
+    "gov.iq\n"
+    "edu.iq\n"
+    "mil.iq\n"
+    "com.iq\n"
+    "org.iq\n"
+    "net.iq\n"
+    "ir\n"
+    "ac.ir\n"
+    "co.ir\n"
+    "gov.ir\n"
+    "id.ir\n"
+    "net.ir\n"
+    "org.ir\n"
+    "sch.ir\n"
+    "\xd8\xa7\xdb\x8c\xd8\xb1\xd8\xa7\xd9\x86.ir\n"
+    "\xd8\xa7\xd9\x8a\xd8\xb1\xd8\xa7\xd9\x86.ir\n"
+    "is\n"
+    "net.is\n"
+    "com.is\n"
+    "edu.is\n"
+    "gov.is\n"
+    "org.is\n"
+    "int.is\n"
+    "it\n"
+    "gov.it\n"
+    "edu.it\n"
+    "abr.it\n"
+    "abruzzo.it\n"
+    "aosta-valley.it\n"
+    "aostavalley.it\n"
+    "bas.it\n"
+    "basilicata.it\n"
+    "cal.it\n"
+    "calabria.it\n"
+    "cam.it\n"
+    "campania.it\n"
+    "emilia-romagna.it\n"
+    "emiliaromagna.it\n"
+    "emr.it\n"
+    "friuli-v-giulia.it\n"
+    "friuli-ve-giulia.it\n"
+    "friuli-vegiulia.it\n"
+    "friuli-venezia-giulia.it\n"
+    "friuli-veneziagiulia.it\n"
+    "friuli-vgiulia.it\n"
+    "friuliv-giulia.it\n"
+    "friulive-giulia.it\n"
+    "friulivegiulia.it\n"
+    "friulivenezia-giulia.it\n"
+    "friuliveneziagiulia.it\n"
+    "friulivgiulia.it\n"
+    "fvg.it\n"
+    "laz.it\n"
+    "lazio.it\n"
+    "lig.it\n"
+    "liguria.it\n"
+    "lom.it\n"
+    "lombardia.it\n"
+    "lombardy.it\n"
+    "lucania.it\n"
+    "mar.it\n"
+    "marche.it\n"
+    "mol.it\n"
+    "molise.it\n"
+    "piedmont.it\n"
+    "piemonte.it\n"
+    "pmn.it\n"
+    "pug.it\n"
+    "puglia.it\n"
+    "sar.it\n"
+    "sardegna.it\n"
+    "sardinia.it\n"
+    "sic.it\n"
+    "sicilia.it\n"
+    "sicily.it\n"
+    "taa.it\n"
+    "tos.it\n"
+    "toscana.it\n"
+    "trentin-sud-tirol.it\n"
+    "trentin-s\xc3\xbc" "d-tirol.it\n"
+    "trentin-sudtirol.it\n"
+    "trentin-s\xc3\xbc" "dtirol.it\n"
+    "trentin-sued-tirol.it\n"
+    "trentin-suedtirol.it\n"
+    "trentino-a-adige.it\n"
+    "trentino-aadige.it\n"
+    "trentino-alto-adige.it\n"
+    "trentino-altoadige.it\n"
+    "trentino-s-tirol.it\n"
+    "trentino-stirol.it\n"
+    "trentino-sud-tirol.it\n"
+    "trentino-s\xc3\xbc" "d-tirol.it\n"
+    "trentino-sudtirol.it\n"
+    "trentino-s\xc3\xbc" "dtirol.it\n"
+    "trentino-sued-tirol.it\n"
+    "trentino-suedtirol.it\n"
+    "trentino.it\n"
+    "trentinoa-adige.it\n"
+    "trentinoaadige.it\n"
+    "trentinoalto-adige.it\n"
+    "trentinoaltoadige.it\n"
+    "trentinos-tirol.it\n"
+    "trentinostirol.it\n"
+    "trentinosud-tirol.it\n"
+    "trentinos\xc3\xbc" "d-tirol.it\n"
+    "trentinosudtirol.it\n"
+    "trentinos\xc3\xbc" "dtirol.it\n"
+    "trentinosued-tirol.it\n"
+    "trentinosuedtirol.it\n"
+    "trentinsud-tirol.it\n"
+    "trentins\xc3\xbc" "d-tirol.it\n"
+    "trentinsudtirol.it\n"
+    "trentins\xc3\xbc" "dtirol.it\n"
+    "trentinsued-tirol.it\n"
+    "trentinsuedtirol.it\n"
+    "tuscany.it\n"
+    "umb.it\n"
+    "umbria.it\n"
+    "val-d-aosta.it\n"
+    "val-daosta.it\n"
+    "vald-aosta.it\n"
+    "valdaosta.it\n"
+    "valle-aosta.it\n"
+    "valle-d-aosta.it\n"
+    "valle-daosta.it\n"
+    "valleaosta.it\n"
+    "valled-aosta.it\n"
+    "valledaosta.it\n"
+    "vallee-aoste.it\n"
+    "vall\xc3\xa9" "e-aoste.it\n"
+    "vallee-d-aoste.it\n"
+    "vall\xc3\xa9" "e-d-aoste.it\n"
+    "valleeaoste.it\n"
+    "vall\xc3\xa9" "eaoste.it\n"
+    "valleedaoste.it\n"
+    "vall\xc3\xa9" "edaoste.it\n"
+    "vao.it\n"
+    "vda.it\n"
+    "ven.it\n"
+    "veneto.it\n"
+    "ag.it\n"
+    "agrigento.it\n"
+    "al.it\n"
+    "alessandria.it\n"
+    "alto-adige.it\n"
+    "altoadige.it\n"
+    "an.it\n"
+    "ancona.it\n"
+    "andria-barletta-trani.it\n"
+    "andria-trani-barletta.it\n"
+    "andriabarlettatrani.it\n"
+    "andriatranibarletta.it\n"
+    "ao.it\n"
+    "aosta.it\n"
+    "aoste.it\n"
+    "ap.it\n"
+    "aq.it\n"
+    "aquila.it\n"
+    "ar.it\n"
+    "arezzo.it\n"
+    "ascoli-piceno.it\n"
+    "ascolipiceno.it\n"
+    "asti.it\n"
+    "at.it\n"
+    "av.it\n"
+    "avellino.it\n"
+    "ba.it\n"
+    "balsan-sudtirol.it\n"
+    "balsan-s\xc3\xbc" "dtirol.it\n"
+    "balsan-suedtirol.it\n"
+    "balsan.it\n"
+    "bari.it\n"
+    "barletta-trani-andria.it\n"
+    "barlettatraniandria.it\n"
+    "belluno.it\n"
+    "benevento.it\n"
+    "bergamo.it\n"
+    "bg.it\n"
+    "bi.it\n"
+    "biella.it\n"
+    "bl.it\n"
+    "bn.it\n"
+    "bo.it\n"
+    "bologna.it\n"
+    "bolzano-altoadige.it\n"
+    "bolzano.it\n"
+    "bozen-sudtirol.it\n"
+    "bozen-s\xc3\xbc" "dtirol.it\n"
+    "bozen-suedtirol.it\n"
+    "bozen.it\n"
+    "br.it\n"
+    "brescia.it\n"
+    "brindisi.it\n"
+    "bs.it\n"
+    "bt.it\n"
+    "bulsan-sudtirol.it\n"
+    "bulsan-s\xc3\xbc" "dtirol.it\n"
+    "bulsan-suedtirol.it\n"
+    "bulsan.it\n"
+    "bz.it\n"
+    "ca.it\n"
+    "cagliari.it\n"
+    "caltanissetta.it\n"
+    "campidano-medio.it\n"
+    "campidanomedio.it\n"
+    "campobasso.it\n"
+    "carbonia-iglesias.it\n"
+    "carboniaiglesias.it\n"
+    "carrara-massa.it\n"
+    "carraramassa.it\n"
+    "caserta.it\n"
+    "catania.it\n"
+    "catanzaro.it\n"
+    "cb.it\n"
+    "ce.it\n"
+    "cesena-forli.it\n"
+    "cesena-forl\xc3\xac.it\n"
+    "cesenaforli.it\n"
+    "cesenaforl\xc3\xac.it\n"
+    "ch.it\n"
+    "chieti.it\n"
+    "ci.it\n"
+    "cl.it\n"
+    "cn.it\n"
+    "co.it\n"
+    "como.it\n"
+    "cosenza.it\n"
+    "cr.it\n"
+    "cremona.it\n"
+    "crotone.it\n"
+    "cs.it\n"
+    "ct.it\n"
+    "cuneo.it\n"
+    "cz.it\n"
+    "dell-ogliastra.it\n"
+    "dellogliastra.it\n"
+    "en.it\n"
+    "enna.it\n"
+    "fc.it\n"
+    "fe.it\n"
+    "fermo.it\n"
+    "ferrara.it\n"
+    "fg.it\n"
+    "fi.it\n"
+    "firenze.it\n"
+    "florence.it\n"
+    "fm.it\n"
+    "foggia.it\n"
+    "forli-cesena.it\n"
+    "forl\xc3\xac-cesena.it\n"
+    "forlicesena.it\n"
+    "forl\xc3\xac" "cesena.it\n"
+    "fr.it\n"
+    "frosinone.it\n"
+    "ge.it\n"
+    "genoa.it\n"
+    "genova.it\n"
+    "go.it\n"
+    "gorizia.it\n"
+    "gr.it\n"
+    "grosseto.it\n"
+    "iglesias-carbonia.it\n",
+
+    "iglesiascarbonia.it\n"
+    "im.it\n"
+    "imperia.it\n"
+    "is.it\n"
+    "isernia.it\n"
+    "kr.it\n"
+    "la-spezia.it\n"
+    "laquila.it\n"
+    "laspezia.it\n"
+    "latina.it\n"
+    "lc.it\n"
+    "le.it\n"
+    "lecce.it\n"
+    "lecco.it\n"
+    "li.it\n"
+    "livorno.it\n"
+    "lo.it\n"
+    "lodi.it\n"
+    "lt.it\n"
+    "lu.it\n"
+    "lucca.it\n"
+    "macerata.it\n"
+    "mantova.it\n"
+    "massa-carrara.it\n"
+    "massacarrara.it\n"
+    "matera.it\n"
+    "mb.it\n"
+    "mc.it\n"
+    "me.it\n"
+    "medio-campidano.it\n"
+    "mediocampidano.it\n"
+    "messina.it\n"
+    "mi.it\n"
+    "milan.it\n"
+    "milano.it\n"
+    "mn.it\n"
+    "mo.it\n"
+    "modena.it\n"
+    "monza-brianza.it\n"
+    "monza-e-della-brianza.it\n"
+    "monza.it\n"
+    "monzabrianza.it\n"
+    "monzaebrianza.it\n"
+    "monzaedellabrianza.it\n"
+    "ms.it\n"
+    "mt.it\n"
+    "na.it\n"
+    "naples.it\n"
+    "napoli.it\n"
+    "no.it\n"
+    "novara.it\n"
+    "nu.it\n"
+    "nuoro.it\n"
+    "og.it\n"
+    "ogliastra.it\n"
+    "olbia-tempio.it\n"
+    "olbiatempio.it\n"
+    "or.it\n"
+    "oristano.it\n"
+    "ot.it\n"
+    "pa.it\n"
+    "padova.it\n"
+    "padua.it\n"
+    "palermo.it\n"
+    "parma.it\n"
+    "pavia.it\n"
+    "pc.it\n"
+    "pd.it\n"
+    "pe.it\n"
+    "perugia.it\n"
+    "pesaro-urbino.it\n"
+    "pesarourbino.it\n"
+    "pescara.it\n"
+    "pg.it\n"
+    "pi.it\n"
+    "piacenza.it\n"
+    "pisa.it\n"
+    "pistoia.it\n"
+    "pn.it\n"
+    "po.it\n"
+    "pordenone.it\n"
+    "potenza.it\n"
+    "pr.it\n"
+    "prato.it\n"
+    "pt.it\n"
+    "pu.it\n"
+    "pv.it\n"
+    "pz.it\n"
+    "ra.it\n"
+    "ragusa.it\n"
+    "ravenna.it\n"
+    "rc.it\n"
+    "re.it\n"
+    "reggio-calabria.it\n"
+    "reggio-emilia.it\n"
+    "reggiocalabria.it\n"
+    "reggioemilia.it\n"
+    "rg.it\n"
+    "ri.it\n"
+    "rieti.it\n"
+    "rimini.it\n"
+    "rm.it\n"
+    "rn.it\n"
+    "ro.it\n"
+    "roma.it\n"
+    "rome.it\n"
+    "rovigo.it\n"
+    "sa.it\n"
+    "salerno.it\n"
+    "sassari.it\n"
+    "savona.it\n"
+    "si.it\n"
+    "siena.it\n"
+    "siracusa.it\n"
+    "so.it\n"
+    "sondrio.it\n"
+    "sp.it\n"
+    "sr.it\n"
+    "ss.it\n"
+    "suedtirol.it\n"
+    "s\xc3\xbc" "dtirol.it\n"
+    "sv.it\n"
+    "ta.it\n"
+    "taranto.it\n"
+    "te.it\n"
+    "tempio-olbia.it\n"
+    "tempioolbia.it\n"
+    "teramo.it\n"
+    "terni.it\n"
+    "tn.it\n"
+    "to.it\n"
+    "torino.it\n"
+    "tp.it\n"
+    "tr.it\n"
+    "trani-andria-barletta.it\n"
+    "trani-barletta-andria.it\n"
+    "traniandriabarletta.it\n"
+    "tranibarlettaandria.it\n"
+    "trapani.it\n"
+    "trento.it\n"
+    "treviso.it\n"
+    "trieste.it\n"
+    "ts.it\n"
+    "turin.it\n"
+    "tv.it\n"
+    "ud.it\n"
+    "udine.it\n"
+    "urbino-pesaro.it\n"
+    "urbinopesaro.it\n"
+    "va.it\n"
+    "varese.it\n"
+    "vb.it\n"
+    "vc.it\n"
+    "ve.it\n"
+    "venezia.it\n"
+    "venice.it\n"
+    "verbania.it\n"
+    "vercelli.it\n"
+    "verona.it\n"
+    "vi.it\n"
+    "vibo-valentia.it\n"
+    "vibovalentia.it\n"
+    "vicenza.it\n"
+    "viterbo.it\n"
+    "vr.it\n"
+    "vs.it\n"
+    "vt.it\n"
+    "vv.it\n"
+    "je\n"
+    "co.je\n"
+    "net.je\n"
+    "org.je\n"
+    "*.jm\n"
+    "jo\n"
+    "com.jo\n"
+    "org.jo\n"
+    "net.jo\n"
+    "edu.jo\n"
+    "sch.jo\n"
+    "gov.jo\n"
+    "mil.jo\n"
+    "name.jo\n"
+    "jobs\n"
+    "jp\n"
+    "ac.jp\n"
+    "ad.jp\n"
+    "co.jp\n"
+    "ed.jp\n"
+    "go.jp\n"
+    "gr.jp\n"
+    "lg.jp\n"
+    "ne.jp\n"
+    "or.jp\n"
+    "aichi.jp\n"
+    "akita.jp\n"
+    "aomori.jp\n"
+    "chiba.jp\n"
+    "ehime.jp\n"
+    "fukui.jp\n"
+    "fukuoka.jp\n"
+    "fukushima.jp\n"
+    "gifu.jp\n"
+    "gunma.jp\n"
+    "hiroshima.jp\n"
+    "hokkaido.jp\n"
+    "hyogo.jp\n"
+    "ibaraki.jp\n"
+    "ishikawa.jp\n"
+    "iwate.jp\n"
+    "kagawa.jp\n"
+    "kagoshima.jp\n"
+    "kanagawa.jp\n"
+    "kochi.jp\n"
+    "kumamoto.jp\n"
+    "kyoto.jp\n"
+    "mie.jp\n"
+    "miyagi.jp\n"
+    "miyazaki.jp\n"
+    "nagano.jp\n"
+    "nagasaki.jp\n"
+    "nara.jp\n"
+    "niigata.jp\n"
+    "oita.jp\n"
+    "okayama.jp\n"
+    "okinawa.jp\n"
+    "osaka.jp\n"
+    "saga.jp\n"
+    "saitama.jp\n"
+    "shiga.jp\n"
+    "shimane.jp\n"
+    "shizuoka.jp\n"
+    "tochigi.jp\n"
+    "tokushima.jp\n"
+    "tokyo.jp\n"
+    "tottori.jp\n"
+    "toyama.jp\n"
+    "wakayama.jp\n"
+    "yamagata.jp\n"
+    "yamaguchi.jp\n"
+    "yamanashi.jp\n"
+    "\xe6\xa0\x83\xe6\x9c\xa8.jp\n"
+    "\xe6\x84\x9b\xe7\x9f\xa5.jp\n"
+    "\xe6\x84\x9b\xe5\xaa\x9b.jp\n"
+    "\xe5\x85\xb5\xe5\xba\xab.jp\n"
+    "\xe7\x86\x8a\xe6\x9c\xac.jp\n"
+    "\xe8\x8c\xa8\xe5\x9f\x8e.jp\n"
+    "\xe5\x8c\x97\xe6\xb5\xb7\xe9\x81\x93.jp\n"
+    "\xe5\x8d\x83\xe8\x91\x89.jp\n"
+    "\xe5\x92\x8c\xe6\xad\x8c\xe5\xb1\xb1.jp\n"
+    "\xe9\x95\xb7\xe5\xb4\x8e.jp\n"
+    "\xe9\x95\xb7\xe9\x87\x8e.jp\n"
+    "\xe6\x96\xb0\xe6\xbd\x9f.jp\n"
+    "\xe9\x9d\x92\xe6\xa3\xae.jp\n"
+    "\xe9\x9d\x99\xe5\xb2\xa1.jp\n"
+    "\xe6\x9d\xb1\xe4\xba\xac.jp\n"
+    "\xe7\x9f\xb3\xe5\xb7\x9d.jp\n"
+    "\xe5\x9f\xbc\xe7\x8e\x89.jp\n"
+    "\xe4\xb8\x89\xe9\x87\x8d.jp\n"
+    "\xe4\xba\xac\xe9\x83\xbd.jp\n"
+    "\xe4\xbd\x90\xe8\xb3\x80.jp\n"
+    "\xe5\xa4\xa7\xe5\x88\x86.jp\n"
+    "\xe5\xa4\xa7\xe9\x98\xaa.jp\n"
+    "\xe5\xa5\x88\xe8\x89\xaf.jp\n"
+    "\xe5\xae\xae\xe5\x9f\x8e.jp\n"
+    "\xe5\xae\xae\xe5\xb4\x8e.jp\n"
+    "\xe5\xaf\x8c\xe5\xb1\xb1.jp\n"
+    "\xe5\xb1\xb1\xe5\x8f\xa3.jp\n"
+    "\xe5\xb1\xb1\xe5\xbd\xa2.jp\n"
+    "\xe5\xb1\xb1\xe6\xa2\xa8.jp\n"
+    "\xe5\xb2\xa9\xe6\x89\x8b.jp\n"
+    "\xe5\xb2\x90\xe9\x98\x9c.jp\n"
+    "\xe5\xb2\xa1\xe5\xb1\xb1.jp\n"
+    "\xe5\xb3\xb6\xe6\xa0\xb9.jp\n"
+    "\xe5\xba\x83\xe5\xb3\xb6.jp\n"
+    "\xe5\xbe\xb3\xe5\xb3\xb6.jp\n"
+    "\xe6\xb2\x96\xe7\xb8\x84.jp\n"
+    "\xe6\xbb\x8b\xe8\xb3\x80.jp\n"
+    "\xe7\xa5\x9e\xe5\xa5\x88\xe5\xb7\x9d.jp\n"
+    "\xe7\xa6\x8f\xe4\xba\x95.jp\n"
+    "\xe7\xa6\x8f\xe5\xb2\xa1.jp\n"
+    "\xe7\xa6\x8f\xe5\xb3\xb6.jp\n"
+    "\xe7\xa7\x8b\xe7\x94\xb0.jp\n"
+    "\xe7\xbe\xa4\xe9\xa6\xac.jp\n"
+    "\xe9\xa6\x99\xe5\xb7\x9d.jp\n"
+    "\xe9\xab\x98\xe7\x9f\xa5.jp\n"
+    "\xe9\xb3\xa5\xe5\x8f\x96.jp\n"
+    "\xe9\xb9\xbf\xe5\x85\x90\xe5\xb3\xb6.jp\n"
+    "*.kawasaki.jp\n"
+    "*.kitakyushu.jp\n"
+    "*.kobe.jp\n"
+    "*.nagoya.jp\n"
+    "*.sapporo.jp\n"
+    "*.sendai.jp\n"
+    "*.yokohama.jp\n"
+    "!city.kawasaki.jp\n"
+    "!city.kitakyushu.jp\n"
+    "!city.kobe.jp\n"
+    "!city.nagoya.jp\n"
+    "!city.sapporo.jp\n"
+    "!city.sendai.jp\n"
+    "!city.yokohama.jp\n"
+    "aisai.aichi.jp\n"
+    "ama.aichi.jp\n"
+    "anjo.aichi.jp\n"
+    "asuke.aichi.jp\n"
+    "chiryu.aichi.jp\n"
+    "chita.aichi.jp\n"
+    "fuso.aichi.jp\n"
+    "gamagori.aichi.jp\n"
+    "handa.aichi.jp\n"
+    "hazu.aichi.jp\n"
+    "hekinan.aichi.jp\n"
+    "higashiura.aichi.jp\n"
+    "ichinomiya.aichi.jp\n"
+    "inazawa.aichi.jp\n"
+    "inuyama.aichi.jp\n"
+    "isshiki.aichi.jp\n"
+    "iwakura.aichi.jp\n"
+    "kanie.aichi.jp\n"
+    "kariya.aichi.jp\n"
+    "kasugai.aichi.jp\n"
+    "kira.aichi.jp\n"
+    "kiyosu.aichi.jp\n"
+    "komaki.aichi.jp\n"
+    "konan.aichi.jp\n"
+    "kota.aichi.jp\n"
+    "mihama.aichi.jp\n"
+    "miyoshi.aichi.jp\n"
+    "nishio.aichi.jp\n"
+    "nisshin.aichi.jp\n"
+    "obu.aichi.jp\n"
+    "oguchi.aichi.jp\n"
+    "oharu.aichi.jp\n"
+    "okazaki.aichi.jp\n"
+    "owariasahi.aichi.jp\n"
+    "seto.aichi.jp\n"
+    "shikatsu.aichi.jp\n"
+    "shinshiro.aichi.jp\n"
+    "shitara.aichi.jp\n"
+    "tahara.aichi.jp\n"
+    "takahama.aichi.jp\n"
+    "tobishima.aichi.jp\n"
+    "toei.aichi.jp\n"
+    "togo.aichi.jp\n"
+    "tokai.aichi.jp\n"
+    "tokoname.aichi.jp\n"
+    "toyoake.aichi.jp\n"
+    "toyohashi.aichi.jp\n"
+    "toyokawa.aichi.jp\n"
+    "toyone.aichi.jp\n"
+    "toyota.aichi.jp\n"
+    "tsushima.aichi.jp\n"
+    "yatomi.aichi.jp\n"
+    "akita.akita.jp\n"
+    "daisen.akita.jp\n"
+    "fujisato.akita.jp\n"
+    "gojome.akita.jp\n"
+    "hachirogata.akita.jp\n"
+    "happou.akita.jp\n"
+    "higashinaruse.akita.jp\n"
+    "honjo.akita.jp\n"
+    "honjyo.akita.jp\n"
+    "ikawa.akita.jp\n"
+    "kamikoani.akita.jp\n"
+    "kamioka.akita.jp\n"
+    "katagami.akita.jp\n"
+    "kazuno.akita.jp\n"
+    "kitaakita.akita.jp\n"
+    "kosaka.akita.jp\n"
+    "kyowa.akita.jp\n"
+    "misato.akita.jp\n"
+    "mitane.akita.jp\n"
+    "moriyoshi.akita.jp\n"
+    "nikaho.akita.jp\n"
+    "noshiro.akita.jp\n"
+    "odate.akita.jp\n"
+    "oga.akita.jp\n"
+    "ogata.akita.jp\n"
+    "semboku.akita.jp\n"
+    "yokote.akita.jp\n"
+    "yurihonjo.akita.jp\n"
+    "aomori.aomori.jp\n"
+    "gonohe.aomori.jp\n"
+    "hachinohe.aomori.jp\n"
+    "hashikami.aomori.jp\n"
+    "hiranai.aomori.jp\n"
+    "hirosaki.aomori.jp\n"
+    "itayanagi.aomori.jp\n"
+    "kuroishi.aomori.jp\n"
+    "misawa.aomori.jp\n"
+    "mutsu.aomori.jp\n"
+    "nakadomari.aomori.jp\n"
+    "noheji.aomori.jp\n"
+    "oirase.aomori.jp\n"
+    "owani.aomori.jp\n"
+    "rokunohe.aomori.jp\n"
+    "sannohe.aomori.jp\n"
+    "shichinohe.aomori.jp\n"
+    "shingo.aomori.jp\n"
+    "takko.aomori.jp\n"
+    "towada.aomori.jp\n"
+    "tsugaru.aomori.jp\n"
+    "tsuruta.aomori.jp\n"
+    "abiko.chiba.jp\n"
+    "asahi.chiba.jp\n"
+    "chonan.chiba.jp\n"
+    "chosei.chiba.jp\n"
+    "choshi.chiba.jp\n"
+    "chuo.chiba.jp\n"
+    "funabashi.chiba.jp\n"
+    "futtsu.chiba.jp\n"
+    "hanamigawa.chiba.jp\n"
+    "ichihara.chiba.jp\n"
+    "ichikawa.chiba.jp\n"
+    "ichinomiya.chiba.jp\n"
+    "inzai.chiba.jp\n"
+    "isumi.chiba.jp\n"
+    "kamagaya.chiba.jp\n"
+    "kamogawa.chiba.jp\n"
+    "kashiwa.chiba.jp\n"
+    "katori.chiba.jp\n"
+    "katsuura.chiba.jp\n"
+    "kimitsu.chiba.jp\n"
+    "kisarazu.chiba.jp\n"
+    "kozaki.chiba.jp\n"
+    "kujukuri.chiba.jp\n"
+    "kyonan.chiba.jp\n"
+    "matsudo.chiba.jp\n"
+    "midori.chiba.jp\n"
+    "mihama.chiba.jp\n"
+    "minamiboso.chiba.jp\n"
+    "mobara.chiba.jp\n"
+    "mutsuzawa.chiba.jp\n"
+    "nagara.chiba.jp\n"
+    "nagareyama.chiba.jp\n"
+    "narashino.chiba.jp\n"
+    "narita.chiba.jp\n"
+    "noda.chiba.jp\n"
+    "oamishirasato.chiba.jp\n"
+    "omigawa.chiba.jp\n"
+    "onjuku.chiba.jp\n"
+    "otaki.chiba.jp\n"
+    "sakae.chiba.jp\n"
+    "sakura.chiba.jp\n"
+    "shimofusa.chiba.jp\n"
+    "shirako.chiba.jp\n"
+    "shiroi.chiba.jp\n"
+    "shisui.chiba.jp\n"
+    "sodegaura.chiba.jp\n"
+    "sosa.chiba.jp\n"
+    "tako.chiba.jp\n"
+    "tateyama.chiba.jp\n"
+    "togane.chiba.jp\n"
+    "tohnosho.chiba.jp\n"
+    "tomisato.chiba.jp\n"
+    "urayasu.chiba.jp\n"
+    "yachimata.chiba.jp\n"
+    "yachiyo.chiba.jp\n"
+    "yokaichiba.chiba.jp\n"
+    "yokoshibahikari.chiba.jp\n"
+    "yotsukaido.chiba.jp\n"
+    "ainan.ehime.jp\n"
+    "honai.ehime.jp\n"
+    "ikata.ehime.jp\n"
+    "imabari.ehime.jp\n"
+    "iyo.ehime.jp\n"
+    "kamijima.ehime.jp\n"
+    "kihoku.ehime.jp\n"
+    "kumakogen.ehime.jp\n"
+    "masaki.ehime.jp\n"
+    "matsuno.ehime.jp\n"
+    "matsuyama.ehime.jp\n"
+    "namikata.ehime.jp\n"
+    "niihama.ehime.jp\n"
+    "ozu.ehime.jp\n"
+    "saijo.ehime.jp\n"
+    "seiyo.ehime.jp\n"
+    "shikokuchuo.ehime.jp\n"
+    "tobe.ehime.jp\n"
+    "toon.ehime.jp\n"
+    "uchiko.ehime.jp\n"
+    "uwajima.ehime.jp\n"
+    "yawatahama.ehime.jp\n"
+    "echizen.fukui.jp\n"
+    "eiheiji.fukui.jp\n"
+    "fukui.fukui.jp\n"
+    "ikeda.fukui.jp\n"
+    "katsuyama.fukui.jp\n"
+    "mihama.fukui.jp\n"
+    "minamiechizen.fukui.jp\n"
+    "obama.fukui.jp\n"
+    "ohi.fukui.jp\n"
+    "ono.fukui.jp\n"
+    "sabae.fukui.jp\n"
+    "sakai.fukui.jp\n"
+    "takahama.fukui.jp\n"
+    "tsuruga.fukui.jp\n"
+    "wakasa.fukui.jp\n"
+    "ashiya.fukuoka.jp\n"
+    "buzen.fukuoka.jp\n"
+    "chikugo.fukuoka.jp\n"
+    "chikuho.fukuoka.jp\n"
+    "chikujo.fukuoka.jp\n"
+    "chikushino.fukuoka.jp\n"
+    "chikuzen.fukuoka.jp\n"
+    "chuo.fukuoka.jp\n"
+    "dazaifu.fukuoka.jp\n"
+    "fukuchi.fukuoka.jp\n"
+    "hakata.fukuoka.jp\n"
+    "higashi.fukuoka.jp\n"
+    "hirokawa.fukuoka.jp\n"
+    "hisayama.fukuoka.jp\n"
+    "iizuka.fukuoka.jp\n"
+    "inatsuki.fukuoka.jp\n"
+    "kaho.fukuoka.jp\n"
+    "kasuga.fukuoka.jp\n"
+    "kasuya.fukuoka.jp\n"
+    "kawara.fukuoka.jp\n"
+    "keisen.fukuoka.jp\n"
+    "koga.fukuoka.jp\n"
+    "kurate.fukuoka.jp\n"
+    "kurogi.fukuoka.jp\n"
+    "kurume.fukuoka.jp\n"
+    "minami.fukuoka.jp\n"
+    "miyako.fukuoka.jp\n"
+    "miyama.fukuoka.jp\n"
+    "miyawaka.fukuoka.jp\n"
+    "mizumaki.fukuoka.jp\n"
+    "munakata.fukuoka.jp\n"
+    "nakagawa.fukuoka.jp\n"
+    "nakama.fukuoka.jp\n"
+    "nishi.fukuoka.jp\n"
+    "nogata.fukuoka.jp\n"
+    "ogori.fukuoka.jp\n"
+    "okagaki.fukuoka.jp\n"
+    "okawa.fukuoka.jp\n"
+    "oki.fukuoka.jp\n"
+    "omuta.fukuoka.jp\n"
+    "onga.fukuoka.jp\n"
+    "onojo.fukuoka.jp\n"
+    "oto.fukuoka.jp\n"
+    "saigawa.fukuoka.jp\n"
+    "sasaguri.fukuoka.jp\n"
+    "shingu.fukuoka.jp\n"
+    "shinyoshitomi.fukuoka.jp\n"
+    "shonai.fukuoka.jp\n"
+    "soeda.fukuoka.jp\n"
+    "sue.fukuoka.jp\n"
+    "tachiarai.fukuoka.jp\n"
+    "tagawa.fukuoka.jp\n"
+    "takata.fukuoka.jp\n"
+    "toho.fukuoka.jp\n"
+    "toyotsu.fukuoka.jp\n"
+    "tsuiki.fukuoka.jp\n"
+    "ukiha.fukuoka.jp\n"
+    "umi.fukuoka.jp\n"
+    "usui.fukuoka.jp\n"
+    "yamada.fukuoka.jp\n"
+    "yame.fukuoka.jp\n"
+    "yanagawa.fukuoka.jp\n"
+    "yukuhashi.fukuoka.jp\n"
+    "aizubange.fukushima.jp\n"
+    "aizumisato.fukushima.jp\n"
+    "aizuwakamatsu.fukushima.jp\n"
+    "asakawa.fukushima.jp\n"
+    "bandai.fukushima.jp\n"
+    "date.fukushima.jp\n"
+    "fukushima.fukushima.jp\n"
+    "furudono.fukushima.jp\n"
+    "futaba.fukushima.jp\n"
+    "hanawa.fukushima.jp\n"
+    "higashi.fukushima.jp\n"
+    "hirata.fukushima.jp\n"
+    "hirono.fukushima.jp\n"
+    "iitate.fukushima.jp\n"
+    "inawashiro.fukushima.jp\n"
+    "ishikawa.fukushima.jp\n"
+    "iwaki.fukushima.jp\n"
+    "izumizaki.fukushima.jp\n"
+    "kagamiishi.fukushima.jp\n"
+    "kaneyama.fukushima.jp\n"
+    "kawamata.fukushima.jp\n"
+    "kitakata.fukushima.jp\n"
+    "kitashiobara.fukushima.jp\n"
+    "koori.fukushima.jp\n"
+    "koriyama.fukushima.jp\n"
+    "kunimi.fukushima.jp\n"
+    "miharu.fukushima.jp\n"
+    "mishima.fukushima.jp\n"
+    "namie.fukushima.jp\n"
+    "nango.fukushima.jp\n"
+    "nishiaizu.fukushima.jp\n"
+    "nishigo.fukushima.jp\n"
+    "okuma.fukushima.jp\n"
+    "omotego.fukushima.jp\n"
+    "ono.fukushima.jp\n"
+    "otama.fukushima.jp\n"
+    "samegawa.fukushima.jp\n"
+    "shimogo.fukushima.jp\n"
+    "shirakawa.fukushima.jp\n"
+    "showa.fukushima.jp\n"
+    "soma.fukushima.jp\n"
+    "sukagawa.fukushima.jp\n"
+    "taishin.fukushima.jp\n"
+    "tamakawa.fukushima.jp\n"
+    "tanagura.fukushima.jp\n"
+    "tenei.fukushima.jp\n"
+    "yabuki.fukushima.jp\n"
+    "yamato.fukushima.jp\n"
+    "yamatsuri.fukushima.jp\n"
+    "yanaizu.fukushima.jp\n"
+    "yugawa.fukushima.jp\n"
+    "anpachi.gifu.jp\n"
+    "ena.gifu.jp\n"
+    "gifu.gifu.jp\n"
+    "ginan.gifu.jp\n"
+    "godo.gifu.jp\n"
+    "gujo.gifu.jp\n"
+    "hashima.gifu.jp\n"
+    "hichiso.gifu.jp\n"
+    "hida.gifu.jp\n"
+    "higashishirakawa.gifu.jp\n"
+    "ibigawa.gifu.jp\n"
+    "ikeda.gifu.jp\n"
+    "kakamigahara.gifu.jp\n"
+    "kani.gifu.jp\n"
+    "kasahara.gifu.jp\n"
+    "kasamatsu.gifu.jp\n"
+    "kawaue.gifu.jp\n"
+    "kitagata.gifu.jp\n"
+    "mino.gifu.jp\n"
+    "minokamo.gifu.jp\n"
+    "mitake.gifu.jp\n"
+    "mizunami.gifu.jp\n"
+    "motosu.gifu.jp\n"
+    "nakatsugawa.gifu.jp\n"
+    "ogaki.gifu.jp\n"
+    "sakahogi.gifu.jp\n"
+    "seki.gifu.jp\n"
+    "sekigahara.gifu.jp\n"
+    "shirakawa.gifu.jp\n"
+    "tajimi.gifu.jp\n"
+    "takayama.gifu.jp\n"
+    "tarui.gifu.jp\n"
+    "toki.gifu.jp\n"
+    "tomika.gifu.jp\n"
+    "wanouchi.gifu.jp\n"
+    "yamagata.gifu.jp\n"
+    "yaotsu.gifu.jp\n"
+    "yoro.gifu.jp\n"
+    "annaka.gunma.jp\n"
+    "chiyoda.gunma.jp\n"
+    "fujioka.gunma.jp\n"
+    "higashiagatsuma.gunma.jp\n"
+    "isesaki.gunma.jp\n"
+    "itakura.gunma.jp\n"
+    "kanna.gunma.jp\n"
+    "kanra.gunma.jp\n"
+    "katashina.gunma.jp\n"
+    "kawaba.gunma.jp\n"
+    "kiryu.gunma.jp\n"
+    "kusatsu.gunma.jp\n"
+    "maebashi.gunma.jp\n"
+    "meiwa.gunma.jp\n"
+    "midori.gunma.jp\n"
+    "minakami.gunma.jp\n"
+    "naganohara.gunma.jp\n"
+    "nakanojo.gunma.jp\n"
+    "nanmoku.gunma.jp\n"
+    "numata.gunma.jp\n"
+    "oizumi.gunma.jp\n"
+    "ora.gunma.jp\n"
+    "ota.gunma.jp\n"
+    "shibukawa.gunma.jp\n"
+    "shimonita.gunma.jp\n"
+    "shinto.gunma.jp\n"
+    "showa.gunma.jp\n"
+    "takasaki.gunma.jp\n"
+    "takayama.gunma.jp\n"
+    "tamamura.gunma.jp\n"
+    "tatebayashi.gunma.jp\n"
+    "tomioka.gunma.jp\n"
+    "tsukiyono.gunma.jp\n"
+    "tsumagoi.gunma.jp\n"
+    "ueno.gunma.jp\n"
+    "yoshioka.gunma.jp\n"
+    "asaminami.hiroshima.jp\n"
+    "daiwa.hiroshima.jp\n"
+    "etajima.hiroshima.jp\n"
+    "fuchu.hiroshima.jp\n"
+    "fukuyama.hiroshima.jp\n"
+    "hatsukaichi.hiroshima.jp\n"
+    "higashihiroshima.hiroshima.jp\n"
+    "hongo.hiroshima.jp\n"
+    "jinsekikogen.hiroshima.jp\n"
+    "kaita.hiroshima.jp\n"
+    "kui.hiroshima.jp\n"
+    "kumano.hiroshima.jp\n"
+    "kure.hiroshima.jp\n"
+    "mihara.hiroshima.jp\n"
+    "miyoshi.hiroshima.jp\n"
+    "naka.hiroshima.jp\n"
+    "onomichi.hiroshima.jp\n"
+    "osakikamijima.hiroshima.jp\n"
+    "otake.hiroshima.jp\n"
+    "saka.hiroshima.jp\n"
+    "sera.hiroshima.jp\n"
+    "seranishi.hiroshima.jp\n"
+    "shinichi.hiroshima.jp\n"
+    "shobara.hiroshima.jp\n"
+    "takehara.hiroshima.jp\n"
+    "abashiri.hokkaido.jp\n"
+    "abira.hokkaido.jp\n"
+    "aibetsu.hokkaido.jp\n"
+    "akabira.hokkaido.jp\n"
+    "akkeshi.hokkaido.jp\n"
+    "asahikawa.hokkaido.jp\n"
+    "ashibetsu.hokkaido.jp\n"
+    "ashoro.hokkaido.jp\n"
+    "assabu.hokkaido.jp\n"
+    "atsuma.hokkaido.jp\n"
+    "bibai.hokkaido.jp\n"
+    "biei.hokkaido.jp\n"
+    "bifuka.hokkaido.jp\n"
+    "bihoro.hokkaido.jp\n"
+    "biratori.hokkaido.jp\n"
+    "chippubetsu.hokkaido.jp\n"
+    "chitose.hokkaido.jp\n"
+    "date.hokkaido.jp\n"
+    "ebetsu.hokkaido.jp\n"
+    "embetsu.hokkaido.jp\n"
+    "eniwa.hokkaido.jp\n"
+    "erimo.hokkaido.jp\n"
+    "esan.hokkaido.jp\n"
+    "esashi.hokkaido.jp\n"
+    "fukagawa.hokkaido.jp\n"
+    "fukushima.hokkaido.jp\n"
+    "furano.hokkaido.jp\n"
+    "furubira.hokkaido.jp\n"
+    "haboro.hokkaido.jp\n"
+    "hakodate.hokkaido.jp\n"
+    "hamatonbetsu.hokkaido.jp\n"
+    "hidaka.hokkaido.jp\n"
+    "higashikagura.hokkaido.jp\n"
+    "higashikawa.hokkaido.jp\n"
+    "hiroo.hokkaido.jp\n"
+    "hokuryu.hokkaido.jp\n"
+    "hokuto.hokkaido.jp\n"
+    "honbetsu.hokkaido.jp\n"
+    "horokanai.hokkaido.jp\n"
+    "horonobe.hokkaido.jp\n"
+    "ikeda.hokkaido.jp\n"
+    "imakane.hokkaido.jp\n"
+    "ishikari.hokkaido.jp\n"
+    "iwamizawa.hokkaido.jp\n"
+    "iwanai.hokkaido.jp\n"
+    "kamifurano.hokkaido.jp\n"
+    "kamikawa.hokkaido.jp\n"
+    "kamishihoro.hokkaido.jp\n"
+    "kamisunagawa.hokkaido.jp\n"
+    "kamoenai.hokkaido.jp\n"
+    "kayabe.hokkaido.jp\n"
+    "kembuchi.hokkaido.jp\n"
+    "kikonai.hokkaido.jp\n"
+    "kimobetsu.hokkaido.jp\n"
+    "kitahiroshima.hokkaido.jp\n"
+    "kitami.hokkaido.jp\n"
+    "kiyosato.hokkaido.jp\n"
+    "koshimizu.hokkaido.jp\n"
+    "kunneppu.hokkaido.jp\n"
+    "kuriyama.hokkaido.jp\n"
+    "kuromatsunai.hokkaido.jp\n"
+    "kushiro.hokkaido.jp\n"
+    "kutchan.hokkaido.jp\n"
+    "kyowa.hokkaido.jp\n"
+    "mashike.hokkaido.jp\n"
+    "matsumae.hokkaido.jp\n"
+    "mikasa.hokkaido.jp\n"
+    "minamifurano.hokkaido.jp\n"
+    "mombetsu.hokkaido.jp\n"
+    "moseushi.hokkaido.jp\n"
+    "mukawa.hokkaido.jp\n"
+    "muroran.hokkaido.jp\n"
+    "naie.hokkaido.jp\n"
+    "nakagawa.hokkaido.jp\n"
+    "nakasatsunai.hokkaido.jp\n"
+    "nakatombetsu.hokkaido.jp\n"
+    "nanae.hokkaido.jp\n"
+    "nanporo.hokkaido.jp\n"
+    "nayoro.hokkaido.jp\n"
+    "nemuro.hokkaido.jp\n"
+    "niikappu.hokkaido.jp\n"
+    "niki.hokkaido.jp\n"
+    "nishiokoppe.hokkaido.jp\n",
+
+    "noboribetsu.hokkaido.jp\n"
+    "numata.hokkaido.jp\n"
+    "obihiro.hokkaido.jp\n"
+    "obira.hokkaido.jp\n"
+    "oketo.hokkaido.jp\n"
+    "okoppe.hokkaido.jp\n"
+    "otaru.hokkaido.jp\n"
+    "otobe.hokkaido.jp\n"
+    "otofuke.hokkaido.jp\n"
+    "otoineppu.hokkaido.jp\n"
+    "oumu.hokkaido.jp\n"
+    "ozora.hokkaido.jp\n"
+    "pippu.hokkaido.jp\n"
+    "rankoshi.hokkaido.jp\n"
+    "rebun.hokkaido.jp\n"
+    "rikubetsu.hokkaido.jp\n"
+    "rishiri.hokkaido.jp\n"
+    "rishirifuji.hokkaido.jp\n"
+    "saroma.hokkaido.jp\n"
+    "sarufutsu.hokkaido.jp\n"
+    "shakotan.hokkaido.jp\n"
+    "shari.hokkaido.jp\n"
+    "shibecha.hokkaido.jp\n"
+    "shibetsu.hokkaido.jp\n"
+    "shikabe.hokkaido.jp\n"
+    "shikaoi.hokkaido.jp\n"
+    "shimamaki.hokkaido.jp\n"
+    "shimizu.hokkaido.jp\n"
+    "shimokawa.hokkaido.jp\n"
+    "shinshinotsu.hokkaido.jp\n"
+    "shintoku.hokkaido.jp\n"
+    "shiranuka.hokkaido.jp\n"
+    "shiraoi.hokkaido.jp\n"
+    "shiriuchi.hokkaido.jp\n"
+    "sobetsu.hokkaido.jp\n"
+    "sunagawa.hokkaido.jp\n"
+    "taiki.hokkaido.jp\n"
+    "takasu.hokkaido.jp\n"
+    "takikawa.hokkaido.jp\n"
+    "takinoue.hokkaido.jp\n"
+    "teshikaga.hokkaido.jp\n"
+    "tobetsu.hokkaido.jp\n"
+    "tohma.hokkaido.jp\n"
+    "tomakomai.hokkaido.jp\n"
+    "tomari.hokkaido.jp\n"
+    "toya.hokkaido.jp\n"
+    "toyako.hokkaido.jp\n"
+    "toyotomi.hokkaido.jp\n"
+    "toyoura.hokkaido.jp\n"
+    "tsubetsu.hokkaido.jp\n"
+    "tsukigata.hokkaido.jp\n"
+    "urakawa.hokkaido.jp\n"
+    "urausu.hokkaido.jp\n"
+    "uryu.hokkaido.jp\n"
+    "utashinai.hokkaido.jp\n"
+    "wakkanai.hokkaido.jp\n"
+    "wassamu.hokkaido.jp\n"
+    "yakumo.hokkaido.jp\n"
+    "yoichi.hokkaido.jp\n"
+    "aioi.hyogo.jp\n"
+    "akashi.hyogo.jp\n"
+    "ako.hyogo.jp\n"
+    "amagasaki.hyogo.jp\n"
+    "aogaki.hyogo.jp\n"
+    "asago.hyogo.jp\n"
+    "ashiya.hyogo.jp\n"
+    "awaji.hyogo.jp\n"
+    "fukusaki.hyogo.jp\n"
+    "goshiki.hyogo.jp\n"
+    "harima.hyogo.jp\n"
+    "himeji.hyogo.jp\n"
+    "ichikawa.hyogo.jp\n"
+    "inagawa.hyogo.jp\n"
+    "itami.hyogo.jp\n"
+    "kakogawa.hyogo.jp\n"
+    "kamigori.hyogo.jp\n"
+    "kamikawa.hyogo.jp\n"
+    "kasai.hyogo.jp\n"
+    "kasuga.hyogo.jp\n"
+    "kawanishi.hyogo.jp\n"
+    "miki.hyogo.jp\n"
+    "minamiawaji.hyogo.jp\n"
+    "nishinomiya.hyogo.jp\n"
+    "nishiwaki.hyogo.jp\n"
+    "ono.hyogo.jp\n"
+    "sanda.hyogo.jp\n"
+    "sannan.hyogo.jp\n"
+    "sasayama.hyogo.jp\n"
+    "sayo.hyogo.jp\n"
+    "shingu.hyogo.jp\n"
+    "shinonsen.hyogo.jp\n"
+    "shiso.hyogo.jp\n"
+    "sumoto.hyogo.jp\n"
+    "taishi.hyogo.jp\n"
+    "taka.hyogo.jp\n"
+    "takarazuka.hyogo.jp\n"
+    "takasago.hyogo.jp\n"
+    "takino.hyogo.jp\n"
+    "tamba.hyogo.jp\n"
+    "tatsuno.hyogo.jp\n"
+    "toyooka.hyogo.jp\n"
+    "yabu.hyogo.jp\n"
+    "yashiro.hyogo.jp\n"
+    "yoka.hyogo.jp\n"
+    "yokawa.hyogo.jp\n"
+    "ami.ibaraki.jp\n"
+    "asahi.ibaraki.jp\n"
+    "bando.ibaraki.jp\n"
+    "chikusei.ibaraki.jp\n"
+    "daigo.ibaraki.jp\n"
+    "fujishiro.ibaraki.jp\n"
+    "hitachi.ibaraki.jp\n"
+    "hitachinaka.ibaraki.jp\n"
+    "hitachiomiya.ibaraki.jp\n"
+    "hitachiota.ibaraki.jp\n"
+    "ibaraki.ibaraki.jp\n"
+    "ina.ibaraki.jp\n"
+    "inashiki.ibaraki.jp\n"
+    "itako.ibaraki.jp\n"
+    "iwama.ibaraki.jp\n"
+    "joso.ibaraki.jp\n"
+    "kamisu.ibaraki.jp\n"
+    "kasama.ibaraki.jp\n"
+    "kashima.ibaraki.jp\n"
+    "kasumigaura.ibaraki.jp\n"
+    "koga.ibaraki.jp\n"
+    "miho.ibaraki.jp\n"
+    "mito.ibaraki.jp\n"
+    "moriya.ibaraki.jp\n"
+    "naka.ibaraki.jp\n"
+    "namegata.ibaraki.jp\n"
+    "oarai.ibaraki.jp\n"
+    "ogawa.ibaraki.jp\n"
+    "omitama.ibaraki.jp\n"
+    "ryugasaki.ibaraki.jp\n"
+    "sakai.ibaraki.jp\n"
+    "sakuragawa.ibaraki.jp\n"
+    "shimodate.ibaraki.jp\n"
+    "shimotsuma.ibaraki.jp\n"
+    "shirosato.ibaraki.jp\n"
+    "sowa.ibaraki.jp\n"
+    "suifu.ibaraki.jp\n"
+    "takahagi.ibaraki.jp\n"
+    "tamatsukuri.ibaraki.jp\n"
+    "tokai.ibaraki.jp\n"
+    "tomobe.ibaraki.jp\n"
+    "tone.ibaraki.jp\n"
+    "toride.ibaraki.jp\n"
+    "tsuchiura.ibaraki.jp\n"
+    "tsukuba.ibaraki.jp\n"
+    "uchihara.ibaraki.jp\n"
+    "ushiku.ibaraki.jp\n"
+    "yachiyo.ibaraki.jp\n"
+    "yamagata.ibaraki.jp\n"
+    "yawara.ibaraki.jp\n"
+    "yuki.ibaraki.jp\n"
+    "anamizu.ishikawa.jp\n"
+    "hakui.ishikawa.jp\n"
+    "hakusan.ishikawa.jp\n"
+    "kaga.ishikawa.jp\n"
+    "kahoku.ishikawa.jp\n"
+    "kanazawa.ishikawa.jp\n"
+    "kawakita.ishikawa.jp\n"
+    "komatsu.ishikawa.jp\n"
+    "nakanoto.ishikawa.jp\n"
+    "nanao.ishikawa.jp\n"
+    "nomi.ishikawa.jp\n"
+    "nonoichi.ishikawa.jp\n"
+    "noto.ishikawa.jp\n"
+    "shika.ishikawa.jp\n"
+    "suzu.ishikawa.jp\n"
+    "tsubata.ishikawa.jp\n"
+    "tsurugi.ishikawa.jp\n"
+    "uchinada.ishikawa.jp\n"
+    "wajima.ishikawa.jp\n"
+    "fudai.iwate.jp\n"
+    "fujisawa.iwate.jp\n"
+    "hanamaki.iwate.jp\n"
+    "hiraizumi.iwate.jp\n"
+    "hirono.iwate.jp\n"
+    "ichinohe.iwate.jp\n"
+    "ichinoseki.iwate.jp\n"
+    "iwaizumi.iwate.jp\n"
+    "iwate.iwate.jp\n"
+    "joboji.iwate.jp\n"
+    "kamaishi.iwate.jp\n"
+    "kanegasaki.iwate.jp\n"
+    "karumai.iwate.jp\n"
+    "kawai.iwate.jp\n"
+    "kitakami.iwate.jp\n"
+    "kuji.iwate.jp\n"
+    "kunohe.iwate.jp\n"
+    "kuzumaki.iwate.jp\n"
+    "miyako.iwate.jp\n"
+    "mizusawa.iwate.jp\n"
+    "morioka.iwate.jp\n"
+    "ninohe.iwate.jp\n"
+    "noda.iwate.jp\n"
+    "ofunato.iwate.jp\n"
+    "oshu.iwate.jp\n"
+    "otsuchi.iwate.jp\n"
+    "rikuzentakata.iwate.jp\n"
+    "shiwa.iwate.jp\n"
+    "shizukuishi.iwate.jp\n"
+    "sumita.iwate.jp\n"
+    "tanohata.iwate.jp\n"
+    "tono.iwate.jp\n"
+    "yahaba.iwate.jp\n"
+    "yamada.iwate.jp\n"
+    "ayagawa.kagawa.jp\n"
+    "higashikagawa.kagawa.jp\n"
+    "kanonji.kagawa.jp\n"
+    "kotohira.kagawa.jp\n"
+    "manno.kagawa.jp\n"
+    "marugame.kagawa.jp\n"
+    "mitoyo.kagawa.jp\n"
+    "naoshima.kagawa.jp\n"
+    "sanuki.kagawa.jp\n"
+    "tadotsu.kagawa.jp\n"
+    "takamatsu.kagawa.jp\n"
+    "tonosho.kagawa.jp\n"
+    "uchinomi.kagawa.jp\n"
+    "utazu.kagawa.jp\n"
+    "zentsuji.kagawa.jp\n"
+    "akune.kagoshima.jp\n"
+    "amami.kagoshima.jp\n"
+    "hioki.kagoshima.jp\n"
+    "isa.kagoshima.jp\n"
+    "isen.kagoshima.jp\n"
+    "izumi.kagoshima.jp\n"
+    "kagoshima.kagoshima.jp\n"
+    "kanoya.kagoshima.jp\n"
+    "kawanabe.kagoshima.jp\n"
+    "kinko.kagoshima.jp\n"
+    "kouyama.kagoshima.jp\n"
+    "makurazaki.kagoshima.jp\n"
+    "matsumoto.kagoshima.jp\n"
+    "minamitane.kagoshima.jp\n"
+    "nakatane.kagoshima.jp\n"
+    "nishinoomote.kagoshima.jp\n"
+    "satsumasendai.kagoshima.jp\n"
+    "soo.kagoshima.jp\n"
+    "tarumizu.kagoshima.jp\n"
+    "yusui.kagoshima.jp\n"
+    "aikawa.kanagawa.jp\n"
+    "atsugi.kanagawa.jp\n"
+    "ayase.kanagawa.jp\n"
+    "chigasaki.kanagawa.jp\n"
+    "ebina.kanagawa.jp\n"
+    "fujisawa.kanagawa.jp\n"
+    "hadano.kanagawa.jp\n"
+    "hakone.kanagawa.jp\n"
+    "hiratsuka.kanagawa.jp\n"
+    "isehara.kanagawa.jp\n"
+    "kaisei.kanagawa.jp\n"
+    "kamakura.kanagawa.jp\n"
+    "kiyokawa.kanagawa.jp\n"
+    "matsuda.kanagawa.jp\n"
+    "minamiashigara.kanagawa.jp\n"
+    "miura.kanagawa.jp\n"
+    "nakai.kanagawa.jp\n"
+    "ninomiya.kanagawa.jp\n"
+    "odawara.kanagawa.jp\n"
+    "oi.kanagawa.jp\n"
+    "oiso.kanagawa.jp\n"
+    "sagamihara.kanagawa.jp\n"
+    "samukawa.kanagawa.jp\n"
+    "tsukui.kanagawa.jp\n"
+    "yamakita.kanagawa.jp\n"
+    "yamato.kanagawa.jp\n"
+    "yokosuka.kanagawa.jp\n"
+    "yugawara.kanagawa.jp\n"
+    "zama.kanagawa.jp\n"
+    "zushi.kanagawa.jp\n"
+    "aki.kochi.jp\n"
+    "geisei.kochi.jp\n"
+    "hidaka.kochi.jp\n"
+    "higashitsuno.kochi.jp\n"
+    "ino.kochi.jp\n"
+    "kagami.kochi.jp\n"
+    "kami.kochi.jp\n"
+    "kitagawa.kochi.jp\n"
+    "kochi.kochi.jp\n"
+    "mihara.kochi.jp\n"
+    "motoyama.kochi.jp\n"
+    "muroto.kochi.jp\n"
+    "nahari.kochi.jp\n"
+    "nakamura.kochi.jp\n"
+    "nankoku.kochi.jp\n"
+    "nishitosa.kochi.jp\n"
+    "niyodogawa.kochi.jp\n"
+    "ochi.kochi.jp\n"
+    "okawa.kochi.jp\n"
+    "otoyo.kochi.jp\n"
+    "otsuki.kochi.jp\n"
+    "sakawa.kochi.jp\n"
+    "sukumo.kochi.jp\n"
+    "susaki.kochi.jp\n"
+    "tosa.kochi.jp\n"
+    "tosashimizu.kochi.jp\n"
+    "toyo.kochi.jp\n"
+    "tsuno.kochi.jp\n"
+    "umaji.kochi.jp\n"
+    "yasuda.kochi.jp\n"
+    "yusuhara.kochi.jp\n"
+    "amakusa.kumamoto.jp\n"
+    "arao.kumamoto.jp\n"
+    "aso.kumamoto.jp\n"
+    "choyo.kumamoto.jp\n"
+    "gyokuto.kumamoto.jp\n"
+    "kamiamakusa.kumamoto.jp\n"
+    "kikuchi.kumamoto.jp\n"
+    "kumamoto.kumamoto.jp\n"
+    "mashiki.kumamoto.jp\n"
+    "mifune.kumamoto.jp\n"
+    "minamata.kumamoto.jp\n"
+    "minamioguni.kumamoto.jp\n"
+    "nagasu.kumamoto.jp\n"
+    "nishihara.kumamoto.jp\n"
+    "oguni.kumamoto.jp\n"
+    "ozu.kumamoto.jp\n"
+    "sumoto.kumamoto.jp\n"
+    "takamori.kumamoto.jp\n"
+    "uki.kumamoto.jp\n"
+    "uto.kumamoto.jp\n"
+    "yamaga.kumamoto.jp\n"
+    "yamato.kumamoto.jp\n"
+    "yatsushiro.kumamoto.jp\n"
+    "ayabe.kyoto.jp\n"
+    "fukuchiyama.kyoto.jp\n"
+    "higashiyama.kyoto.jp\n"
+    "ide.kyoto.jp\n"
+    "ine.kyoto.jp\n"
+    "joyo.kyoto.jp\n"
+    "kameoka.kyoto.jp\n"
+    "kamo.kyoto.jp\n"
+    "kita.kyoto.jp\n"
+    "kizu.kyoto.jp\n"
+    "kumiyama.kyoto.jp\n"
+    "kyotamba.kyoto.jp\n"
+    "kyotanabe.kyoto.jp\n"
+    "kyotango.kyoto.jp\n"
+    "maizuru.kyoto.jp\n"
+    "minami.kyoto.jp\n"
+    "minamiyamashiro.kyoto.jp\n"
+    "miyazu.kyoto.jp\n"
+    "muko.kyoto.jp\n"
+    "nagaokakyo.kyoto.jp\n"
+    "nakagyo.kyoto.jp\n"
+    "nantan.kyoto.jp\n"
+    "oyamazaki.kyoto.jp\n"
+    "sakyo.kyoto.jp\n"
+    "seika.kyoto.jp\n"
+    "tanabe.kyoto.jp\n"
+    "uji.kyoto.jp\n"
+    "ujitawara.kyoto.jp\n"
+    "wazuka.kyoto.jp\n"
+    "yamashina.kyoto.jp\n"
+    "yawata.kyoto.jp\n"
+    "asahi.mie.jp\n"
+    "inabe.mie.jp\n"
+    "ise.mie.jp\n"
+    "kameyama.mie.jp\n"
+    "kawagoe.mie.jp\n"
+    "kiho.mie.jp\n"
+    "kisosaki.mie.jp\n"
+    "kiwa.mie.jp\n"
+    "komono.mie.jp\n"
+    "kumano.mie.jp\n"
+    "kuwana.mie.jp\n"
+    "matsusaka.mie.jp\n"
+    "meiwa.mie.jp\n"
+    "mihama.mie.jp\n"
+    "minamiise.mie.jp\n"
+    "misugi.mie.jp\n"
+    "miyama.mie.jp\n"
+    "nabari.mie.jp\n"
+    "shima.mie.jp\n"
+    "suzuka.mie.jp\n"
+    "tado.mie.jp\n"
+    "taiki.mie.jp\n"
+    "taki.mie.jp\n"
+    "tamaki.mie.jp\n"
+    "toba.mie.jp\n"
+    "tsu.mie.jp\n"
+    "udono.mie.jp\n"
+    "ureshino.mie.jp\n"
+    "watarai.mie.jp\n"
+    "yokkaichi.mie.jp\n"
+    "furukawa.miyagi.jp\n"
+    "higashimatsushima.miyagi.jp\n"
+    "ishinomaki.miyagi.jp\n"
+    "iwanuma.miyagi.jp\n"
+    "kakuda.miyagi.jp\n"
+    "kami.miyagi.jp\n"
+    "kawasaki.miyagi.jp\n"
+    "marumori.miyagi.jp\n"
+    "matsushima.miyagi.jp\n"
+    "minamisanriku.miyagi.jp\n"
+    "misato.miyagi.jp\n"
+    "murata.miyagi.jp\n"
+    "natori.miyagi.jp\n"
+    "ogawara.miyagi.jp\n"
+    "ohira.miyagi.jp\n"
+    "onagawa.miyagi.jp\n"
+    "osaki.miyagi.jp\n"
+    "rifu.miyagi.jp\n"
+    "semine.miyagi.jp\n"
+    "shibata.miyagi.jp\n"
+    "shichikashuku.miyagi.jp\n"
+    "shikama.miyagi.jp\n"
+    "shiogama.miyagi.jp\n"
+    "shiroishi.miyagi.jp\n"
+    "tagajo.miyagi.jp\n"
+    "taiwa.miyagi.jp\n"
+    "tome.miyagi.jp\n"
+    "tomiya.miyagi.jp\n"
+    "wakuya.miyagi.jp\n"
+    "watari.miyagi.jp\n"
+    "yamamoto.miyagi.jp\n"
+    "zao.miyagi.jp\n"
+    "aya.miyazaki.jp\n"
+    "ebino.miyazaki.jp\n"
+    "gokase.miyazaki.jp\n"
+    "hyuga.miyazaki.jp\n"
+    "kadogawa.miyazaki.jp\n"
+    "kawaminami.miyazaki.jp\n"
+    "kijo.miyazaki.jp\n"
+    "kitagawa.miyazaki.jp\n"
+    "kitakata.miyazaki.jp\n"
+    "kitaura.miyazaki.jp\n"
+    "kobayashi.miyazaki.jp\n"
+    "kunitomi.miyazaki.jp\n"
+    "kushima.miyazaki.jp\n"
+    "mimata.miyazaki.jp\n"
+    "miyakonojo.miyazaki.jp\n"
+    "miyazaki.miyazaki.jp\n"
+    "morotsuka.miyazaki.jp\n"
+    "nichinan.miyazaki.jp\n"
+    "nishimera.miyazaki.jp\n"
+    "nobeoka.miyazaki.jp\n"
+    "saito.miyazaki.jp\n"
+    "shiiba.miyazaki.jp\n"
+    "shintomi.miyazaki.jp\n"
+    "takaharu.miyazaki.jp\n"
+    "takanabe.miyazaki.jp\n"
+    "takazaki.miyazaki.jp\n"
+    "tsuno.miyazaki.jp\n"
+    "achi.nagano.jp\n"
+    "agematsu.nagano.jp\n"
+    "anan.nagano.jp\n"
+    "aoki.nagano.jp\n"
+    "asahi.nagano.jp\n"
+    "azumino.nagano.jp\n"
+    "chikuhoku.nagano.jp\n"
+    "chikuma.nagano.jp\n"
+    "chino.nagano.jp\n"
+    "fujimi.nagano.jp\n"
+    "hakuba.nagano.jp\n"
+    "hara.nagano.jp\n"
+    "hiraya.nagano.jp\n"
+    "iida.nagano.jp\n"
+    "iijima.nagano.jp\n"
+    "iiyama.nagano.jp\n"
+    "iizuna.nagano.jp\n"
+    "ikeda.nagano.jp\n"
+    "ikusaka.nagano.jp\n"
+    "ina.nagano.jp\n"
+    "karuizawa.nagano.jp\n"
+    "kawakami.nagano.jp\n"
+    "kiso.nagano.jp\n"
+    "kisofukushima.nagano.jp\n"
+    "kitaaiki.nagano.jp\n"
+    "komagane.nagano.jp\n"
+    "komoro.nagano.jp\n"
+    "matsukawa.nagano.jp\n"
+    "matsumoto.nagano.jp\n"
+    "miasa.nagano.jp\n"
+    "minamiaiki.nagano.jp\n"
+    "minamimaki.nagano.jp\n"
+    "minamiminowa.nagano.jp\n"
+    "minowa.nagano.jp\n"
+    "miyada.nagano.jp\n"
+    "miyota.nagano.jp\n"
+    "mochizuki.nagano.jp\n"
+    "nagano.nagano.jp\n"
+    "nagawa.nagano.jp\n"
+    "nagiso.nagano.jp\n"
+    "nakagawa.nagano.jp\n"
+    "nakano.nagano.jp\n"
+    "nozawaonsen.nagano.jp\n"
+    "obuse.nagano.jp\n"
+    "ogawa.nagano.jp\n"
+    "okaya.nagano.jp\n"
+    "omachi.nagano.jp\n"
+    "omi.nagano.jp\n"
+    "ookuwa.nagano.jp\n"
+    "ooshika.nagano.jp\n"
+    "otaki.nagano.jp\n"
+    "otari.nagano.jp\n"
+    "sakae.nagano.jp\n"
+    "sakaki.nagano.jp\n"
+    "saku.nagano.jp\n"
+    "sakuho.nagano.jp\n"
+    "shimosuwa.nagano.jp\n"
+    "shinanomachi.nagano.jp\n"
+    "shiojiri.nagano.jp\n"
+    "suwa.nagano.jp\n"
+    "suzaka.nagano.jp\n"
+    "takagi.nagano.jp\n"
+    "takamori.nagano.jp\n"
+    "takayama.nagano.jp\n"
+    "tateshina.nagano.jp\n"
+    "tatsuno.nagano.jp\n"
+    "togakushi.nagano.jp\n"
+    "togura.nagano.jp\n"
+    "tomi.nagano.jp\n"
+    "ueda.nagano.jp\n"
+    "wada.nagano.jp\n"
+    "yamagata.nagano.jp\n"
+    "yamanouchi.nagano.jp\n"
+    "yasaka.nagano.jp\n"
+    "yasuoka.nagano.jp\n"
+    "chijiwa.nagasaki.jp\n"
+    "futsu.nagasaki.jp\n"
+    "goto.nagasaki.jp\n"
+    "hasami.nagasaki.jp\n"
+    "hirado.nagasaki.jp\n"
+    "iki.nagasaki.jp\n"
+    "isahaya.nagasaki.jp\n"
+    "kawatana.nagasaki.jp\n"
+    "kuchinotsu.nagasaki.jp\n"
+    "matsuura.nagasaki.jp\n"
+    "nagasaki.nagasaki.jp\n"
+    "obama.nagasaki.jp\n"
+    "omura.nagasaki.jp\n"
+    "oseto.nagasaki.jp\n"
+    "saikai.nagasaki.jp\n"
+    "sasebo.nagasaki.jp\n"
+    "seihi.nagasaki.jp\n"
+    "shimabara.nagasaki.jp\n"
+    "shinkamigoto.nagasaki.jp\n"
+    "togitsu.nagasaki.jp\n"
+    "tsushima.nagasaki.jp\n"
+    "unzen.nagasaki.jp\n"
+    "ando.nara.jp\n"
+    "gose.nara.jp\n"
+    "heguri.nara.jp\n"
+    "higashiyoshino.nara.jp\n"
+    "ikaruga.nara.jp\n"
+    "ikoma.nara.jp\n"
+    "kamikitayama.nara.jp\n"
+    "kanmaki.nara.jp\n"
+    "kashiba.nara.jp\n"
+    "kashihara.nara.jp\n"
+    "katsuragi.nara.jp\n"
+    "kawai.nara.jp\n"
+    "kawakami.nara.jp\n"
+    "kawanishi.nara.jp\n"
+    "koryo.nara.jp\n"
+    "kurotaki.nara.jp\n"
+    "mitsue.nara.jp\n"
+    "miyake.nara.jp\n"
+    "nara.nara.jp\n"
+    "nosegawa.nara.jp\n"
+    "oji.nara.jp\n"
+    "ouda.nara.jp\n"
+    "oyodo.nara.jp\n"
+    "sakurai.nara.jp\n"
+    "sango.nara.jp\n"
+    "shimoichi.nara.jp\n"
+    "shimokitayama.nara.jp\n"
+    "shinjo.nara.jp\n"
+    "soni.nara.jp\n"
+    "takatori.nara.jp\n"
+    "tawaramoto.nara.jp\n"
+    "tenkawa.nara.jp\n"
+    "tenri.nara.jp\n"
+    "uda.nara.jp\n"
+    "yamatokoriyama.nara.jp\n"
+    "yamatotakada.nara.jp\n"
+    "yamazoe.nara.jp\n"
+    "yoshino.nara.jp\n"
+    "aga.niigata.jp\n"
+    "agano.niigata.jp\n"
+    "gosen.niigata.jp\n"
+    "itoigawa.niigata.jp\n"
+    "izumozaki.niigata.jp\n"
+    "joetsu.niigata.jp\n"
+    "kamo.niigata.jp\n"
+    "kariwa.niigata.jp\n"
+    "kashiwazaki.niigata.jp\n"
+    "minamiuonuma.niigata.jp\n"
+    "mitsuke.niigata.jp\n"
+    "muika.niigata.jp\n"
+    "murakami.niigata.jp\n"
+    "myoko.niigata.jp\n"
+    "nagaoka.niigata.jp\n"
+    "niigata.niigata.jp\n"
+    "ojiya.niigata.jp\n"
+    "omi.niigata.jp\n"
+    "sado.niigata.jp\n"
+    "sanjo.niigata.jp\n"
+    "seiro.niigata.jp\n"
+    "seirou.niigata.jp\n"
+    "sekikawa.niigata.jp\n"
+    "shibata.niigata.jp\n"
+    "tagami.niigata.jp\n"
+    "tainai.niigata.jp\n"
+    "tochio.niigata.jp\n"
+    "tokamachi.niigata.jp\n"
+    "tsubame.niigata.jp\n"
+    "tsunan.niigata.jp\n"
+    "uonuma.niigata.jp\n"
+    "yahiko.niigata.jp\n"
+    "yoita.niigata.jp\n"
+    "yuzawa.niigata.jp\n"
+    "beppu.oita.jp\n"
+    "bungoono.oita.jp\n"
+    "bungotakada.oita.jp\n"
+    "hasama.oita.jp\n"
+    "hiji.oita.jp\n"
+    "himeshima.oita.jp\n"
+    "hita.oita.jp\n"
+    "kamitsue.oita.jp\n"
+    "kokonoe.oita.jp\n"
+    "kuju.oita.jp\n"
+    "kunisaki.oita.jp\n"
+    "kusu.oita.jp\n"
+    "oita.oita.jp\n"
+    "saiki.oita.jp\n"
+    "taketa.oita.jp\n"
+    "tsukumi.oita.jp\n"
+    "usa.oita.jp\n"
+    "usuki.oita.jp\n"
+    "yufu.oita.jp\n"
+    "akaiwa.okayama.jp\n"
+    "asakuchi.okayama.jp\n"
+    "bizen.okayama.jp\n"
+    "hayashima.okayama.jp\n"
+    "ibara.okayama.jp\n"
+    "kagamino.okayama.jp\n"
+    "kasaoka.okayama.jp\n"
+    "kibichuo.okayama.jp\n"
+    "kumenan.okayama.jp\n"
+    "kurashiki.okayama.jp\n"
+    "maniwa.okayama.jp\n"
+    "misaki.okayama.jp\n"
+    "nagi.okayama.jp\n"
+    "niimi.okayama.jp\n"
+    "nishiawakura.okayama.jp\n"
+    "okayama.okayama.jp\n"
+    "satosho.okayama.jp\n"
+    "setouchi.okayama.jp\n"
+    "shinjo.okayama.jp\n"
+    "shoo.okayama.jp\n"
+    "soja.okayama.jp\n"
+    "takahashi.okayama.jp\n"
+    "tamano.okayama.jp\n"
+    "tsuyama.okayama.jp\n"
+    "wake.okayama.jp\n"
+    "yakage.okayama.jp\n"
+    "aguni.okinawa.jp\n"
+    "ginowan.okinawa.jp\n"
+    "ginoza.okinawa.jp\n"
+    "gushikami.okinawa.jp\n"
+    "haebaru.okinawa.jp\n",
+
+    "higashi.okinawa.jp\n"
+    "hirara.okinawa.jp\n"
+    "iheya.okinawa.jp\n"
+    "ishigaki.okinawa.jp\n"
+    "ishikawa.okinawa.jp\n"
+    "itoman.okinawa.jp\n"
+    "izena.okinawa.jp\n"
+    "kadena.okinawa.jp\n"
+    "kin.okinawa.jp\n"
+    "kitadaito.okinawa.jp\n"
+    "kitanakagusuku.okinawa.jp\n"
+    "kumejima.okinawa.jp\n"
+    "kunigami.okinawa.jp\n"
+    "minamidaito.okinawa.jp\n"
+    "motobu.okinawa.jp\n"
+    "nago.okinawa.jp\n"
+    "naha.okinawa.jp\n"
+    "nakagusuku.okinawa.jp\n"
+    "nakijin.okinawa.jp\n"
+    "nanjo.okinawa.jp\n"
+    "nishihara.okinawa.jp\n"
+    "ogimi.okinawa.jp\n"
+    "okinawa.okinawa.jp\n"
+    "onna.okinawa.jp\n"
+    "shimoji.okinawa.jp\n"
+    "taketomi.okinawa.jp\n"
+    "tarama.okinawa.jp\n"
+    "tokashiki.okinawa.jp\n"
+    "tomigusuku.okinawa.jp\n"
+    "tonaki.okinawa.jp\n"
+    "urasoe.okinawa.jp\n"
+    "uruma.okinawa.jp\n"
+    "yaese.okinawa.jp\n"
+    "yomitan.okinawa.jp\n"
+    "yonabaru.okinawa.jp\n"
+    "yonaguni.okinawa.jp\n"
+    "zamami.okinawa.jp\n"
+    "abeno.osaka.jp\n"
+    "chihayaakasaka.osaka.jp\n"
+    "chuo.osaka.jp\n"
+    "daito.osaka.jp\n"
+    "fujiidera.osaka.jp\n"
+    "habikino.osaka.jp\n"
+    "hannan.osaka.jp\n"
+    "higashiosaka.osaka.jp\n"
+    "higashisumiyoshi.osaka.jp\n"
+    "higashiyodogawa.osaka.jp\n"
+    "hirakata.osaka.jp\n"
+    "ibaraki.osaka.jp\n"
+    "ikeda.osaka.jp\n"
+    "izumi.osaka.jp\n"
+    "izumiotsu.osaka.jp\n"
+    "izumisano.osaka.jp\n"
+    "kadoma.osaka.jp\n"
+    "kaizuka.osaka.jp\n"
+    "kanan.osaka.jp\n"
+    "kashiwara.osaka.jp\n"
+    "katano.osaka.jp\n"
+    "kawachinagano.osaka.jp\n"
+    "kishiwada.osaka.jp\n"
+    "kita.osaka.jp\n"
+    "kumatori.osaka.jp\n"
+    "matsubara.osaka.jp\n"
+    "minato.osaka.jp\n"
+    "minoh.osaka.jp\n"
+    "misaki.osaka.jp\n"
+    "moriguchi.osaka.jp\n"
+    "neyagawa.osaka.jp\n"
+    "nishi.osaka.jp\n"
+    "nose.osaka.jp\n"
+    "osakasayama.osaka.jp\n"
+    "sakai.osaka.jp\n"
+    "sayama.osaka.jp\n"
+    "sennan.osaka.jp\n"
+    "settsu.osaka.jp\n"
+    "shijonawate.osaka.jp\n"
+    "shimamoto.osaka.jp\n"
+    "suita.osaka.jp\n"
+    "tadaoka.osaka.jp\n"
+    "taishi.osaka.jp\n"
+    "tajiri.osaka.jp\n"
+    "takaishi.osaka.jp\n"
+    "takatsuki.osaka.jp\n"
+    "tondabayashi.osaka.jp\n"
+    "toyonaka.osaka.jp\n"
+    "toyono.osaka.jp\n"
+    "yao.osaka.jp\n"
+    "ariake.saga.jp\n"
+    "arita.saga.jp\n"
+    "fukudomi.saga.jp\n"
+    "genkai.saga.jp\n"
+    "hamatama.saga.jp\n"
+    "hizen.saga.jp\n"
+    "imari.saga.jp\n"
+    "kamimine.saga.jp\n"
+    "kanzaki.saga.jp\n"
+    "karatsu.saga.jp\n"
+    "kashima.saga.jp\n"
+    "kitagata.saga.jp\n"
+    "kitahata.saga.jp\n"
+    "kiyama.saga.jp\n"
+    "kouhoku.saga.jp\n"
+    "kyuragi.saga.jp\n"
+    "nishiarita.saga.jp\n"
+    "ogi.saga.jp\n"
+    "omachi.saga.jp\n"
+    "ouchi.saga.jp\n"
+    "saga.saga.jp\n"
+    "shiroishi.saga.jp\n"
+    "taku.saga.jp\n"
+    "tara.saga.jp\n"
+    "tosu.saga.jp\n"
+    "yoshinogari.saga.jp\n"
+    "arakawa.saitama.jp\n"
+    "asaka.saitama.jp\n"
+    "chichibu.saitama.jp\n"
+    "fujimi.saitama.jp\n"
+    "fujimino.saitama.jp\n"
+    "fukaya.saitama.jp\n"
+    "hanno.saitama.jp\n"
+    "hanyu.saitama.jp\n"
+    "hasuda.saitama.jp\n"
+    "hatogaya.saitama.jp\n"
+    "hatoyama.saitama.jp\n"
+    "hidaka.saitama.jp\n"
+    "higashichichibu.saitama.jp\n"
+    "higashimatsuyama.saitama.jp\n"
+    "honjo.saitama.jp\n"
+    "ina.saitama.jp\n"
+    "iruma.saitama.jp\n"
+    "iwatsuki.saitama.jp\n"
+    "kamiizumi.saitama.jp\n"
+    "kamikawa.saitama.jp\n"
+    "kamisato.saitama.jp\n"
+    "kasukabe.saitama.jp\n"
+    "kawagoe.saitama.jp\n"
+    "kawaguchi.saitama.jp\n"
+    "kawajima.saitama.jp\n"
+    "kazo.saitama.jp\n"
+    "kitamoto.saitama.jp\n"
+    "koshigaya.saitama.jp\n"
+    "kounosu.saitama.jp\n"
+    "kuki.saitama.jp\n"
+    "kumagaya.saitama.jp\n"
+    "matsubushi.saitama.jp\n"
+    "minano.saitama.jp\n"
+    "misato.saitama.jp\n"
+    "miyashiro.saitama.jp\n"
+    "miyoshi.saitama.jp\n"
+    "moroyama.saitama.jp\n"
+    "nagatoro.saitama.jp\n"
+    "namegawa.saitama.jp\n"
+    "niiza.saitama.jp\n"
+    "ogano.saitama.jp\n"
+    "ogawa.saitama.jp\n"
+    "ogose.saitama.jp\n"
+    "okegawa.saitama.jp\n"
+    "omiya.saitama.jp\n"
+    "otaki.saitama.jp\n"
+    "ranzan.saitama.jp\n"
+    "ryokami.saitama.jp\n"
+    "saitama.saitama.jp\n"
+    "sakado.saitama.jp\n"
+    "satte.saitama.jp\n"
+    "sayama.saitama.jp\n"
+    "shiki.saitama.jp\n"
+    "shiraoka.saitama.jp\n"
+    "soka.saitama.jp\n"
+    "sugito.saitama.jp\n"
+    "toda.saitama.jp\n"
+    "tokigawa.saitama.jp\n"
+    "tokorozawa.saitama.jp\n"
+    "tsurugashima.saitama.jp\n"
+    "urawa.saitama.jp\n"
+    "warabi.saitama.jp\n"
+    "yashio.saitama.jp\n"
+    "yokoze.saitama.jp\n"
+    "yono.saitama.jp\n"
+    "yorii.saitama.jp\n"
+    "yoshida.saitama.jp\n"
+    "yoshikawa.saitama.jp\n"
+    "yoshimi.saitama.jp\n"
+    "aisho.shiga.jp\n"
+    "gamo.shiga.jp\n"
+    "higashiomi.shiga.jp\n"
+    "hikone.shiga.jp\n"
+    "koka.shiga.jp\n"
+    "konan.shiga.jp\n"
+    "kosei.shiga.jp\n"
+    "koto.shiga.jp\n"
+    "kusatsu.shiga.jp\n"
+    "maibara.shiga.jp\n"
+    "moriyama.shiga.jp\n"
+    "nagahama.shiga.jp\n"
+    "nishiazai.shiga.jp\n"
+    "notogawa.shiga.jp\n"
+    "omihachiman.shiga.jp\n"
+    "otsu.shiga.jp\n"
+    "ritto.shiga.jp\n"
+    "ryuoh.shiga.jp\n"
+    "takashima.shiga.jp\n"
+    "takatsuki.shiga.jp\n"
+    "torahime.shiga.jp\n"
+    "toyosato.shiga.jp\n"
+    "yasu.shiga.jp\n"
+    "akagi.shimane.jp\n"
+    "ama.shimane.jp\n"
+    "gotsu.shimane.jp\n"
+    "hamada.shimane.jp\n"
+    "higashiizumo.shimane.jp\n"
+    "hikawa.shimane.jp\n"
+    "hikimi.shimane.jp\n"
+    "izumo.shimane.jp\n"
+    "kakinoki.shimane.jp\n"
+    "masuda.shimane.jp\n"
+    "matsue.shimane.jp\n"
+    "misato.shimane.jp\n"
+    "nishinoshima.shimane.jp\n"
+    "ohda.shimane.jp\n"
+    "okinoshima.shimane.jp\n"
+    "okuizumo.shimane.jp\n"
+    "shimane.shimane.jp\n"
+    "tamayu.shimane.jp\n"
+    "tsuwano.shimane.jp\n"
+    "unnan.shimane.jp\n"
+    "yakumo.shimane.jp\n"
+    "yasugi.shimane.jp\n"
+    "yatsuka.shimane.jp\n"
+    "arai.shizuoka.jp\n"
+    "atami.shizuoka.jp\n"
+    "fuji.shizuoka.jp\n"
+    "fujieda.shizuoka.jp\n"
+    "fujikawa.shizuoka.jp\n"
+    "fujinomiya.shizuoka.jp\n"
+    "fukuroi.shizuoka.jp\n"
+    "gotemba.shizuoka.jp\n"
+    "haibara.shizuoka.jp\n"
+    "hamamatsu.shizuoka.jp\n"
+    "higashiizu.shizuoka.jp\n"
+    "ito.shizuoka.jp\n"
+    "iwata.shizuoka.jp\n"
+    "izu.shizuoka.jp\n"
+    "izunokuni.shizuoka.jp\n"
+    "kakegawa.shizuoka.jp\n"
+    "kannami.shizuoka.jp\n"
+    "kawanehon.shizuoka.jp\n"
+    "kawazu.shizuoka.jp\n"
+    "kikugawa.shizuoka.jp\n"
+    "kosai.shizuoka.jp\n"
+    "makinohara.shizuoka.jp\n"
+    "matsuzaki.shizuoka.jp\n"
+    "minamiizu.shizuoka.jp\n"
+    "mishima.shizuoka.jp\n"
+    "morimachi.shizuoka.jp\n"
+    "nishiizu.shizuoka.jp\n"
+    "numazu.shizuoka.jp\n"
+    "omaezaki.shizuoka.jp\n"
+    "shimada.shizuoka.jp\n"
+    "shimizu.shizuoka.jp\n"
+    "shimoda.shizuoka.jp\n"
+    "shizuoka.shizuoka.jp\n"
+    "susono.shizuoka.jp\n"
+    "yaizu.shizuoka.jp\n"
+    "yoshida.shizuoka.jp\n"
+    "ashikaga.tochigi.jp\n"
+    "bato.tochigi.jp\n"
+    "haga.tochigi.jp\n"
+    "ichikai.tochigi.jp\n"
+    "iwafune.tochigi.jp\n"
+    "kaminokawa.tochigi.jp\n"
+    "kanuma.tochigi.jp\n"
+    "karasuyama.tochigi.jp\n"
+    "kuroiso.tochigi.jp\n"
+    "mashiko.tochigi.jp\n"
+    "mibu.tochigi.jp\n"
+    "moka.tochigi.jp\n"
+    "motegi.tochigi.jp\n"
+    "nasu.tochigi.jp\n"
+    "nasushiobara.tochigi.jp\n"
+    "nikko.tochigi.jp\n"
+    "nishikata.tochigi.jp\n"
+    "nogi.tochigi.jp\n"
+    "ohira.tochigi.jp\n"
+    "ohtawara.tochigi.jp\n"
+    "oyama.tochigi.jp\n"
+    "sakura.tochigi.jp\n"
+    "sano.tochigi.jp\n"
+    "shimotsuke.tochigi.jp\n"
+    "shioya.tochigi.jp\n"
+    "takanezawa.tochigi.jp\n"
+    "tochigi.tochigi.jp\n"
+    "tsuga.tochigi.jp\n"
+    "ujiie.tochigi.jp\n"
+    "utsunomiya.tochigi.jp\n"
+    "yaita.tochigi.jp\n"
+    "aizumi.tokushima.jp\n"
+    "anan.tokushima.jp\n"
+    "ichiba.tokushima.jp\n"
+    "itano.tokushima.jp\n"
+    "kainan.tokushima.jp\n"
+    "komatsushima.tokushima.jp\n"
+    "matsushige.tokushima.jp\n"
+    "mima.tokushima.jp\n"
+    "minami.tokushima.jp\n"
+    "miyoshi.tokushima.jp\n"
+    "mugi.tokushima.jp\n"
+    "nakagawa.tokushima.jp\n"
+    "naruto.tokushima.jp\n"
+    "sanagochi.tokushima.jp\n"
+    "shishikui.tokushima.jp\n"
+    "tokushima.tokushima.jp\n"
+    "wajiki.tokushima.jp\n"
+    "adachi.tokyo.jp\n"
+    "akiruno.tokyo.jp\n"
+    "akishima.tokyo.jp\n"
+    "aogashima.tokyo.jp\n"
+    "arakawa.tokyo.jp\n"
+    "bunkyo.tokyo.jp\n"
+    "chiyoda.tokyo.jp\n"
+    "chofu.tokyo.jp\n"
+    "chuo.tokyo.jp\n"
+    "edogawa.tokyo.jp\n"
+    "fuchu.tokyo.jp\n"
+    "fussa.tokyo.jp\n"
+    "hachijo.tokyo.jp\n"
+    "hachioji.tokyo.jp\n"
+    "hamura.tokyo.jp\n"
+    "higashikurume.tokyo.jp\n"
+    "higashimurayama.tokyo.jp\n"
+    "higashiyamato.tokyo.jp\n"
+    "hino.tokyo.jp\n"
+    "hinode.tokyo.jp\n"
+    "hinohara.tokyo.jp\n"
+    "inagi.tokyo.jp\n"
+    "itabashi.tokyo.jp\n"
+    "katsushika.tokyo.jp\n"
+    "kita.tokyo.jp\n"
+    "kiyose.tokyo.jp\n"
+    "kodaira.tokyo.jp\n"
+    "koganei.tokyo.jp\n"
+    "kokubunji.tokyo.jp\n"
+    "komae.tokyo.jp\n"
+    "koto.tokyo.jp\n"
+    "kouzushima.tokyo.jp\n"
+    "kunitachi.tokyo.jp\n"
+    "machida.tokyo.jp\n"
+    "meguro.tokyo.jp\n"
+    "minato.tokyo.jp\n"
+    "mitaka.tokyo.jp\n"
+    "mizuho.tokyo.jp\n"
+    "musashimurayama.tokyo.jp\n"
+    "musashino.tokyo.jp\n"
+    "nakano.tokyo.jp\n"
+    "nerima.tokyo.jp\n"
+    "ogasawara.tokyo.jp\n"
+    "okutama.tokyo.jp\n"
+    "ome.tokyo.jp\n"
+    "oshima.tokyo.jp\n"
+    "ota.tokyo.jp\n"
+    "setagaya.tokyo.jp\n"
+    "shibuya.tokyo.jp\n"
+    "shinagawa.tokyo.jp\n"
+    "shinjuku.tokyo.jp\n"
+    "suginami.tokyo.jp\n"
+    "sumida.tokyo.jp\n"
+    "tachikawa.tokyo.jp\n"
+    "taito.tokyo.jp\n"
+    "tama.tokyo.jp\n"
+    "toshima.tokyo.jp\n"
+    "chizu.tottori.jp\n"
+    "hino.tottori.jp\n"
+    "kawahara.tottori.jp\n"
+    "koge.tottori.jp\n"
+    "kotoura.tottori.jp\n"
+    "misasa.tottori.jp\n"
+    "nanbu.tottori.jp\n"
+    "nichinan.tottori.jp\n"
+    "sakaiminato.tottori.jp\n"
+    "tottori.tottori.jp\n"
+    "wakasa.tottori.jp\n"
+    "yazu.tottori.jp\n"
+    "yonago.tottori.jp\n"
+    "asahi.toyama.jp\n"
+    "fuchu.toyama.jp\n"
+    "fukumitsu.toyama.jp\n"
+    "funahashi.toyama.jp\n"
+    "himi.toyama.jp\n"
+    "imizu.toyama.jp\n"
+    "inami.toyama.jp\n"
+    "johana.toyama.jp\n"
+    "kamiichi.toyama.jp\n"
+    "kurobe.toyama.jp\n"
+    "nakaniikawa.toyama.jp\n"
+    "namerikawa.toyama.jp\n"
+    "nanto.toyama.jp\n"
+    "nyuzen.toyama.jp\n"
+    "oyabe.toyama.jp\n"
+    "taira.toyama.jp\n"
+    "takaoka.toyama.jp\n"
+    "tateyama.toyama.jp\n"
+    "toga.toyama.jp\n"
+    "tonami.toyama.jp\n"
+    "toyama.toyama.jp\n"
+    "unazuki.toyama.jp\n"
+    "uozu.toyama.jp\n"
+    "yamada.toyama.jp\n"
+    "arida.wakayama.jp\n"
+    "aridagawa.wakayama.jp\n"
+    "gobo.wakayama.jp\n"
+    "hashimoto.wakayama.jp\n"
+    "hidaka.wakayama.jp\n"
+    "hirogawa.wakayama.jp\n"
+    "inami.wakayama.jp\n"
+    "iwade.wakayama.jp\n"
+    "kainan.wakayama.jp\n"
+    "kamitonda.wakayama.jp\n"
+    "katsuragi.wakayama.jp\n"
+    "kimino.wakayama.jp\n"
+    "kinokawa.wakayama.jp\n"
+    "kitayama.wakayama.jp\n"
+    "koya.wakayama.jp\n"
+    "koza.wakayama.jp\n"
+    "kozagawa.wakayama.jp\n"
+    "kudoyama.wakayama.jp\n"
+    "kushimoto.wakayama.jp\n"
+    "mihama.wakayama.jp\n"
+    "misato.wakayama.jp\n"
+    "nachikatsuura.wakayama.jp\n"
+    "shingu.wakayama.jp\n"
+    "shirahama.wakayama.jp\n"
+    "taiji.wakayama.jp\n"
+    "tanabe.wakayama.jp\n"
+    "wakayama.wakayama.jp\n"
+    "yuasa.wakayama.jp\n"
+    "yura.wakayama.jp\n"
+    "asahi.yamagata.jp\n"
+    "funagata.yamagata.jp\n"
+    "higashine.yamagata.jp\n"
+    "iide.yamagata.jp\n"
+    "kahoku.yamagata.jp\n"
+    "kaminoyama.yamagata.jp\n"
+    "kaneyama.yamagata.jp\n"
+    "kawanishi.yamagata.jp\n"
+    "mamurogawa.yamagata.jp\n"
+    "mikawa.yamagata.jp\n"
+    "murayama.yamagata.jp\n"
+    "nagai.yamagata.jp\n"
+    "nakayama.yamagata.jp\n"
+    "nanyo.yamagata.jp\n"
+    "nishikawa.yamagata.jp\n"
+    "obanazawa.yamagata.jp\n"
+    "oe.yamagata.jp\n"
+    "oguni.yamagata.jp\n"
+    "ohkura.yamagata.jp\n"
+    "oishida.yamagata.jp\n"
+    "sagae.yamagata.jp\n"
+    "sakata.yamagata.jp\n"
+    "sakegawa.yamagata.jp\n"
+    "shinjo.yamagata.jp\n"
+    "shirataka.yamagata.jp\n"
+    "shonai.yamagata.jp\n"
+    "takahata.yamagata.jp\n"
+    "tendo.yamagata.jp\n"
+    "tozawa.yamagata.jp\n"
+    "tsuruoka.yamagata.jp\n"
+    "yamagata.yamagata.jp\n"
+    "yamanobe.yamagata.jp\n"
+    "yonezawa.yamagata.jp\n"
+    "yuza.yamagata.jp\n"
+    "abu.yamaguchi.jp\n"
+    "hagi.yamaguchi.jp\n"
+    "hikari.yamaguchi.jp\n"
+    "hofu.yamaguchi.jp\n"
+    "iwakuni.yamaguchi.jp\n"
+    "kudamatsu.yamaguchi.jp\n"
+    "mitou.yamaguchi.jp\n"
+    "nagato.yamaguchi.jp\n"
+    "oshima.yamaguchi.jp\n"
+    "shimonoseki.yamaguchi.jp\n"
+    "shunan.yamaguchi.jp\n"
+    "tabuse.yamaguchi.jp\n"
+    "tokuyama.yamaguchi.jp\n"
+    "toyota.yamaguchi.jp\n"
+    "ube.yamaguchi.jp\n"
+    "yuu.yamaguchi.jp\n"
+    "chuo.yamanashi.jp\n"
+    "doshi.yamanashi.jp\n"
+    "fuefuki.yamanashi.jp\n"
+    "fujikawa.yamanashi.jp\n"
+    "fujikawaguchiko.yamanashi.jp\n"
+    "fujiyoshida.yamanashi.jp\n"
+    "hayakawa.yamanashi.jp\n"
+    "hokuto.yamanashi.jp\n"
+    "ichikawamisato.yamanashi.jp\n"
+    "kai.yamanashi.jp\n"
+    "kofu.yamanashi.jp\n"
+    "koshu.yamanashi.jp\n"
+    "kosuge.yamanashi.jp\n"
+    "minami-alps.yamanashi.jp\n"
+    "minobu.yamanashi.jp\n"
+    "nakamichi.yamanashi.jp\n"
+    "nanbu.yamanashi.jp\n"
+    "narusawa.yamanashi.jp\n"
+    "nirasaki.yamanashi.jp\n"
+    "nishikatsura.yamanashi.jp\n"
+    "oshino.yamanashi.jp\n"
+    "otsuki.yamanashi.jp\n"
+    "showa.yamanashi.jp\n"
+    "tabayama.yamanashi.jp\n"
+    "tsuru.yamanashi.jp\n"
+    "uenohara.yamanashi.jp\n"
+    "yamanakako.yamanashi.jp\n"
+    "yamanashi.yamanashi.jp\n"
+    "ke\n"
+    "ac.ke\n"
+    "co.ke\n"
+    "go.ke\n"
+    "info.ke\n"
+    "me.ke\n"
+    "mobi.ke\n"
+    "ne.ke\n"
+    "or.ke\n"
+    "sc.ke\n"
+    "kg\n"
+    "org.kg\n"
+    "net.kg\n"
+    "com.kg\n"
+    "edu.kg\n"
+    "gov.kg\n"
+    "mil.kg\n"
+    "*.kh\n"
+    "ki\n"
+    "edu.ki\n"
+    "biz.ki\n"
+    "net.ki\n"
+    "org.ki\n"
+    "gov.ki\n"
+    "info.ki\n"
+    "com.ki\n"
+    "km\n"
+    "org.km\n"
+    "nom.km\n"
+    "gov.km\n"
+    "prd.km\n"
+    "tm.km\n"
+    "edu.km\n"
+    "mil.km\n"
+    "ass.km\n"
+    "com.km\n"
+    "coop.km\n"
+    "asso.km\n"
+    "presse.km\n"
+    "medecin.km\n"
+    "notaires.km\n"
+    "pharmaciens.km\n"
+    "veterinaire.km\n"
+    "gouv.km\n"
+    "kn\n"
+    "net.kn\n"
+    "org.kn\n"
+    "edu.kn\n"
+    "gov.kn\n"
+    "kp\n"
+    "com.kp\n"
+    "edu.kp\n"
+    "gov.kp\n"
+    "org.kp\n"
+    "rep.kp\n"
+    "tra.kp\n"
+    "kr\n"
+    "ac.kr\n"
+    "co.kr\n"
+    "es.kr\n"
+    "go.kr\n"
+    "hs.kr\n"
+    "kg.kr\n"
+    "mil.kr\n"
+    "ms.kr\n"
+    "ne.kr\n"
+    "or.kr\n"
+    "pe.kr\n"
+    "re.kr\n"
+    "sc.kr\n"
+    "busan.kr\n"
+    "chungbuk.kr\n"
+    "chungnam.kr\n"
+    "daegu.kr\n"
+    "daejeon.kr\n"
+    "gangwon.kr\n"
+    "gwangju.kr\n"
+    "gyeongbuk.kr\n"
+    "gyeonggi.kr\n"
+    "gyeongnam.kr\n"
+    "incheon.kr\n"
+    "jeju.kr\n"
+    "jeonbuk.kr\n"
+    "jeonnam.kr\n"
+    "seoul.kr\n"
+    "ulsan.kr\n"
+    "kw\n"
+    "com.kw\n"
+    "edu.kw\n"
+    "emb.kw\n"
+    "gov.kw\n"
+    "ind.kw\n"
+    "net.kw\n"
+    "org.kw\n"
+    "ky\n"
+    "com.ky\n"
+    "edu.ky\n"
+    "net.ky\n"
+    "org.ky\n"
+    "kz\n"
+    "org.kz\n"
+    "edu.kz\n"
+    "net.kz\n"
+    "gov.kz\n"
+    "mil.kz\n"
+    "com.kz\n"
+    "la\n"
+    "int.la\n"
+    "net.la\n"
+    "info.la\n"
+    "edu.la\n"
+    "gov.la\n"
+    "per.la\n"
+    "com.la\n"
+    "org.la\n"
+    "lb\n"
+    "com.lb\n"
+    "edu.lb\n"
+    "gov.lb\n"
+    "net.lb\n"
+    "org.lb\n"
+    "lc\n"
+    "com.lc\n"
+    "net.lc\n"
+    "co.lc\n"
+    "org.lc\n"
+    "edu.lc\n"
+    "gov.lc\n"
+    "li\n"
+    "lk\n"
+    "gov.lk\n"
+    "sch.lk\n"
+    "net.lk\n"
+    "int.lk\n"
+    "com.lk\n"
+    "org.lk\n"
+    "edu.lk\n"
+    "ngo.lk\n"
+    "soc.lk\n"
+    "web.lk\n"
+    "ltd.lk\n"
+    "assn.lk\n"
+    "grp.lk\n"
+    "hotel.lk\n"
+    "ac.lk\n"
+    "lr\n"
+    "com.lr\n"
+    "edu.lr\n"
+    "gov.lr\n"
+    "org.lr\n"
+    "net.lr\n"
+    "ls\n"
+    "ac.ls\n"
+    "biz.ls\n"
+    "co.ls\n"
+    "edu.ls\n"
+    "gov.ls\n"
+    "info.ls\n"
+    "net.ls\n"
+    "org.ls\n"
+    "sc.ls\n"
+    "lt\n"
+    "gov.lt\n"
+    "lu\n"
+    "lv\n"
+    "com.lv\n"
+    "edu.lv\n"
+    "gov.lv\n"
+    "org.lv\n"
+    "mil.lv\n"
+    "id.lv\n"
+    "net.lv\n"
+    "asn.lv\n"
+    "conf.lv\n"
+    "ly\n"
+    "com.ly\n"
+    "net.ly\n"
+    "gov.ly\n"
+    "plc.ly\n"
+    "edu.ly\n"
+    "sch.ly\n"
+    "med.ly\n"
+    "org.ly\n"
+    "id.ly\n"
+    "ma\n"
+    "co.ma\n"
+    "net.ma\n"
+    "gov.ma\n"
+    "org.ma\n"
+    "ac.ma\n"
+    "press.ma\n"
+    "mc\n"
+    "tm.mc\n"
+    "asso.mc\n"
+    "md\n"
+    "me\n"
+    "co.me\n"
+    "net.me\n"
+    "org.me\n"
+    "edu.me\n"
+    "ac.me\n"
+    "gov.me\n"
+    "its.me\n"
+    "priv.me\n"
+    "mg\n"
+    "org.mg\n"
+    "nom.mg\n"
+    "gov.mg\n"
+    "prd.mg\n"
+    "tm.mg\n"
+    "edu.mg\n"
+    "mil.mg\n"
+    "com.mg\n"
+    "co.mg\n"
+    "mh\n"
+    "mil\n"
+    "mk\n"
+    "com.mk\n"
+    "org.mk\n"
+    "net.mk\n"
+    "edu.mk\n"
+    "gov.mk\n"
+    "inf.mk\n"
+    "name.mk\n"
+    "ml\n"
+    "com.ml\n"
+    "edu.ml\n"
+    "gouv.ml\n"
+    "gov.ml\n"
+    "net.ml\n"
+    "org.ml\n"
+    "presse.ml\n"
+    "*.mm\n"
+    "mn\n"
+    "gov.mn\n"
+    "edu.mn\n"
+    "org.mn\n"
+    "mo\n"
+    "com.mo\n"
+    "net.mo\n"
+    "org.mo\n"
+    "edu.mo\n"
+    "gov.mo\n"
+    "mobi\n"
+    "mp\n"
+    "mq\n"
+    "mr\n"
+    "gov.mr\n"
+    "ms\n"
+    "com.ms\n"
+    "edu.ms\n"
+    "gov.ms\n"
+    "net.ms\n"
+    "org.ms\n"
+    "mt\n"
+    "com.mt\n"
+    "edu.mt\n"
+    "net.mt\n"
+    "org.mt\n"
+    "mu\n"
+    "com.mu\n"
+    "net.mu\n"
+    "org.mu\n"
+    "gov.mu\n"
+    "ac.mu\n"
+    "co.mu\n"
+    "or.mu\n"
+    "museum\n"
+    "academy.museum\n"
+    "agriculture.museum\n"
+    "air.museum\n"
+    "airguard.museum\n"
+    "alabama.museum\n"
+    "alaska.museum\n"
+    "amber.museum\n"
+    "ambulance.museum\n"
+    "american.museum\n"
+    "americana.museum\n"
+    "americanantiques.museum\n"
+    "americanart.museum\n"
+    "amsterdam.museum\n"
+    "and.museum\n"
+    "annefrank.museum\n"
+    "anthro.museum\n"
+    "anthropology.museum\n"
+    "antiques.museum\n"
+    "aquarium.museum\n"
+    "arboretum.museum\n"
+    "archaeological.museum\n"
+    "archaeology.museum\n"
+    "architecture.museum\n"
+    "art.museum\n"
+    "artanddesign.museum\n"
+    "artcenter.museum\n"
+    "artdeco.museum\n"
+    "arteducation.museum\n"
+    "artgallery.museum\n"
+    "arts.museum\n"
+    "artsandcrafts.museum\n"
+    "asmatart.museum\n"
+    "assassination.museum\n"
+    "assisi.museum\n"
+    "association.museum\n"
+    "astronomy.museum\n"
+    "atlanta.museum\n"
+    "austin.museum\n"
+    "australia.museum\n",
+
+    "automotive.museum\n"
+    "aviation.museum\n"
+    "axis.museum\n"
+    "badajoz.museum\n"
+    "baghdad.museum\n"
+    "bahn.museum\n"
+    "bale.museum\n"
+    "baltimore.museum\n"
+    "barcelona.museum\n"
+    "baseball.museum\n"
+    "basel.museum\n"
+    "baths.museum\n"
+    "bauern.museum\n"
+    "beauxarts.museum\n"
+    "beeldengeluid.museum\n"
+    "bellevue.museum\n"
+    "bergbau.museum\n"
+    "berkeley.museum\n"
+    "berlin.museum\n"
+    "bern.museum\n"
+    "bible.museum\n"
+    "bilbao.museum\n"
+    "bill.museum\n"
+    "birdart.museum\n"
+    "birthplace.museum\n"
+    "bonn.museum\n"
+    "boston.museum\n"
+    "botanical.museum\n"
+    "botanicalgarden.museum\n"
+    "botanicgarden.museum\n"
+    "botany.museum\n"
+    "brandywinevalley.museum\n"
+    "brasil.museum\n"
+    "bristol.museum\n"
+    "british.museum\n"
+    "britishcolumbia.museum\n"
+    "broadcast.museum\n"
+    "brunel.museum\n"
+    "brussel.museum\n"
+    "brussels.museum\n"
+    "bruxelles.museum\n"
+    "building.museum\n"
+    "burghof.museum\n"
+    "bus.museum\n"
+    "bushey.museum\n"
+    "cadaques.museum\n"
+    "california.museum\n"
+    "cambridge.museum\n"
+    "can.museum\n"
+    "canada.museum\n"
+    "capebreton.museum\n"
+    "carrier.museum\n"
+    "cartoonart.museum\n"
+    "casadelamoneda.museum\n"
+    "castle.museum\n"
+    "castres.museum\n"
+    "celtic.museum\n"
+    "center.museum\n"
+    "chattanooga.museum\n"
+    "cheltenham.museum\n"
+    "chesapeakebay.museum\n"
+    "chicago.museum\n"
+    "children.museum\n"
+    "childrens.museum\n"
+    "childrensgarden.museum\n"
+    "chiropractic.museum\n"
+    "chocolate.museum\n"
+    "christiansburg.museum\n"
+    "cincinnati.museum\n"
+    "cinema.museum\n"
+    "circus.museum\n"
+    "civilisation.museum\n"
+    "civilization.museum\n"
+    "civilwar.museum\n"
+    "clinton.museum\n"
+    "clock.museum\n"
+    "coal.museum\n"
+    "coastaldefence.museum\n"
+    "cody.museum\n"
+    "coldwar.museum\n"
+    "collection.museum\n"
+    "colonialwilliamsburg.museum\n"
+    "coloradoplateau.museum\n"
+    "columbia.museum\n"
+    "columbus.museum\n"
+    "communication.museum\n"
+    "communications.museum\n"
+    "community.museum\n"
+    "computer.museum\n"
+    "computerhistory.museum\n"
+    "comunica\xc3\xa7\xc3\xb5" "es.museum\n"
+    "contemporary.museum\n"
+    "contemporaryart.museum\n"
+    "convent.museum\n"
+    "copenhagen.museum\n"
+    "corporation.museum\n"
+    "correios-e-telecomunica\xc3\xa7\xc3\xb5" "es.museum\n"
+    "corvette.museum\n"
+    "costume.museum\n"
+    "countryestate.museum\n"
+    "county.museum\n"
+    "crafts.museum\n"
+    "cranbrook.museum\n"
+    "creation.museum\n"
+    "cultural.museum\n"
+    "culturalcenter.museum\n"
+    "culture.museum\n"
+    "cyber.museum\n"
+    "cymru.museum\n"
+    "dali.museum\n"
+    "dallas.museum\n"
+    "database.museum\n"
+    "ddr.museum\n"
+    "decorativearts.museum\n"
+    "delaware.museum\n"
+    "delmenhorst.museum\n"
+    "denmark.museum\n"
+    "depot.museum\n"
+    "design.museum\n"
+    "detroit.museum\n"
+    "dinosaur.museum\n"
+    "discovery.museum\n"
+    "dolls.museum\n"
+    "donostia.museum\n"
+    "durham.museum\n"
+    "eastafrica.museum\n"
+    "eastcoast.museum\n"
+    "education.museum\n"
+    "educational.museum\n"
+    "egyptian.museum\n"
+    "eisenbahn.museum\n"
+    "elburg.museum\n"
+    "elvendrell.museum\n"
+    "embroidery.museum\n"
+    "encyclopedic.museum\n"
+    "england.museum\n"
+    "entomology.museum\n"
+    "environment.museum\n"
+    "environmentalconservation.museum\n"
+    "epilepsy.museum\n"
+    "essex.museum\n"
+    "estate.museum\n"
+    "ethnology.museum\n"
+    "exeter.museum\n"
+    "exhibition.museum\n"
+    "family.museum\n"
+    "farm.museum\n"
+    "farmequipment.museum\n"
+    "farmers.museum\n"
+    "farmstead.museum\n"
+    "field.museum\n"
+    "figueres.museum\n"
+    "filatelia.museum\n"
+    "film.museum\n"
+    "fineart.museum\n"
+    "finearts.museum\n"
+    "finland.museum\n"
+    "flanders.museum\n"
+    "florida.museum\n"
+    "force.museum\n"
+    "fortmissoula.museum\n"
+    "fortworth.museum\n"
+    "foundation.museum\n"
+    "francaise.museum\n"
+    "frankfurt.museum\n"
+    "franziskaner.museum\n"
+    "freemasonry.museum\n"
+    "freiburg.museum\n"
+    "fribourg.museum\n"
+    "frog.museum\n"
+    "fundacio.museum\n"
+    "furniture.museum\n"
+    "gallery.museum\n"
+    "garden.museum\n"
+    "gateway.museum\n"
+    "geelvinck.museum\n"
+    "gemological.museum\n"
+    "geology.museum\n"
+    "georgia.museum\n"
+    "giessen.museum\n"
+    "glas.museum\n"
+    "glass.museum\n"
+    "gorge.museum\n"
+    "grandrapids.museum\n"
+    "graz.museum\n"
+    "guernsey.museum\n"
+    "halloffame.museum\n"
+    "hamburg.museum\n"
+    "handson.museum\n"
+    "harvestcelebration.museum\n"
+    "hawaii.museum\n"
+    "health.museum\n"
+    "heimatunduhren.museum\n"
+    "hellas.museum\n"
+    "helsinki.museum\n"
+    "hembygdsforbund.museum\n"
+    "heritage.museum\n"
+    "histoire.museum\n"
+    "historical.museum\n"
+    "historicalsociety.museum\n"
+    "historichouses.museum\n"
+    "historisch.museum\n"
+    "historisches.museum\n"
+    "history.museum\n"
+    "historyofscience.museum\n"
+    "horology.museum\n"
+    "house.museum\n"
+    "humanities.museum\n"
+    "illustration.museum\n"
+    "imageandsound.museum\n"
+    "indian.museum\n"
+    "indiana.museum\n"
+    "indianapolis.museum\n"
+    "indianmarket.museum\n"
+    "intelligence.museum\n"
+    "interactive.museum\n"
+    "iraq.museum\n"
+    "iron.museum\n"
+    "isleofman.museum\n"
+    "jamison.museum\n"
+    "jefferson.museum\n"
+    "jerusalem.museum\n"
+    "jewelry.museum\n"
+    "jewish.museum\n"
+    "jewishart.museum\n"
+    "jfk.museum\n"
+    "journalism.museum\n"
+    "judaica.museum\n"
+    "judygarland.museum\n"
+    "juedisches.museum\n"
+    "juif.museum\n"
+    "karate.museum\n"
+    "karikatur.museum\n"
+    "kids.museum\n"
+    "koebenhavn.museum\n"
+    "koeln.museum\n"
+    "kunst.museum\n"
+    "kunstsammlung.museum\n"
+    "kunstunddesign.museum\n"
+    "labor.museum\n"
+    "labour.museum\n"
+    "lajolla.museum\n"
+    "lancashire.museum\n"
+    "landes.museum\n"
+    "lans.museum\n"
+    "l\xc3\xa4ns.museum\n"
+    "larsson.museum\n"
+    "lewismiller.museum\n"
+    "lincoln.museum\n"
+    "linz.museum\n"
+    "living.museum\n"
+    "livinghistory.museum\n"
+    "localhistory.museum\n"
+    "london.museum\n"
+    "losangeles.museum\n"
+    "louvre.museum\n"
+    "loyalist.museum\n"
+    "lucerne.museum\n"
+    "luxembourg.museum\n"
+    "luzern.museum\n"
+    "mad.museum\n"
+    "madrid.museum\n"
+    "mallorca.museum\n"
+    "manchester.museum\n"
+    "mansion.museum\n"
+    "mansions.museum\n"
+    "manx.museum\n"
+    "marburg.museum\n"
+    "maritime.museum\n"
+    "maritimo.museum\n"
+    "maryland.museum\n"
+    "marylhurst.museum\n"
+    "media.museum\n"
+    "medical.museum\n"
+    "medizinhistorisches.museum\n"
+    "meeres.museum\n"
+    "memorial.museum\n"
+    "mesaverde.museum\n"
+    "michigan.museum\n"
+    "midatlantic.museum\n"
+    "military.museum\n"
+    "mill.museum\n"
+    "miners.museum\n"
+    "mining.museum\n"
+    "minnesota.museum\n"
+    "missile.museum\n"
+    "missoula.museum\n"
+    "modern.museum\n"
+    "moma.museum\n"
+    "money.museum\n"
+    "monmouth.museum\n"
+    "monticello.museum\n"
+    "montreal.museum\n"
+    "moscow.museum\n"
+    "motorcycle.museum\n"
+    "muenchen.museum\n"
+    "muenster.museum\n"
+    "mulhouse.museum\n"
+    "muncie.museum\n"
+    "museet.museum\n"
+    "museumcenter.museum\n"
+    "museumvereniging.museum\n"
+    "music.museum\n"
+    "national.museum\n"
+    "nationalfirearms.museum\n"
+    "nationalheritage.museum\n"
+    "nativeamerican.museum\n"
+    "naturalhistory.museum\n"
+    "naturalhistorymuseum.museum\n"
+    "naturalsciences.museum\n"
+    "nature.museum\n"
+    "naturhistorisches.museum\n"
+    "natuurwetenschappen.museum\n"
+    "naumburg.museum\n"
+    "naval.museum\n"
+    "nebraska.museum\n"
+    "neues.museum\n"
+    "newhampshire.museum\n"
+    "newjersey.museum\n"
+    "newmexico.museum\n"
+    "newport.museum\n"
+    "newspaper.museum\n"
+    "newyork.museum\n"
+    "niepce.museum\n"
+    "norfolk.museum\n"
+    "north.museum\n"
+    "nrw.museum\n"
+    "nyc.museum\n"
+    "nyny.museum\n"
+    "oceanographic.museum\n"
+    "oceanographique.museum\n"
+    "omaha.museum\n"
+    "online.museum\n"
+    "ontario.museum\n"
+    "openair.museum\n"
+    "oregon.museum\n"
+    "oregontrail.museum\n"
+    "otago.museum\n"
+    "oxford.museum\n"
+    "pacific.museum\n"
+    "paderborn.museum\n"
+    "palace.museum\n"
+    "paleo.museum\n"
+    "palmsprings.museum\n"
+    "panama.museum\n"
+    "paris.museum\n"
+    "pasadena.museum\n"
+    "pharmacy.museum\n"
+    "philadelphia.museum\n"
+    "philadelphiaarea.museum\n"
+    "philately.museum\n"
+    "phoenix.museum\n"
+    "photography.museum\n"
+    "pilots.museum\n"
+    "pittsburgh.museum\n"
+    "planetarium.museum\n"
+    "plantation.museum\n"
+    "plants.museum\n"
+    "plaza.museum\n"
+    "portal.museum\n"
+    "portland.museum\n"
+    "portlligat.museum\n"
+    "posts-and-telecommunications.museum\n"
+    "preservation.museum\n"
+    "presidio.museum\n"
+    "press.museum\n"
+    "project.museum\n"
+    "public.museum\n"
+    "pubol.museum\n"
+    "quebec.museum\n"
+    "railroad.museum\n"
+    "railway.museum\n"
+    "research.museum\n"
+    "resistance.museum\n"
+    "riodejaneiro.museum\n"
+    "rochester.museum\n"
+    "rockart.museum\n"
+    "roma.museum\n"
+    "russia.museum\n"
+    "saintlouis.museum\n"
+    "salem.museum\n"
+    "salvadordali.museum\n"
+    "salzburg.museum\n"
+    "sandiego.museum\n"
+    "sanfrancisco.museum\n"
+    "santabarbara.museum\n"
+    "santacruz.museum\n"
+    "santafe.museum\n"
+    "saskatchewan.museum\n"
+    "satx.museum\n"
+    "savannahga.museum\n"
+    "schlesisches.museum\n"
+    "schoenbrunn.museum\n"
+    "schokoladen.museum\n"
+    "school.museum\n"
+    "schweiz.museum\n"
+    "science.museum\n"
+    "scienceandhistory.museum\n"
+    "scienceandindustry.museum\n"
+    "sciencecenter.museum\n"
+    "sciencecenters.museum\n"
+    "science-fiction.museum\n"
+    "sciencehistory.museum\n"
+    "sciences.museum\n"
+    "sciencesnaturelles.museum\n"
+    "scotland.museum\n"
+    "seaport.museum\n"
+    "settlement.museum\n"
+    "settlers.museum\n"
+    "shell.museum\n"
+    "sherbrooke.museum\n"
+    "sibenik.museum\n"
+    "silk.museum\n"
+    "ski.museum\n"
+    "skole.museum\n"
+    "society.museum\n"
+    "sologne.museum\n"
+    "soundandvision.museum\n"
+    "southcarolina.museum\n"
+    "southwest.museum\n"
+    "space.museum\n"
+    "spy.museum\n"
+    "square.museum\n"
+    "stadt.museum\n"
+    "stalbans.museum\n"
+    "starnberg.museum\n"
+    "state.museum\n"
+    "stateofdelaware.museum\n"
+    "station.museum\n"
+    "steam.museum\n"
+    "steiermark.museum\n"
+    "stjohn.museum\n"
+    "stockholm.museum\n"
+    "stpetersburg.museum\n"
+    "stuttgart.museum\n"
+    "suisse.museum\n"
+    "surgeonshall.museum\n"
+    "surrey.museum\n"
+    "svizzera.museum\n"
+    "sweden.museum\n"
+    "sydney.museum\n"
+    "tank.museum\n"
+    "tcm.museum\n"
+    "technology.museum\n"
+    "telekommunikation.museum\n"
+    "television.museum\n"
+    "texas.museum\n"
+    "textile.museum\n"
+    "theater.museum\n"
+    "time.museum\n"
+    "timekeeping.museum\n"
+    "topology.museum\n"
+    "torino.museum\n"
+    "touch.museum\n"
+    "town.museum\n"
+    "transport.museum\n"
+    "tree.museum\n"
+    "trolley.museum\n"
+    "trust.museum\n"
+    "trustee.museum\n"
+    "uhren.museum\n"
+    "ulm.museum\n"
+    "undersea.museum\n"
+    "university.museum\n"
+    "usa.museum\n"
+    "usantiques.museum\n"
+    "usarts.museum\n"
+    "uscountryestate.museum\n"
+    "usculture.museum\n"
+    "usdecorativearts.museum\n"
+    "usgarden.museum\n"
+    "ushistory.museum\n"
+    "ushuaia.museum\n"
+    "uslivinghistory.museum\n"
+    "utah.museum\n"
+    "uvic.museum\n"
+    "valley.museum\n"
+    "vantaa.museum\n"
+    "versailles.museum\n"
+    "viking.museum\n"
+    "village.museum\n"
+    "virginia.museum\n"
+    "virtual.museum\n"
+    "virtuel.museum\n"
+    "vlaanderen.museum\n"
+    "volkenkunde.museum\n"
+    "wales.museum\n"
+    "wallonie.museum\n"
+    "war.museum\n"
+    "washingtondc.museum\n"
+    "watchandclock.museum\n"
+    "watch-and-clock.museum\n"
+    "western.museum\n"
+    "westfalen.museum\n"
+    "whaling.museum\n"
+    "wildlife.museum\n"
+    "williamsburg.museum\n"
+    "windmill.museum\n"
+    "workshop.museum\n"
+    "york.museum\n"
+    "yorkshire.museum\n"
+    "yosemite.museum\n"
+    "youth.museum\n"
+    "zoological.museum\n"
+    "zoology.museum\n"
+    "\xd7\x99\xd7\xa8\xd7\x95\xd7\xa9\xd7\x9c\xd7\x99\xd7\x9d.museum\n"
+    "\xd0\xb8\xd0\xba\xd0\xbe\xd0\xbc.museum\n"
+    "mv\n"
+    "aero.mv\n"
+    "biz.mv\n"
+    "com.mv\n"
+    "coop.mv\n"
+    "edu.mv\n"
+    "gov.mv\n"
+    "info.mv\n"
+    "int.mv\n"
+    "mil.mv\n"
+    "museum.mv\n"
+    "name.mv\n"
+    "net.mv\n"
+    "org.mv\n"
+    "pro.mv\n"
+    "mw\n"
+    "ac.mw\n"
+    "biz.mw\n"
+    "co.mw\n"
+    "com.mw\n"
+    "coop.mw\n"
+    "edu.mw\n"
+    "gov.mw\n"
+    "int.mw\n"
+    "museum.mw\n"
+    "net.mw\n"
+    "org.mw\n"
+    "mx\n"
+    "com.mx\n"
+    "org.mx\n"
+    "gob.mx\n"
+    "edu.mx\n"
+    "net.mx\n"
+    "my\n"
+    "biz.my\n"
+    "com.my\n"
+    "edu.my\n"
+    "gov.my\n"
+    "mil.my\n"
+    "name.my\n"
+    "net.my\n"
+    "org.my\n"
+    "mz\n"
+    "ac.mz\n"
+    "adv.mz\n"
+    "co.mz\n"
+    "edu.mz\n"
+    "gov.mz\n"
+    "mil.mz\n"
+    "net.mz\n"
+    "org.mz\n"
+    "na\n"
+    "info.na\n"
+    "pro.na\n"
+    "name.na\n"
+    "school.na\n"
+    "or.na\n"
+    "dr.na\n"
+    "us.na\n"
+    "mx.na\n"
+    "ca.na\n"
+    "in.na\n"
+    "cc.na\n"
+    "tv.na\n"
+    "ws.na\n"
+    "mobi.na\n"
+    "co.na\n"
+    "com.na\n"
+    "org.na\n"
+    "name\n"
+    "nc\n"
+    "asso.nc\n"
+    "nom.nc\n"
+    "ne\n"
+    "net\n"
+    "nf\n"
+    "com.nf\n"
+    "net.nf\n"
+    "per.nf\n"
+    "rec.nf\n"
+    "web.nf\n"
+    "arts.nf\n"
+    "firm.nf\n"
+    "info.nf\n"
+    "other.nf\n"
+    "store.nf\n"
+    "ng\n"
+    "com.ng\n"
+    "edu.ng\n"
+    "gov.ng\n"
+    "i.ng\n"
+    "mil.ng\n"
+    "mobi.ng\n"
+    "name.ng\n"
+    "net.ng\n"
+    "org.ng\n"
+    "sch.ng\n"
+    "ni\n"
+    "ac.ni\n"
+    "biz.ni\n"
+    "co.ni\n"
+    "com.ni\n"
+    "edu.ni\n"
+    "gob.ni\n"
+    "in.ni\n"
+    "info.ni\n"
+    "int.ni\n"
+    "mil.ni\n"
+    "net.ni\n"
+    "nom.ni\n"
+    "org.ni\n"
+    "web.ni\n"
+    "nl\n"
+    "no\n"
+    "fhs.no\n"
+    "vgs.no\n"
+    "fylkesbibl.no\n"
+    "folkebibl.no\n"
+    "museum.no\n"
+    "idrett.no\n"
+    "priv.no\n"
+    "mil.no\n"
+    "stat.no\n"
+    "dep.no\n"
+    "kommune.no\n"
+    "herad.no\n"
+    "aa.no\n"
+    "ah.no\n"
+    "bu.no\n"
+    "fm.no\n"
+    "hl.no\n"
+    "hm.no\n"
+    "jan-mayen.no\n"
+    "mr.no\n"
+    "nl.no\n"
+    "nt.no\n"
+    "of.no\n"
+    "ol.no\n"
+    "oslo.no\n"
+    "rl.no\n"
+    "sf.no\n"
+    "st.no\n"
+    "svalbard.no\n"
+    "tm.no\n"
+    "tr.no\n"
+    "va.no\n"
+    "vf.no\n"
+    "gs.aa.no\n"
+    "gs.ah.no\n"
+    "gs.bu.no\n"
+    "gs.fm.no\n"
+    "gs.hl.no\n"
+    "gs.hm.no\n"
+    "gs.jan-mayen.no\n"
+    "gs.mr.no\n"
+    "gs.nl.no\n"
+    "gs.nt.no\n"
+    "gs.of.no\n"
+    "gs.ol.no\n"
+    "gs.oslo.no\n"
+    "gs.rl.no\n"
+    "gs.sf.no\n"
+    "gs.st.no\n"
+    "gs.svalbard.no\n"
+    "gs.tm.no\n"
+    "gs.tr.no\n"
+    "gs.va.no\n"
+    "gs.vf.no\n"
+    "akrehamn.no\n"
+    "\xc3\xa5krehamn.no\n"
+    "algard.no\n"
+    "\xc3\xa5lg\xc3\xa5rd.no\n"
+    "arna.no\n"
+    "brumunddal.no\n"
+    "bryne.no\n"
+    "bronnoysund.no\n"
+    "br\xc3\xb8nn\xc3\xb8ysund.no\n"
+    "drobak.no\n"
+    "dr\xc3\xb8" "bak.no\n"
+    "egersund.no\n"
+    "fetsund.no\n"
+    "floro.no\n"
+    "flor\xc3\xb8.no\n"
+    "fredrikstad.no\n"
+    "hokksund.no\n"
+    "honefoss.no\n"
+    "h\xc3\xb8nefoss.no\n"
+    "jessheim.no\n"
+    "jorpeland.no\n"
+    "j\xc3\xb8rpeland.no\n"
+    "kirkenes.no\n"
+    "kopervik.no\n"
+    "krokstadelva.no\n"
+    "langevag.no\n"
+    "langev\xc3\xa5g.no\n"
+    "leirvik.no\n"
+    "mjondalen.no\n"
+    "mj\xc3\xb8ndalen.no\n"
+    "mo-i-rana.no\n"
+    "mosjoen.no\n"
+    "mosj\xc3\xb8" "en.no\n"
+    "nesoddtangen.no\n"
+    "orkanger.no\n"
+    "osoyro.no\n"
+    "os\xc3\xb8yro.no\n"
+    "raholt.no\n"
+    "r\xc3\xa5holt.no\n"
+    "sandnessjoen.no\n"
+    "sandnessj\xc3\xb8" "en.no\n"
+    "skedsmokorset.no\n"
+    "slattum.no\n"
+    "spjelkavik.no\n"
+    "stathelle.no\n"
+    "stavern.no\n"
+    "stjordalshalsen.no\n"
+    "stj\xc3\xb8rdalshalsen.no\n"
+    "tananger.no\n"
+    "tranby.no\n"
+    "vossevangen.no\n"
+    "afjord.no\n"
+    "\xc3\xa5" "fjord.no\n"
+    "agdenes.no\n"
+    "al.no\n"
+    "\xc3\xa5l.no\n"
+    "alesund.no\n"
+    "\xc3\xa5lesund.no\n"
+    "alstahaug.no\n"
+    "alta.no\n"
+    "\xc3\xa1lt\xc3\xa1.no\n"
+    "alaheadju.no\n"
+    "\xc3\xa1laheadju.no\n"
+    "alvdal.no\n"
+    "amli.no\n"
+    "\xc3\xa5mli.no\n"
+    "amot.no\n"
+    "\xc3\xa5mot.no\n"
+    "andebu.no\n"
+    "andoy.no\n"
+    "and\xc3\xb8y.no\n"
+    "andasuolo.no\n"
+    "ardal.no\n"
+    "\xc3\xa5rdal.no\n"
+    "aremark.no\n"
+    "arendal.no\n"
+    "\xc3\xa5s.no\n"
+    "aseral.no\n"
+    "\xc3\xa5seral.no\n"
+    "asker.no\n"
+    "askim.no\n"
+    "askvoll.no\n"
+    "askoy.no\n"
+    "ask\xc3\xb8y.no\n"
+    "asnes.no\n"
+    "\xc3\xa5snes.no\n"
+    "audnedaln.no\n"
+    "aukra.no\n"
+    "aure.no\n"
+    "aurland.no\n"
+    "aurskog-holand.no\n"
+    "aurskog-h\xc3\xb8land.no\n"
+    "austevoll.no\n"
+    "austrheim.no\n"
+    "averoy.no\n"
+    "aver\xc3\xb8y.no\n"
+    "balestrand.no\n"
+    "ballangen.no\n"
+    "balat.no\n"
+    "b\xc3\xa1l\xc3\xa1t.no\n"
+    "balsfjord.no\n"
+    "bahccavuotna.no\n"
+    "b\xc3\xa1hccavuotna.no\n"
+    "bamble.no\n"
+    "bardu.no\n"
+    "beardu.no\n"
+    "beiarn.no\n"
+    "bajddar.no\n"
+    "b\xc3\xa1jddar.no\n"
+    "baidar.no\n"
+    "b\xc3\xa1id\xc3\xa1r.no\n"
+    "berg.no\n"
+    "bergen.no\n"
+    "berlevag.no\n"
+    "berlev\xc3\xa5g.no\n"
+    "bearalvahki.no\n"
+    "bearalv\xc3\xa1hki.no\n"
+    "bindal.no\n"
+    "birkenes.no\n"
+    "bjarkoy.no\n"
+    "bjark\xc3\xb8y.no\n"
+    "bjerkreim.no\n"
+    "bjugn.no\n"
+    "bodo.no\n"
+    "bod\xc3\xb8.no\n"
+    "badaddja.no\n"
+    "b\xc3\xa5" "d\xc3\xa5" "ddj\xc3\xa5.no\n"
+    "budejju.no\n"
+    "bokn.no\n"
+    "bremanger.no\n"
+    "bronnoy.no\n"
+    "br\xc3\xb8nn\xc3\xb8y.no\n"
+    "bygland.no\n"
+    "bykle.no\n"
+    "barum.no\n"
+    "b\xc3\xa6rum.no\n"
+    "bo.telemark.no\n"
+    "b\xc3\xb8.telemark.no\n"
+    "bo.nordland.no\n"
+    "b\xc3\xb8.nordland.no\n"
+    "bievat.no\n"
+    "biev\xc3\xa1t.no\n"
+    "bomlo.no\n"
+    "b\xc3\xb8mlo.no\n"
+    "batsfjord.no\n"
+    "b\xc3\xa5tsfjord.no\n"
+    "bahcavuotna.no\n"
+    "b\xc3\xa1hcavuotna.no\n"
+    "dovre.no\n"
+    "drammen.no\n"
+    "drangedal.no\n"
+    "dyroy.no\n"
+    "dyr\xc3\xb8y.no\n"
+    "donna.no\n"
+    "d\xc3\xb8nna.no\n"
+    "eid.no\n"
+    "eidfjord.no\n"
+    "eidsberg.no\n"
+    "eidskog.no\n"
+    "eidsvoll.no\n"
+    "eigersund.no\n"
+    "elverum.no\n"
+    "enebakk.no\n"
+    "engerdal.no\n"
+    "etne.no\n"
+    "etnedal.no\n"
+    "evenes.no\n"
+    "evenassi.no\n"
+    "even\xc3\xa1\xc5\xa1\xc5\xa1i.no\n"
+    "evje-og-hornnes.no\n"
+    "farsund.no\n"
+    "fauske.no\n"
+    "fuossko.no\n"
+    "fuoisku.no\n"
+    "fedje.no\n"
+    "fet.no\n"
+    "finnoy.no\n"
+    "finn\xc3\xb8y.no\n"
+    "fitjar.no\n"
+    "fjaler.no\n"
+    "fjell.no\n"
+    "flakstad.no\n"
+    "flatanger.no\n"
+    "flekkefjord.no\n"
+    "flesberg.no\n"
+    "flora.no\n"
+    "fla.no\n"
+    "fl\xc3\xa5.no\n"
+    "folldal.no\n"
+    "forsand.no\n"
+    "fosnes.no\n"
+    "frei.no\n"
+    "frogn.no\n"
+    "froland.no\n"
+    "frosta.no\n"
+    "frana.no\n"
+    "fr\xc3\xa6na.no\n"
+    "froya.no\n"
+    "fr\xc3\xb8ya.no\n"
+    "fusa.no\n"
+    "fyresdal.no\n"
+    "forde.no\n"
+    "f\xc3\xb8rde.no\n"
+    "gamvik.no\n"
+    "gangaviika.no\n"
+    "g\xc3\xa1\xc5\x8bgaviika.no\n"
+    "gaular.no\n"
+    "gausdal.no\n"
+    "gildeskal.no\n"
+    "gildesk\xc3\xa5l.no\n"
+    "giske.no\n"
+    "gjemnes.no\n",
+
+    "gjerdrum.no\n"
+    "gjerstad.no\n"
+    "gjesdal.no\n"
+    "gjovik.no\n"
+    "gj\xc3\xb8vik.no\n"
+    "gloppen.no\n"
+    "gol.no\n"
+    "gran.no\n"
+    "grane.no\n"
+    "granvin.no\n"
+    "gratangen.no\n"
+    "grimstad.no\n"
+    "grong.no\n"
+    "kraanghke.no\n"
+    "kr\xc3\xa5" "anghke.no\n"
+    "grue.no\n"
+    "gulen.no\n"
+    "hadsel.no\n"
+    "halden.no\n"
+    "halsa.no\n"
+    "hamar.no\n"
+    "hamaroy.no\n"
+    "habmer.no\n"
+    "h\xc3\xa1" "bmer.no\n"
+    "hapmir.no\n"
+    "h\xc3\xa1pmir.no\n"
+    "hammerfest.no\n"
+    "hammarfeasta.no\n"
+    "h\xc3\xa1mm\xc3\xa1rfeasta.no\n"
+    "haram.no\n"
+    "hareid.no\n"
+    "harstad.no\n"
+    "hasvik.no\n"
+    "aknoluokta.no\n"
+    "\xc3\xa1k\xc5\x8boluokta.no\n"
+    "hattfjelldal.no\n"
+    "aarborte.no\n"
+    "haugesund.no\n"
+    "hemne.no\n"
+    "hemnes.no\n"
+    "hemsedal.no\n"
+    "heroy.more-og-romsdal.no\n"
+    "her\xc3\xb8y.m\xc3\xb8re-og-romsdal.no\n"
+    "heroy.nordland.no\n"
+    "her\xc3\xb8y.nordland.no\n"
+    "hitra.no\n"
+    "hjartdal.no\n"
+    "hjelmeland.no\n"
+    "hobol.no\n"
+    "hob\xc3\xb8l.no\n"
+    "hof.no\n"
+    "hol.no\n"
+    "hole.no\n"
+    "holmestrand.no\n"
+    "holtalen.no\n"
+    "holt\xc3\xa5len.no\n"
+    "hornindal.no\n"
+    "horten.no\n"
+    "hurdal.no\n"
+    "hurum.no\n"
+    "hvaler.no\n"
+    "hyllestad.no\n"
+    "hagebostad.no\n"
+    "h\xc3\xa6gebostad.no\n"
+    "hoyanger.no\n"
+    "h\xc3\xb8yanger.no\n"
+    "hoylandet.no\n"
+    "h\xc3\xb8ylandet.no\n"
+    "ha.no\n"
+    "h\xc3\xa5.no\n"
+    "ibestad.no\n"
+    "inderoy.no\n"
+    "inder\xc3\xb8y.no\n"
+    "iveland.no\n"
+    "jevnaker.no\n"
+    "jondal.no\n"
+    "jolster.no\n"
+    "j\xc3\xb8lster.no\n"
+    "karasjok.no\n"
+    "karasjohka.no\n"
+    "k\xc3\xa1r\xc3\xa1\xc5\xa1johka.no\n"
+    "karlsoy.no\n"
+    "galsa.no\n"
+    "g\xc3\xa1ls\xc3\xa1.no\n"
+    "karmoy.no\n"
+    "karm\xc3\xb8y.no\n"
+    "kautokeino.no\n"
+    "guovdageaidnu.no\n"
+    "klepp.no\n"
+    "klabu.no\n"
+    "kl\xc3\xa6" "bu.no\n"
+    "kongsberg.no\n"
+    "kongsvinger.no\n"
+    "kragero.no\n"
+    "krager\xc3\xb8.no\n"
+    "kristiansand.no\n"
+    "kristiansund.no\n"
+    "krodsherad.no\n"
+    "kr\xc3\xb8" "dsherad.no\n"
+    "kvalsund.no\n"
+    "rahkkeravju.no\n"
+    "r\xc3\xa1hkker\xc3\xa1vju.no\n"
+    "kvam.no\n"
+    "kvinesdal.no\n"
+    "kvinnherad.no\n"
+    "kviteseid.no\n"
+    "kvitsoy.no\n"
+    "kvits\xc3\xb8y.no\n"
+    "kvafjord.no\n"
+    "kv\xc3\xa6" "fjord.no\n"
+    "giehtavuoatna.no\n"
+    "kvanangen.no\n"
+    "kv\xc3\xa6nangen.no\n"
+    "navuotna.no\n"
+    "n\xc3\xa1vuotna.no\n"
+    "kafjord.no\n"
+    "k\xc3\xa5" "fjord.no\n"
+    "gaivuotna.no\n"
+    "g\xc3\xa1ivuotna.no\n"
+    "larvik.no\n"
+    "lavangen.no\n"
+    "lavagis.no\n"
+    "loabat.no\n"
+    "loab\xc3\xa1t.no\n"
+    "lebesby.no\n"
+    "davvesiida.no\n"
+    "leikanger.no\n"
+    "leirfjord.no\n"
+    "leka.no\n"
+    "leksvik.no\n"
+    "lenvik.no\n"
+    "leangaviika.no\n"
+    "lea\xc5\x8bgaviika.no\n"
+    "lesja.no\n"
+    "levanger.no\n"
+    "lier.no\n"
+    "lierne.no\n"
+    "lillehammer.no\n"
+    "lillesand.no\n"
+    "lindesnes.no\n"
+    "lindas.no\n"
+    "lind\xc3\xa5s.no\n"
+    "lom.no\n"
+    "loppa.no\n"
+    "lahppi.no\n"
+    "l\xc3\xa1hppi.no\n"
+    "lund.no\n"
+    "lunner.no\n"
+    "luroy.no\n"
+    "lur\xc3\xb8y.no\n"
+    "luster.no\n"
+    "lyngdal.no\n"
+    "lyngen.no\n"
+    "ivgu.no\n"
+    "lardal.no\n"
+    "lerdal.no\n"
+    "l\xc3\xa6rdal.no\n"
+    "lodingen.no\n"
+    "l\xc3\xb8" "dingen.no\n"
+    "lorenskog.no\n"
+    "l\xc3\xb8renskog.no\n"
+    "loten.no\n"
+    "l\xc3\xb8ten.no\n"
+    "malvik.no\n"
+    "masoy.no\n"
+    "m\xc3\xa5s\xc3\xb8y.no\n"
+    "muosat.no\n"
+    "muos\xc3\xa1t.no\n"
+    "mandal.no\n"
+    "marker.no\n"
+    "marnardal.no\n"
+    "masfjorden.no\n"
+    "meland.no\n"
+    "meldal.no\n"
+    "melhus.no\n"
+    "meloy.no\n"
+    "mel\xc3\xb8y.no\n"
+    "meraker.no\n"
+    "mer\xc3\xa5ker.no\n"
+    "moareke.no\n"
+    "mo\xc3\xa5reke.no\n"
+    "midsund.no\n"
+    "midtre-gauldal.no\n"
+    "modalen.no\n"
+    "modum.no\n"
+    "molde.no\n"
+    "moskenes.no\n"
+    "moss.no\n"
+    "mosvik.no\n"
+    "malselv.no\n"
+    "m\xc3\xa5lselv.no\n"
+    "malatvuopmi.no\n"
+    "m\xc3\xa1latvuopmi.no\n"
+    "namdalseid.no\n"
+    "aejrie.no\n"
+    "namsos.no\n"
+    "namsskogan.no\n"
+    "naamesjevuemie.no\n"
+    "n\xc3\xa5\xc3\xa5mesjevuemie.no\n"
+    "laakesvuemie.no\n"
+    "nannestad.no\n"
+    "narvik.no\n"
+    "narviika.no\n"
+    "naustdal.no\n"
+    "nedre-eiker.no\n"
+    "nes.akershus.no\n"
+    "nes.buskerud.no\n"
+    "nesna.no\n"
+    "nesodden.no\n"
+    "nesseby.no\n"
+    "unjarga.no\n"
+    "unj\xc3\xa1rga.no\n"
+    "nesset.no\n"
+    "nissedal.no\n"
+    "nittedal.no\n"
+    "nord-aurdal.no\n"
+    "nord-fron.no\n"
+    "nord-odal.no\n"
+    "norddal.no\n"
+    "nordkapp.no\n"
+    "davvenjarga.no\n"
+    "davvenj\xc3\xa1rga.no\n"
+    "nordre-land.no\n"
+    "nordreisa.no\n"
+    "raisa.no\n"
+    "r\xc3\xa1isa.no\n"
+    "nore-og-uvdal.no\n"
+    "notodden.no\n"
+    "naroy.no\n"
+    "n\xc3\xa6r\xc3\xb8y.no\n"
+    "notteroy.no\n"
+    "n\xc3\xb8tter\xc3\xb8y.no\n"
+    "odda.no\n"
+    "oksnes.no\n"
+    "\xc3\xb8ksnes.no\n"
+    "oppdal.no\n"
+    "oppegard.no\n"
+    "oppeg\xc3\xa5rd.no\n"
+    "orkdal.no\n"
+    "orland.no\n"
+    "\xc3\xb8rland.no\n"
+    "orskog.no\n"
+    "\xc3\xb8rskog.no\n"
+    "orsta.no\n"
+    "\xc3\xb8rsta.no\n"
+    "os.hedmark.no\n"
+    "os.hordaland.no\n"
+    "osen.no\n"
+    "osteroy.no\n"
+    "oster\xc3\xb8y.no\n"
+    "ostre-toten.no\n"
+    "\xc3\xb8stre-toten.no\n"
+    "overhalla.no\n"
+    "ovre-eiker.no\n"
+    "\xc3\xb8vre-eiker.no\n"
+    "oyer.no\n"
+    "\xc3\xb8yer.no\n"
+    "oygarden.no\n"
+    "\xc3\xb8ygarden.no\n"
+    "oystre-slidre.no\n"
+    "\xc3\xb8ystre-slidre.no\n"
+    "porsanger.no\n"
+    "porsangu.no\n"
+    "pors\xc3\xa1\xc5\x8bgu.no\n"
+    "porsgrunn.no\n"
+    "radoy.no\n"
+    "rad\xc3\xb8y.no\n"
+    "rakkestad.no\n"
+    "rana.no\n"
+    "ruovat.no\n"
+    "randaberg.no\n"
+    "rauma.no\n"
+    "rendalen.no\n"
+    "rennebu.no\n"
+    "rennesoy.no\n"
+    "rennes\xc3\xb8y.no\n"
+    "rindal.no\n"
+    "ringebu.no\n"
+    "ringerike.no\n"
+    "ringsaker.no\n"
+    "rissa.no\n"
+    "risor.no\n"
+    "ris\xc3\xb8r.no\n"
+    "roan.no\n"
+    "rollag.no\n"
+    "rygge.no\n"
+    "ralingen.no\n"
+    "r\xc3\xa6lingen.no\n"
+    "rodoy.no\n"
+    "r\xc3\xb8" "d\xc3\xb8y.no\n"
+    "romskog.no\n"
+    "r\xc3\xb8mskog.no\n"
+    "roros.no\n"
+    "r\xc3\xb8ros.no\n"
+    "rost.no\n"
+    "r\xc3\xb8st.no\n"
+    "royken.no\n"
+    "r\xc3\xb8yken.no\n"
+    "royrvik.no\n"
+    "r\xc3\xb8yrvik.no\n"
+    "rade.no\n"
+    "r\xc3\xa5" "de.no\n"
+    "salangen.no\n"
+    "siellak.no\n"
+    "saltdal.no\n"
+    "salat.no\n"
+    "s\xc3\xa1l\xc3\xa1t.no\n"
+    "s\xc3\xa1lat.no\n"
+    "samnanger.no\n"
+    "sande.more-og-romsdal.no\n"
+    "sande.m\xc3\xb8re-og-romsdal.no\n"
+    "sande.vestfold.no\n"
+    "sandefjord.no\n"
+    "sandnes.no\n"
+    "sandoy.no\n"
+    "sand\xc3\xb8y.no\n"
+    "sarpsborg.no\n"
+    "sauda.no\n"
+    "sauherad.no\n"
+    "sel.no\n"
+    "selbu.no\n"
+    "selje.no\n"
+    "seljord.no\n"
+    "sigdal.no\n"
+    "siljan.no\n"
+    "sirdal.no\n"
+    "skaun.no\n"
+    "skedsmo.no\n"
+    "ski.no\n"
+    "skien.no\n"
+    "skiptvet.no\n"
+    "skjervoy.no\n"
+    "skjerv\xc3\xb8y.no\n"
+    "skierva.no\n"
+    "skierv\xc3\xa1.no\n"
+    "skjak.no\n"
+    "skj\xc3\xa5k.no\n"
+    "skodje.no\n"
+    "skanland.no\n"
+    "sk\xc3\xa5nland.no\n"
+    "skanit.no\n"
+    "sk\xc3\xa1nit.no\n"
+    "smola.no\n"
+    "sm\xc3\xb8la.no\n"
+    "snillfjord.no\n"
+    "snasa.no\n"
+    "sn\xc3\xa5sa.no\n"
+    "snoasa.no\n"
+    "snaase.no\n"
+    "sn\xc3\xa5" "ase.no\n"
+    "sogndal.no\n"
+    "sokndal.no\n"
+    "sola.no\n"
+    "solund.no\n"
+    "songdalen.no\n"
+    "sortland.no\n"
+    "spydeberg.no\n"
+    "stange.no\n"
+    "stavanger.no\n"
+    "steigen.no\n"
+    "steinkjer.no\n"
+    "stjordal.no\n"
+    "stj\xc3\xb8rdal.no\n"
+    "stokke.no\n"
+    "stor-elvdal.no\n"
+    "stord.no\n"
+    "stordal.no\n"
+    "storfjord.no\n"
+    "omasvuotna.no\n"
+    "strand.no\n"
+    "stranda.no\n"
+    "stryn.no\n"
+    "sula.no\n"
+    "suldal.no\n"
+    "sund.no\n"
+    "sunndal.no\n"
+    "surnadal.no\n"
+    "sveio.no\n"
+    "svelvik.no\n"
+    "sykkylven.no\n"
+    "sogne.no\n"
+    "s\xc3\xb8gne.no\n"
+    "somna.no\n"
+    "s\xc3\xb8mna.no\n"
+    "sondre-land.no\n"
+    "s\xc3\xb8ndre-land.no\n"
+    "sor-aurdal.no\n"
+    "s\xc3\xb8r-aurdal.no\n"
+    "sor-fron.no\n"
+    "s\xc3\xb8r-fron.no\n"
+    "sor-odal.no\n"
+    "s\xc3\xb8r-odal.no\n"
+    "sor-varanger.no\n"
+    "s\xc3\xb8r-varanger.no\n"
+    "matta-varjjat.no\n"
+    "m\xc3\xa1tta-v\xc3\xa1rjjat.no\n"
+    "sorfold.no\n"
+    "s\xc3\xb8rfold.no\n"
+    "sorreisa.no\n"
+    "s\xc3\xb8rreisa.no\n"
+    "sorum.no\n"
+    "s\xc3\xb8rum.no\n"
+    "tana.no\n"
+    "deatnu.no\n"
+    "time.no\n"
+    "tingvoll.no\n"
+    "tinn.no\n"
+    "tjeldsund.no\n"
+    "dielddanuorri.no\n"
+    "tjome.no\n"
+    "tj\xc3\xb8me.no\n"
+    "tokke.no\n"
+    "tolga.no\n"
+    "torsken.no\n"
+    "tranoy.no\n"
+    "tran\xc3\xb8y.no\n"
+    "tromso.no\n"
+    "troms\xc3\xb8.no\n"
+    "tromsa.no\n"
+    "romsa.no\n"
+    "trondheim.no\n"
+    "troandin.no\n"
+    "trysil.no\n"
+    "trana.no\n"
+    "tr\xc3\xa6na.no\n"
+    "trogstad.no\n"
+    "tr\xc3\xb8gstad.no\n"
+    "tvedestrand.no\n"
+    "tydal.no\n"
+    "tynset.no\n"
+    "tysfjord.no\n"
+    "divtasvuodna.no\n"
+    "divttasvuotna.no\n"
+    "tysnes.no\n"
+    "tysvar.no\n"
+    "tysv\xc3\xa6r.no\n"
+    "tonsberg.no\n"
+    "t\xc3\xb8nsberg.no\n"
+    "ullensaker.no\n"
+    "ullensvang.no\n"
+    "ulvik.no\n"
+    "utsira.no\n"
+    "vadso.no\n"
+    "vads\xc3\xb8.no\n"
+    "cahcesuolo.no\n"
+    "\xc4\x8d\xc3\xa1hcesuolo.no\n"
+    "vaksdal.no\n"
+    "valle.no\n"
+    "vang.no\n"
+    "vanylven.no\n"
+    "vardo.no\n"
+    "vard\xc3\xb8.no\n"
+    "varggat.no\n"
+    "v\xc3\xa1rgg\xc3\xa1t.no\n"
+    "vefsn.no\n"
+    "vaapste.no\n"
+    "vega.no\n"
+    "vegarshei.no\n"
+    "veg\xc3\xa5rshei.no\n"
+    "vennesla.no\n"
+    "verdal.no\n"
+    "verran.no\n"
+    "vestby.no\n"
+    "vestnes.no\n"
+    "vestre-slidre.no\n"
+    "vestre-toten.no\n"
+    "vestvagoy.no\n"
+    "vestv\xc3\xa5g\xc3\xb8y.no\n"
+    "vevelstad.no\n"
+    "vik.no\n"
+    "vikna.no\n"
+    "vindafjord.no\n"
+    "volda.no\n"
+    "voss.no\n"
+    "varoy.no\n"
+    "v\xc3\xa6r\xc3\xb8y.no\n"
+    "vagan.no\n"
+    "v\xc3\xa5gan.no\n"
+    "voagat.no\n"
+    "vagsoy.no\n"
+    "v\xc3\xa5gs\xc3\xb8y.no\n"
+    "vaga.no\n"
+    "v\xc3\xa5g\xc3\xa5.no\n"
+    "valer.ostfold.no\n"
+    "v\xc3\xa5ler.\xc3\xb8stfold.no\n"
+    "valer.hedmark.no\n"
+    "v\xc3\xa5ler.hedmark.no\n"
+    "*.np\n"
+    "nr\n"
+    "biz.nr\n"
+    "info.nr\n"
+    "gov.nr\n"
+    "edu.nr\n"
+    "org.nr\n"
+    "net.nr\n"
+    "com.nr\n"
+    "nu\n"
+    "nz\n"
+    "ac.nz\n"
+    "co.nz\n"
+    "cri.nz\n"
+    "geek.nz\n"
+    "gen.nz\n"
+    "govt.nz\n"
+    "health.nz\n"
+    "iwi.nz\n"
+    "kiwi.nz\n"
+    "maori.nz\n"
+    "mil.nz\n"
+    "m\xc4\x81ori.nz\n"
+    "net.nz\n"
+    "org.nz\n"
+    "parliament.nz\n"
+    "school.nz\n"
+    "om\n"
+    "co.om\n"
+    "com.om\n"
+    "edu.om\n"
+    "gov.om\n"
+    "med.om\n"
+    "museum.om\n"
+    "net.om\n"
+    "org.om\n"
+    "pro.om\n"
+    "onion\n"
+    "org\n"
+    "pa\n"
+    "ac.pa\n"
+    "gob.pa\n"
+    "com.pa\n"
+    "org.pa\n"
+    "sld.pa\n"
+    "edu.pa\n"
+    "net.pa\n"
+    "ing.pa\n"
+    "abo.pa\n"
+    "med.pa\n"
+    "nom.pa\n"
+    "pe\n"
+    "edu.pe\n"
+    "gob.pe\n"
+    "nom.pe\n"
+    "mil.pe\n"
+    "org.pe\n"
+    "com.pe\n"
+    "net.pe\n"
+    "pf\n"
+    "com.pf\n"
+    "org.pf\n"
+    "edu.pf\n"
+    "*.pg\n"
+    "ph\n"
+    "com.ph\n"
+    "net.ph\n"
+    "org.ph\n"
+    "gov.ph\n"
+    "edu.ph\n"
+    "ngo.ph\n"
+    "mil.ph\n"
+    "i.ph\n"
+    "pk\n"
+    "com.pk\n"
+    "net.pk\n"
+    "edu.pk\n"
+    "org.pk\n"
+    "fam.pk\n"
+    "biz.pk\n"
+    "web.pk\n"
+    "gov.pk\n"
+    "gob.pk\n"
+    "gok.pk\n"
+    "gon.pk\n"
+    "gop.pk\n"
+    "gos.pk\n"
+    "info.pk\n"
+    "pl\n"
+    "com.pl\n"
+    "net.pl\n"
+    "org.pl\n"
+    "aid.pl\n"
+    "agro.pl\n"
+    "atm.pl\n"
+    "auto.pl\n"
+    "biz.pl\n"
+    "edu.pl\n"
+    "gmina.pl\n"
+    "gsm.pl\n"
+    "info.pl\n"
+    "mail.pl\n"
+    "miasta.pl\n"
+    "media.pl\n"
+    "mil.pl\n"
+    "nieruchomosci.pl\n"
+    "nom.pl\n"
+    "pc.pl\n"
+    "powiat.pl\n"
+    "priv.pl\n"
+    "realestate.pl\n"
+    "rel.pl\n"
+    "sex.pl\n"
+    "shop.pl\n"
+    "sklep.pl\n"
+    "sos.pl\n"
+    "szkola.pl\n"
+    "targi.pl\n"
+    "tm.pl\n"
+    "tourism.pl\n"
+    "travel.pl\n"
+    "turystyka.pl\n"
+    "gov.pl\n"
+    "ap.gov.pl\n"
+    "ic.gov.pl\n"
+    "is.gov.pl\n"
+    "us.gov.pl\n"
+    "kmpsp.gov.pl\n"
+    "kppsp.gov.pl\n"
+    "kwpsp.gov.pl\n"
+    "psp.gov.pl\n"
+    "wskr.gov.pl\n"
+    "kwp.gov.pl\n"
+    "mw.gov.pl\n"
+    "ug.gov.pl\n"
+    "um.gov.pl\n"
+    "umig.gov.pl\n"
+    "ugim.gov.pl\n"
+    "upow.gov.pl\n"
+    "uw.gov.pl\n"
+    "starostwo.gov.pl\n"
+    "pa.gov.pl\n"
+    "po.gov.pl\n"
+    "psse.gov.pl\n"
+    "pup.gov.pl\n"
+    "rzgw.gov.pl\n"
+    "sa.gov.pl\n"
+    "so.gov.pl\n"
+    "sr.gov.pl\n"
+    "wsa.gov.pl\n"
+    "sko.gov.pl\n"
+    "uzs.gov.pl\n"
+    "wiih.gov.pl\n"
+    "winb.gov.pl\n"
+    "pinb.gov.pl\n"
+    "wios.gov.pl\n"
+    "witd.gov.pl\n"
+    "wzmiuw.gov.pl\n"
+    "piw.gov.pl\n"
+    "wiw.gov.pl\n"
+    "griw.gov.pl\n"
+    "wif.gov.pl\n"
+    "oum.gov.pl\n"
+    "sdn.gov.pl\n"
+    "zp.gov.pl\n"
+    "uppo.gov.pl\n"
+    "mup.gov.pl\n"
+    "wuoz.gov.pl\n"
+    "konsulat.gov.pl\n"
+    "oirm.gov.pl\n"
+    "augustow.pl\n"
+    "babia-gora.pl\n"
+    "bedzin.pl\n"
+    "beskidy.pl\n"
+    "bialowieza.pl\n"
+    "bialystok.pl\n"
+    "bielawa.pl\n"
+    "bieszczady.pl\n"
+    "boleslawiec.pl\n"
+    "bydgoszcz.pl\n"
+    "bytom.pl\n"
+    "cieszyn.pl\n"
+    "czeladz.pl\n"
+    "czest.pl\n"
+    "dlugoleka.pl\n"
+    "elblag.pl\n"
+    "elk.pl\n"
+    "glogow.pl\n"
+    "gniezno.pl\n"
+    "gorlice.pl\n"
+    "grajewo.pl\n"
+    "ilawa.pl\n"
+    "jaworzno.pl\n"
+    "jelenia-gora.pl\n"
+    "jgora.pl\n"
+    "kalisz.pl\n"
+    "kazimierz-dolny.pl\n"
+    "karpacz.pl\n"
+    "kartuzy.pl\n"
+    "kaszuby.pl\n"
+    "katowice.pl\n"
+    "kepno.pl\n"
+    "ketrzyn.pl\n"
+    "klodzko.pl\n"
+    "kobierzyce.pl\n"
+    "kolobrzeg.pl\n"
+    "konin.pl\n"
+    "konskowola.pl\n"
+    "kutno.pl\n"
+    "lapy.pl\n"
+    "lebork.pl\n"
+    "legnica.pl\n"
+    "lezajsk.pl\n"
+    "limanowa.pl\n"
+    "lomza.pl\n"
+    "lowicz.pl\n"
+    "lubin.pl\n"
+    "lukow.pl\n"
+    "malbork.pl\n"
+    "malopolska.pl\n"
+    "mazowsze.pl\n"
+    "mazury.pl\n"
+    "mielec.pl\n"
+    "mielno.pl\n"
+    "mragowo.pl\n"
+    "naklo.pl\n"
+    "nowaruda.pl\n"
+    "nysa.pl\n"
+    "olawa.pl\n"
+    "olecko.pl\n"
+    "olkusz.pl\n"
+    "olsztyn.pl\n"
+    "opoczno.pl\n"
+    "opole.pl\n"
+    "ostroda.pl\n"
+    "ostroleka.pl\n"
+    "ostrowiec.pl\n"
+    "ostrowwlkp.pl\n"
+    "pila.pl\n"
+    "pisz.pl\n"
+    "podhale.pl\n"
+    "podlasie.pl\n"
+    "polkowice.pl\n"
+    "pomorze.pl\n"
+    "pomorskie.pl\n"
+    "prochowice.pl\n"
+    "pruszkow.pl\n"
+    "przeworsk.pl\n"
+    "pulawy.pl\n"
+    "radom.pl\n"
+    "rawa-maz.pl\n"
+    "rybnik.pl\n"
+    "rzeszow.pl\n"
+    "sanok.pl\n"
+    "sejny.pl\n"
+    "slask.pl\n"
+    "slupsk.pl\n"
+    "sosnowiec.pl\n"
+    "stalowa-wola.pl\n"
+    "skoczow.pl\n"
+    "starachowice.pl\n"
+    "stargard.pl\n"
+    "suwalki.pl\n"
+    "swidnica.pl\n"
+    "swiebodzin.pl\n"
+    "swinoujscie.pl\n"
+    "szczecin.pl\n"
+    "szczytno.pl\n"
+    "tarnobrzeg.pl\n"
+    "tgory.pl\n"
+    "turek.pl\n"
+    "tychy.pl\n"
+    "ustka.pl\n"
+    "walbrzych.pl\n"
+    "warmia.pl\n"
+    "warszawa.pl\n"
+    "waw.pl\n"
+    "wegrow.pl\n"
+    "wielun.pl\n"
+    "wlocl.pl\n"
+    "wloclawek.pl\n"
+    "wodzislaw.pl\n"
+    "wolomin.pl\n"
+    "wroclaw.pl\n"
+    "zachpomor.pl\n"
+    "zagan.pl\n"
+    "zarow.pl\n"
+    "zgora.pl\n"
+    "zgorzelec.pl\n"
+    "pm\n"
+    "pn\n"
+    "gov.pn\n"
+    "co.pn\n"
+    "org.pn\n"
+    "edu.pn\n"
+    "net.pn\n"
+    "post\n"
+    "pr\n"
+    "com.pr\n"
+    "net.pr\n"
+    "org.pr\n"
+    "gov.pr\n"
+    "edu.pr\n"
+    "isla.pr\n"
+    "pro.pr\n"
+    "biz.pr\n"
+    "info.pr\n"
+    "name.pr\n"
+    "est.pr\n"
+    "prof.pr\n"
+    "ac.pr\n"
+    "pro\n"
+    "aaa.pro\n"
+    "aca.pro\n"
+    "acct.pro\n"
+    "avocat.pro\n"
+    "bar.pro\n"
+    "cpa.pro\n"
+    "eng.pro\n"
+    "jur.pro\n"
+    "law.pro\n"
+    "med.pro\n"
+    "recht.pro\n"
+    "ps\n"
+    "edu.ps\n"
+    "gov.ps\n"
+    "sec.ps\n"
+    "plo.ps\n"
+    "com.ps\n"
+    "org.ps\n"
+    "net.ps\n"
+    "pt\n"
+    "net.pt\n"
+    "gov.pt\n"
+    "org.pt\n"
+    "edu.pt\n"
+    "int.pt\n"
+    "publ.pt\n"
+    "com.pt\n"
+    "nome.pt\n"
+    "pw\n"
+    "co.pw\n"
+    "ne.pw\n"
+    "or.pw\n"
+    "ed.pw\n"
+    "go.pw\n"
+    "belau.pw\n"
+    "py\n"
+    "com.py\n"
+    "coop.py\n"
+    "edu.py\n"
+    "gov.py\n"
+    "mil.py\n"
+    "net.py\n"
+    "org.py\n"
+    "qa\n"
+    "com.qa\n"
+    "edu.qa\n"
+    "gov.qa\n"
+    "mil.qa\n"
+    "name.qa\n"
+    "net.qa\n"
+    "org.qa\n"
+    "sch.qa\n"
+    "re\n"
+    "asso.re\n"
+    "com.re\n"
+    "nom.re\n"
+    "ro\n"
+    "arts.ro\n"
+    "com.ro\n"
+    "firm.ro\n"
+    "info.ro\n"
+    "nom.ro\n"
+    "nt.ro\n"
+    "org.ro\n"
+    "rec.ro\n"
+    "store.ro\n"
+    "tm.ro\n"
+    "www.ro\n"
+    "rs\n"
+    "ac.rs\n"
+    "co.rs\n"
+    "edu.rs\n"
+    "gov.rs\n"
+    "in.rs\n"
+    "org.rs\n"
+    "ru\n"
+    "rw\n"
+    "ac.rw\n"
+    "co.rw\n"
+    "coop.rw\n"
+    "gov.rw\n"
+    "mil.rw\n"
+    "net.rw\n"
+    "org.rw\n"
+    "sa\n"
+    "com.sa\n"
+    "net.sa\n"
+    "org.sa\n"
+    "gov.sa\n"
+    "med.sa\n"
+    "pub.sa\n"
+    "edu.sa\n"
+    "sch.sa\n"
+    "sb\n"
+    "com.sb\n"
+    "edu.sb\n"
+    "gov.sb\n"
+    "net.sb\n"
+    "org.sb\n"
+    "sc\n"
+    "com.sc\n"
+    "gov.sc\n"
+    "net.sc\n"
+    "org.sc\n"
+    "edu.sc\n"
+    "sd\n"
+    "com.sd\n"
+    "net.sd\n"
+    "org.sd\n"
+    "edu.sd\n"
+    "med.sd\n"
+    "tv.sd\n"
+    "gov.sd\n"
+    "info.sd\n"
+    "se\n"
+    "a.se\n"
+    "ac.se\n"
+    "b.se\n"
+    "bd.se\n"
+    "brand.se\n"
+    "c.se\n"
+    "d.se\n"
+    "e.se\n"
+    "f.se\n"
+    "fh.se\n"
+    "fhsk.se\n"
+    "fhv.se\n"
+    "g.se\n"
+    "h.se\n"
+    "i.se\n"
+    "k.se\n"
+    "komforb.se\n"
+    "kommunalforbund.se\n"
+    "komvux.se\n"
+    "l.se\n"
+    "lanbib.se\n"
+    "m.se\n"
+    "n.se\n"
+    "naturbruksgymn.se\n"
+    "o.se\n"
+    "org.se\n"
+    "p.se\n"
+    "parti.se\n"
+    "pp.se\n"
+    "press.se\n"
+    "r.se\n"
+    "s.se\n"
+    "t.se\n"
+    "tm.se\n"
+    "u.se\n"
+    "w.se\n"
+    "x.se\n"
+    "y.se\n"
+    "z.se\n"
+    "sg\n"
+    "com.sg\n"
+    "net.sg\n"
+    "org.sg\n"
+    "gov.sg\n"
+    "edu.sg\n"
+    "per.sg\n"
+    "sh\n"
+    "com.sh\n"
+    "net.sh\n"
+    "gov.sh\n"
+    "org.sh\n"
+    "mil.sh\n"
+    "si\n"
+    "sj\n"
+    "sk\n"
+    "sl\n"
+    "com.sl\n"
+    "net.sl\n"
+    "edu.sl\n"
+    "gov.sl\n"
+    "org.sl\n"
+    "sm\n"
+    "sn\n"
+    "art.sn\n"
+    "com.sn\n"
+    "edu.sn\n"
+    "gouv.sn\n"
+    "org.sn\n"
+    "perso.sn\n"
+    "univ.sn\n"
+    "so\n"
+    "com.so\n"
+    "edu.so\n"
+    "gov.so\n"
+    "me.so\n"
+    "net.so\n"
+    "org.so\n"
+    "sr\n"
+    "ss\n"
+    "biz.ss\n"
+    "com.ss\n"
+    "edu.ss\n"
+    "gov.ss\n"
+    "me.ss\n"
+    "net.ss\n"
+    "org.ss\n"
+    "sch.ss\n"
+    "st\n"
+    "co.st\n"
+    "com.st\n"
+    "consulado.st\n"
+    "edu.st\n"
+    "embaixada.st\n"
+    "mil.st\n"
+    "net.st\n"
+    "org.st\n"
+    "principe.st\n"
+    "saotome.st\n"
+    "store.st\n"
+    "su\n"
+    "sv\n"
+    "com.sv\n"
+    "edu.sv\n"
+    "gob.sv\n"
+    "org.sv\n"
+    "red.sv\n"
+    "sx\n"
+    "gov.sx\n"
+    "sy\n"
+    "edu.sy\n"
+    "gov.sy\n"
+    "net.sy\n"
+    "mil.sy\n"
+    "com.sy\n"
+    "org.sy\n"
+    "sz\n"
+    "co.sz\n"
+    "ac.sz\n"
+    "org.sz\n"
+    "tc\n"
+    "td\n"
+    "tel\n"
+    "tf\n"
+    "tg\n"
+    "th\n"
+    "ac.th\n"
+    "co.th\n"
+    "go.th\n"
+    "in.th\n"
+    "mi.th\n"
+    "net.th\n"
+    "or.th\n"
+    "tj\n"
+    "ac.tj\n"
+    "biz.tj\n"
+    "co.tj\n"
+    "com.tj\n"
+    "edu.tj\n"
+    "go.tj\n"
+    "gov.tj\n"
+    "int.tj\n"
+    "mil.tj\n"
+    "name.tj\n"
+    "net.tj\n"
+    "nic.tj\n"
+    "org.tj\n"
+    "test.tj\n"
+    "web.tj\n"
+    "tk\n"
+    "tl\n"
+    "gov.tl\n"
+    "tm\n"
+    "com.tm\n"
+    "co.tm\n"
+    "org.tm\n"
+    "net.tm\n"
+    "nom.tm\n"
+    "gov.tm\n"
+    "mil.tm\n"
+    "edu.tm\n"
+    "tn\n"
+    "com.tn\n"
+    "ens.tn\n"
+    "fin.tn\n"
+    "gov.tn\n"
+    "ind.tn\n"
+    "info.tn\n"
+    "intl.tn\n"
+    "mincom.tn\n"
+    "nat.tn\n"
+    "net.tn\n"
+    "org.tn\n"
+    "perso.tn\n"
+    "tourism.tn\n"
+    "to\n"
+    "com.to\n"
+    "gov.to\n"
+    "net.to\n"
+    "org.to\n"
+    "edu.to\n"
+    "mil.to\n"
+    "tr\n"
+    "av.tr\n"
+    "bbs.tr\n"
+    "bel.tr\n"
+    "biz.tr\n"
+    "com.tr\n"
+    "dr.tr\n"
+    "edu.tr\n"
+    "gen.tr\n"
+    "gov.tr\n"
+    "info.tr\n"
+    "mil.tr\n"
+    "k12.tr\n"
+    "kep.tr\n"
+    "name.tr\n"
+    "net.tr\n"
+    "org.tr\n"
+    "pol.tr\n"
+    "tel.tr\n"
+    "tsk.tr\n"
+    "tv.tr\n"
+    "web.tr\n"
+    "nc.tr\n"
+    "gov.nc.tr\n"
+    "tt\n"
+    "co.tt\n"
+    "com.tt\n"
+    "org.tt\n"
+    "net.tt\n"
+    "biz.tt\n"
+    "info.tt\n"
+    "pro.tt\n"
+    "int.tt\n"
+    "coop.tt\n"
+    "jobs.tt\n"
+    "mobi.tt\n"
+    "travel.tt\n"
+    "museum.tt\n"
+    "aero.tt\n"
+    "name.tt\n"
+    "gov.tt\n"
+    "edu.tt\n"
+    "tv\n"
+    "tw\n"
+    "edu.tw\n"
+    "gov.tw\n"
+    "mil.tw\n"
+    "com.tw\n"
+    "net.tw\n"
+    "org.tw\n"
+    "idv.tw\n"
+    "game.tw\n"
+    "ebiz.tw\n"
+    "club.tw\n"
+    "\xe7\xb6\xb2\xe8\xb7\xaf.tw\n"
+    "\xe7\xb5\x84\xe7\xb9\x94.tw\n"
+    "\xe5\x95\x86\xe6\xa5\xad.tw\n"
+    "tz\n"
+    "ac.tz\n"
+    "co.tz\n"
+    "go.tz\n"
+    "hotel.tz\n"
+    "info.tz\n"
+    "me.tz\n"
+    "mil.tz\n"
+    "mobi.tz\n"
+    "ne.tz\n"
+    "or.tz\n"
+    "sc.tz\n"
+    "tv.tz\n"
+    "ua\n"
+    "com.ua\n"
+    "edu.ua\n"
+    "gov.ua\n"
+    "in.ua\n"
+    "net.ua\n"
+    "org.ua\n"
+    "cherkassy.ua\n"
+    "cherkasy.ua\n"
+    "chernigov.ua\n"
+    "chernihiv.ua\n"
+    "chernivtsi.ua\n"
+    "chernovtsy.ua\n"
+    "ck.ua\n"
+    "cn.ua\n"
+    "cr.ua\n"
+    "crimea.ua\n"
+    "cv.ua\n"
+    "dn.ua\n"
+    "dnepropetrovsk.ua\n"
+    "dnipropetrovsk.ua\n"
+    "donetsk.ua\n"
+    "dp.ua\n"
+    "if.ua\n"
+    "ivano-frankivsk.ua\n"
+    "kh.ua\n"
+    "kharkiv.ua\n"
+    "kharkov.ua\n"
+    "kherson.ua\n"
+    "khmelnitskiy.ua\n"
+    "khmelnytskyi.ua\n"
+    "kiev.ua\n"
+    "kirovograd.ua\n"
+    "km.ua\n"
+    "kr.ua\n"
+    "krym.ua\n"
+    "ks.ua\n"
+    "kv.ua\n"
+    "kyiv.ua\n"
+    "lg.ua\n"
+    "lt.ua\n"
+    "lugansk.ua\n"
+    "lutsk.ua\n"
+    "lv.ua\n"
+    "lviv.ua\n"
+    "mk.ua\n"
+    "mykolaiv.ua\n"
+    "nikolaev.ua\n"
+    "od.ua\n"
+    "odesa.ua\n"
+    "odessa.ua\n"
+    "pl.ua\n"
+    "poltava.ua\n"
+    "rivne.ua\n"
+    "rovno.ua\n"
+    "rv.ua\n"
+    "sb.ua\n"
+    "sebastopol.ua\n"
+    "sevastopol.ua\n"
+    "sm.ua\n"
+    "sumy.ua\n"
+    "te.ua\n"
+    "ternopil.ua\n"
+    "uz.ua\n"
+    "uzhgorod.ua\n"
+    "vinnica.ua\n"
+    "vinnytsia.ua\n"
+    "vn.ua\n"
+    "volyn.ua\n"
+    "yalta.ua\n"
+    "zaporizhzhe.ua\n"
+    "zaporizhzhia.ua\n"
+    "zhitomir.ua\n"
+    "zhytomyr.ua\n"
+    "zp.ua\n"
+    "zt.ua\n"
+    "ug\n"
+    "co.ug\n"
+    "or.ug\n"
+    "ac.ug\n"
+    "sc.ug\n"
+    "go.ug\n"
+    "ne.ug\n"
+    "com.ug\n"
+    "org.ug\n"
+    "uk\n"
+    "ac.uk\n"
+    "co.uk\n"
+    "gov.uk\n"
+    "ltd.uk\n"
+    "me.uk\n"
+    "net.uk\n"
+    "nhs.uk\n"
+    "org.uk\n"
+    "plc.uk\n"
+    "police.uk\n"
+    "*.sch.uk\n"
+    "us\n"
+    "dni.us\n"
+    "fed.us\n"
+    "isa.us\n"
+    "kids.us\n"
+    "nsn.us\n"
+    "ak.us\n"
+    "al.us\n"
+    "ar.us\n"
+    "as.us\n"
+    "az.us\n"
+    "ca.us\n"
+    "co.us\n"
+    "ct.us\n"
+    "dc.us\n"
+    "de.us\n"
+    "fl.us\n"
+    "ga.us\n"
+    "gu.us\n"
+    "hi.us\n"
+    "ia.us\n"
+    "id.us\n"
+    "il.us\n"
+    "in.us\n"
+    "ks.us\n"
+    "ky.us\n",
+
+    "la.us\n"
+    "ma.us\n"
+    "md.us\n"
+    "me.us\n"
+    "mi.us\n"
+    "mn.us\n"
+    "mo.us\n"
+    "ms.us\n"
+    "mt.us\n"
+    "nc.us\n"
+    "nd.us\n"
+    "ne.us\n"
+    "nh.us\n"
+    "nj.us\n"
+    "nm.us\n"
+    "nv.us\n"
+    "ny.us\n"
+    "oh.us\n"
+    "ok.us\n"
+    "or.us\n"
+    "pa.us\n"
+    "pr.us\n"
+    "ri.us\n"
+    "sc.us\n"
+    "sd.us\n"
+    "tn.us\n"
+    "tx.us\n"
+    "ut.us\n"
+    "vi.us\n"
+    "vt.us\n"
+    "va.us\n"
+    "wa.us\n"
+    "wi.us\n"
+    "wv.us\n"
+    "wy.us\n"
+    "k12.ak.us\n"
+    "k12.al.us\n"
+    "k12.ar.us\n"
+    "k12.as.us\n"
+    "k12.az.us\n"
+    "k12.ca.us\n"
+    "k12.co.us\n"
+    "k12.ct.us\n"
+    "k12.dc.us\n"
+    "k12.de.us\n"
+    "k12.fl.us\n"
+    "k12.ga.us\n"
+    "k12.gu.us\n"
+    "k12.ia.us\n"
+    "k12.id.us\n"
+    "k12.il.us\n"
+    "k12.in.us\n"
+    "k12.ks.us\n"
+    "k12.ky.us\n"
+    "k12.la.us\n"
+    "k12.ma.us\n"
+    "k12.md.us\n"
+    "k12.me.us\n"
+    "k12.mi.us\n"
+    "k12.mn.us\n"
+    "k12.mo.us\n"
+    "k12.ms.us\n"
+    "k12.mt.us\n"
+    "k12.nc.us\n"
+    "k12.ne.us\n"
+    "k12.nh.us\n"
+    "k12.nj.us\n"
+    "k12.nm.us\n"
+    "k12.nv.us\n"
+    "k12.ny.us\n"
+    "k12.oh.us\n"
+    "k12.ok.us\n"
+    "k12.or.us\n"
+    "k12.pa.us\n"
+    "k12.pr.us\n"
+    "k12.sc.us\n"
+    "k12.tn.us\n"
+    "k12.tx.us\n"
+    "k12.ut.us\n"
+    "k12.vi.us\n"
+    "k12.vt.us\n"
+    "k12.va.us\n"
+    "k12.wa.us\n"
+    "k12.wi.us\n"
+    "k12.wy.us\n"
+    "cc.ak.us\n"
+    "cc.al.us\n"
+    "cc.ar.us\n"
+    "cc.as.us\n"
+    "cc.az.us\n"
+    "cc.ca.us\n"
+    "cc.co.us\n"
+    "cc.ct.us\n"
+    "cc.dc.us\n"
+    "cc.de.us\n"
+    "cc.fl.us\n"
+    "cc.ga.us\n"
+    "cc.gu.us\n"
+    "cc.hi.us\n"
+    "cc.ia.us\n"
+    "cc.id.us\n"
+    "cc.il.us\n"
+    "cc.in.us\n"
+    "cc.ks.us\n"
+    "cc.ky.us\n"
+    "cc.la.us\n"
+    "cc.ma.us\n"
+    "cc.md.us\n"
+    "cc.me.us\n"
+    "cc.mi.us\n"
+    "cc.mn.us\n"
+    "cc.mo.us\n"
+    "cc.ms.us\n"
+    "cc.mt.us\n"
+    "cc.nc.us\n"
+    "cc.nd.us\n"
+    "cc.ne.us\n"
+    "cc.nh.us\n"
+    "cc.nj.us\n"
+    "cc.nm.us\n"
+    "cc.nv.us\n"
+    "cc.ny.us\n"
+    "cc.oh.us\n"
+    "cc.ok.us\n"
+    "cc.or.us\n"
+    "cc.pa.us\n"
+    "cc.pr.us\n"
+    "cc.ri.us\n"
+    "cc.sc.us\n"
+    "cc.sd.us\n"
+    "cc.tn.us\n"
+    "cc.tx.us\n"
+    "cc.ut.us\n"
+    "cc.vi.us\n"
+    "cc.vt.us\n"
+    "cc.va.us\n"
+    "cc.wa.us\n"
+    "cc.wi.us\n"
+    "cc.wv.us\n"
+    "cc.wy.us\n"
+    "lib.ak.us\n"
+    "lib.al.us\n"
+    "lib.ar.us\n"
+    "lib.as.us\n"
+    "lib.az.us\n"
+    "lib.ca.us\n"
+    "lib.co.us\n"
+    "lib.ct.us\n"
+    "lib.dc.us\n"
+    "lib.fl.us\n"
+    "lib.ga.us\n"
+    "lib.gu.us\n"
+    "lib.hi.us\n"
+    "lib.ia.us\n"
+    "lib.id.us\n"
+    "lib.il.us\n"
+    "lib.in.us\n"
+    "lib.ks.us\n"
+    "lib.ky.us\n"
+    "lib.la.us\n"
+    "lib.ma.us\n"
+    "lib.md.us\n"
+    "lib.me.us\n"
+    "lib.mi.us\n"
+    "lib.mn.us\n"
+    "lib.mo.us\n"
+    "lib.ms.us\n"
+    "lib.mt.us\n"
+    "lib.nc.us\n"
+    "lib.nd.us\n"
+    "lib.ne.us\n"
+    "lib.nh.us\n"
+    "lib.nj.us\n"
+    "lib.nm.us\n"
+    "lib.nv.us\n"
+    "lib.ny.us\n"
+    "lib.oh.us\n"
+    "lib.ok.us\n"
+    "lib.or.us\n"
+    "lib.pa.us\n"
+    "lib.pr.us\n"
+    "lib.ri.us\n"
+    "lib.sc.us\n"
+    "lib.sd.us\n"
+    "lib.tn.us\n"
+    "lib.tx.us\n"
+    "lib.ut.us\n"
+    "lib.vi.us\n"
+    "lib.vt.us\n"
+    "lib.va.us\n"
+    "lib.wa.us\n"
+    "lib.wi.us\n"
+    "lib.wy.us\n"
+    "pvt.k12.ma.us\n"
+    "chtr.k12.ma.us\n"
+    "paroch.k12.ma.us\n"
+    "ann-arbor.mi.us\n"
+    "cog.mi.us\n"
+    "dst.mi.us\n"
+    "eaton.mi.us\n"
+    "gen.mi.us\n"
+    "mus.mi.us\n"
+    "tec.mi.us\n"
+    "washtenaw.mi.us\n"
+    "uy\n"
+    "com.uy\n"
+    "edu.uy\n"
+    "gub.uy\n"
+    "mil.uy\n"
+    "net.uy\n"
+    "org.uy\n"
+    "uz\n"
+    "co.uz\n"
+    "com.uz\n"
+    "net.uz\n"
+    "org.uz\n"
+    "va\n"
+    "vc\n"
+    "com.vc\n"
+    "net.vc\n"
+    "org.vc\n"
+    "gov.vc\n"
+    "mil.vc\n"
+    "edu.vc\n"
+    "ve\n"
+    "arts.ve\n"
+    "bib.ve\n"
+    "co.ve\n"
+    "com.ve\n"
+    "e12.ve\n"
+    "edu.ve\n"
+    "firm.ve\n"
+    "gob.ve\n"
+    "gov.ve\n"
+    "info.ve\n"
+    "int.ve\n"
+    "mil.ve\n"
+    "net.ve\n"
+    "nom.ve\n"
+    "org.ve\n"
+    "rar.ve\n"
+    "rec.ve\n"
+    "store.ve\n"
+    "tec.ve\n"
+    "web.ve\n"
+    "vg\n"
+    "vi\n"
+    "co.vi\n"
+    "com.vi\n"
+    "k12.vi\n"
+    "net.vi\n"
+    "org.vi\n"
+    "vn\n"
+    "com.vn\n"
+    "net.vn\n"
+    "org.vn\n"
+    "edu.vn\n"
+    "gov.vn\n"
+    "int.vn\n"
+    "ac.vn\n"
+    "biz.vn\n"
+    "info.vn\n"
+    "name.vn\n"
+    "pro.vn\n"
+    "health.vn\n"
+    "vu\n"
+    "com.vu\n"
+    "edu.vu\n"
+    "net.vu\n"
+    "org.vu\n"
+    "wf\n"
+    "ws\n"
+    "com.ws\n"
+    "net.ws\n"
+    "org.ws\n"
+    "gov.ws\n"
+    "edu.ws\n"
+    "yt\n"
+    "\xd8\xa7\xd9\x85\xd8\xa7\xd8\xb1\xd8\xa7\xd8\xaa\n"
+    "\xd5\xb0\xd5\xa1\xd5\xb5\n"
+    "\xe0\xa6\xac\xe0\xa6\xbe\xe0\xa6\x82\xe0\xa6\xb2\xe0\xa6\xbe\n"
+    "\xd0\xb1\xd0\xb3\n"
+    "\xd8\xa7\xd9\x84\xd8\xa8\xd8\xad\xd8\xb1\xd9\x8a\xd9\x86\n"
+    "\xd0\xb1\xd0\xb5\xd0\xbb\n"
+    "\xe4\xb8\xad\xe5\x9b\xbd\n"
+    "\xe4\xb8\xad\xe5\x9c\x8b\n"
+    "\xd8\xa7\xd9\x84\xd8\xac\xd8\xb2\xd8\xa7\xd8\xa6\xd8\xb1\n"
+    "\xd9\x85\xd8\xb5\xd8\xb1\n"
+    "\xd0\xb5\xd1\x8e\n"
+    "\xce\xb5\xcf\x85\n"
+    "\xd9\x85\xd9\x88\xd8\xb1\xd9\x8a\xd8\xaa\xd8\xa7\xd9\x86\xd9\x8a\xd8\xa7\n"
+    "\xe1\x83\x92\xe1\x83\x94\n"
+    "\xce\xb5\xce\xbb\n"
+    "\xe9\xa6\x99\xe6\xb8\xaf\n"
+    "\xe5\x85\xac\xe5\x8f\xb8.\xe9\xa6\x99\xe6\xb8\xaf\n"
+    "\xe6\x95\x99\xe8\x82\xb2.\xe9\xa6\x99\xe6\xb8\xaf\n"
+    "\xe6\x94\xbf\xe5\xba\x9c.\xe9\xa6\x99\xe6\xb8\xaf\n"
+    "\xe5\x80\x8b\xe4\xba\xba.\xe9\xa6\x99\xe6\xb8\xaf\n"
+    "\xe7\xb6\xb2\xe7\xb5\xa1.\xe9\xa6\x99\xe6\xb8\xaf\n"
+    "\xe7\xb5\x84\xe7\xb9\x94.\xe9\xa6\x99\xe6\xb8\xaf\n"
+    "\xe0\xb2\xad\xe0\xb2\xbe\xe0\xb2\xb0\xe0\xb2\xa4\n"
+    "\xe0\xac\xad\xe0\xac\xbe\xe0\xac\xb0\xe0\xac\xa4\n"
+    "\xe0\xa6\xad\xe0\xa6\xbe\xe0\xa7\xb0\xe0\xa6\xa4\n"
+    "\xe0\xa4\xad\xe0\xa4\xbe\xe0\xa4\xb0\xe0\xa4\xa4\xe0\xa4\xae\xe0\xa5\x8d\n"
+    "\xe0\xa4\xad\xe0\xa4\xbe\xe0\xa4\xb0\xe0\xa5\x8b\xe0\xa4\xa4\n"
+    "\xda\x80\xd8\xa7\xd8\xb1\xd8\xaa\n"
+    "\xe0\xb4\xad\xe0\xb4\xbe\xe0\xb4\xb0\xe0\xb4\xa4\xe0\xb4\x82\n"
+    "\xe0\xa4\xad\xe0\xa4\xbe\xe0\xa4\xb0\xe0\xa4\xa4\n"
+    "\xd8\xa8\xd8\xa7\xd8\xb1\xd8\xaa\n"
+    "\xd8\xa8\xda\xbe\xd8\xa7\xd8\xb1\xd8\xaa\n"
+    "\xe0\xb0\xad\xe0\xb0\xbe\xe0\xb0\xb0\xe0\xb0\xa4\xe0\xb1\x8d\n"
+    "\xe0\xaa\xad\xe0\xaa\xbe\xe0\xaa\xb0\xe0\xaa\xa4\n"
+    "\xe0\xa8\xad\xe0\xa8\xbe\xe0\xa8\xb0\xe0\xa8\xa4\n"
+    "\xe0\xa6\xad\xe0\xa6\xbe\xe0\xa6\xb0\xe0\xa6\xa4\n"
+    "\xe0\xae\x87\xe0\xae\xa8\xe0\xaf\x8d\xe0\xae\xa4\xe0\xae\xbf\xe0\xae\xaf\xe0\xae\xbe\n"
+    "\xd8\xa7\xdb\x8c\xd8\xb1\xd8\xa7\xd9\x86\n"
+    "\xd8\xa7\xd9\x8a\xd8\xb1\xd8\xa7\xd9\x86\n"
+    "\xd8\xb9\xd8\xb1\xd8\xa7\xd9\x82\n"
+    "\xd8\xa7\xd9\x84\xd8\xa7\xd8\xb1\xd8\xaf\xd9\x86\n"
+    "\xed\x95\x9c\xea\xb5\xad\n"
+    "\xd2\x9b\xd0\xb0\xd0\xb7\n"
+    "\xe0\xba\xa5\xe0\xba\xb2\xe0\xba\xa7\n"
+    "\xe0\xb6\xbd\xe0\xb6\x82\xe0\xb6\x9a\xe0\xb7\x8f\n"
+    "\xe0\xae\x87\xe0\xae\xb2\xe0\xae\x99\xe0\xaf\x8d\xe0\xae\x95\xe0\xaf\x88\n"
+    "\xd8\xa7\xd9\x84\xd9\x85\xd8\xba\xd8\xb1\xd8\xa8\n"
+    "\xd0\xbc\xd0\xba\xd0\xb4\n"
+    "\xd0\xbc\xd0\xbe\xd0\xbd\n"
+    "\xe6\xbe\xb3\xe9\x96\x80\n"
+    "\xe6\xbe\xb3\xe9\x97\xa8\n"
+    "\xd9\x85\xd9\x84\xd9\x8a\xd8\xb3\xd9\x8a\xd8\xa7\n"
+    "\xd8\xb9\xd9\x85\xd8\xa7\xd9\x86\n"
+    "\xd9\xbe\xd8\xa7\xda\xa9\xd8\xb3\xd8\xaa\xd8\xa7\xd9\x86\n"
+    "\xd9\xbe\xd8\xa7\xd9\x83\xd8\xb3\xd8\xaa\xd8\xa7\xd9\x86\n"
+    "\xd9\x81\xd9\x84\xd8\xb3\xd8\xb7\xd9\x8a\xd9\x86\n"
+    "\xd1\x81\xd1\x80\xd0\xb1\n"
+    "\xd0\xbf\xd1\x80.\xd1\x81\xd1\x80\xd0\xb1\n"
+    "\xd0\xbe\xd1\x80\xd0\xb3.\xd1\x81\xd1\x80\xd0\xb1\n"
+    "\xd0\xbe\xd0\xb1\xd1\x80.\xd1\x81\xd1\x80\xd0\xb1\n"
+    "\xd0\xbe\xd0\xb4.\xd1\x81\xd1\x80\xd0\xb1\n"
+    "\xd1\x83\xd0\xbf\xd1\x80.\xd1\x81\xd1\x80\xd0\xb1\n"
+    "\xd0\xb0\xd0\xba.\xd1\x81\xd1\x80\xd0\xb1\n"
+    "\xd1\x80\xd1\x84\n"
+    "\xd9\x82\xd8\xb7\xd8\xb1\n"
+    "\xd8\xa7\xd9\x84\xd8\xb3\xd8\xb9\xd9\x88\xd8\xaf\xd9\x8a\xd8\xa9\n"
+    "\xd8\xa7\xd9\x84\xd8\xb3\xd8\xb9\xd9\x88\xd8\xaf\xdb\x8c\xd8\xa9\n"
+    "\xd8\xa7\xd9\x84\xd8\xb3\xd8\xb9\xd9\x88\xd8\xaf\xdb\x8c\xdb\x83\n"
+    "\xd8\xa7\xd9\x84\xd8\xb3\xd8\xb9\xd9\x88\xd8\xaf\xd9\x8a\xd9\x87\n"
+    "\xd8\xb3\xd9\x88\xd8\xaf\xd8\xa7\xd9\x86\n"
+    "\xe6\x96\xb0\xe5\x8a\xa0\xe5\x9d\xa1\n"
+    "\xe0\xae\x9a\xe0\xae\xbf\xe0\xae\x99\xe0\xaf\x8d\xe0\xae\x95\xe0\xae\xaa\xe0\xaf\x8d\xe0\xae\xaa\xe0\xaf\x82\xe0\xae\xb0\xe0\xaf\x8d\n"
+    "\xd8\xb3\xd9\x88\xd8\xb1\xd9\x8a\xd8\xa9\n"
+    "\xd8\xb3\xd9\x88\xd8\xb1\xd9\x8a\xd8\xa7\n"
+    "\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2\n"
+    "\xe0\xb8\xa8\xe0\xb8\xb6\xe0\xb8\x81\xe0\xb8\xa9\xe0\xb8\xb2.\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2\n"
+    "\xe0\xb8\x98\xe0\xb8\xb8\xe0\xb8\xa3\xe0\xb8\x81\xe0\xb8\xb4\xe0\xb8\x88.\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2\n"
+    "\xe0\xb8\xa3\xe0\xb8\xb1\xe0\xb8\x90\xe0\xb8\x9a\xe0\xb8\xb2\xe0\xb8\xa5.\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2\n"
+    "\xe0\xb8\x97\xe0\xb8\xab\xe0\xb8\xb2\xe0\xb8\xa3.\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2\n"
+    "\xe0\xb9\x80\xe0\xb8\x99\xe0\xb9\x87\xe0\xb8\x95.\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2\n"
+    "\xe0\xb8\xad\xe0\xb8\x87\xe0\xb8\x84\xe0\xb9\x8c\xe0\xb8\x81\xe0\xb8\xa3.\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2\n"
+    "\xd8\xaa\xd9\x88\xd9\x86\xd8\xb3\n"
+    "\xe5\x8f\xb0\xe7\x81\xa3\n"
+    "\xe5\x8f\xb0\xe6\xb9\xbe\n"
+    "\xe8\x87\xba\xe7\x81\xa3\n"
+    "\xd1\x83\xd0\xba\xd1\x80\n"
+    "\xd8\xa7\xd9\x84\xd9\x8a\xd9\x85\xd9\x86\n"
+    "xxx\n"
+    "ye\n"
+    "com.ye\n"
+    "edu.ye\n"
+    "gov.ye\n"
+    "net.ye\n"
+    "mil.ye\n"
+    "org.ye\n"
+    "ac.za\n"
+    "agric.za\n"
+    "alt.za\n"
+    "co.za\n"
+    "edu.za\n"
+    "gov.za\n"
+    "grondar.za\n"
+    "law.za\n"
+    "mil.za\n"
+    "net.za\n"
+    "ngo.za\n"
+    "nic.za\n"
+    "nis.za\n"
+    "nom.za\n"
+    "org.za\n"
+    "school.za\n"
+    "tm.za\n"
+    "web.za\n"
+    "zm\n"
+    "ac.zm\n"
+    "biz.zm\n"
+    "co.zm\n"
+    "com.zm\n"
+    "edu.zm\n"
+    "gov.zm\n"
+    "info.zm\n"
+    "mil.zm\n"
+    "net.zm\n"
+    "org.zm\n"
+    "sch.zm\n"
+    "zw\n"
+    "ac.zw\n"
+    "co.zw\n"
+    "gov.zw\n"
+    "mil.zw\n"
+    "org.zw\n"
+    "aaa\n"
+    "aarp\n"
+    "abarth\n"
+    "abb\n"
+    "abbott\n"
+    "abbvie\n"
+    "abc\n"
+    "able\n"
+    "abogado\n"
+    "abudhabi\n"
+    "academy\n"
+    "accenture\n"
+    "accountant\n"
+    "accountants\n"
+    "aco\n"
+    "actor\n"
+    "ads\n"
+    "adult\n"
+    "aeg\n"
+    "aetna\n"
+    "afl\n"
+    "africa\n"
+    "agakhan\n"
+    "agency\n"
+    "aig\n"
+    "airbus\n"
+    "airforce\n"
+    "airtel\n"
+    "akdn\n"
+    "alfaromeo\n"
+    "alibaba\n"
+    "alipay\n"
+    "allfinanz\n"
+    "allstate\n"
+    "ally\n"
+    "alsace\n"
+    "alstom\n"
+    "amazon\n"
+    "americanexpress\n"
+    "americanfamily\n"
+    "amex\n"
+    "amfam\n"
+    "amica\n"
+    "amsterdam\n"
+    "analytics\n"
+    "android\n"
+    "anquan\n"
+    "anz\n"
+    "aol\n"
+    "apartments\n"
+    "app\n"
+    "apple\n"
+    "aquarelle\n"
+    "arab\n"
+    "aramco\n"
+    "archi\n"
+    "army\n"
+    "art\n"
+    "arte\n"
+    "asda\n"
+    "associates\n"
+    "athleta\n"
+    "attorney\n"
+    "auction\n"
+    "audi\n"
+    "audible\n"
+    "audio\n"
+    "auspost\n"
+    "author\n"
+    "auto\n"
+    "autos\n"
+    "avianca\n"
+    "aws\n"
+    "axa\n"
+    "azure\n"
+    "baby\n"
+    "baidu\n"
+    "banamex\n"
+    "bananarepublic\n"
+    "band\n"
+    "bank\n"
+    "bar\n"
+    "barcelona\n"
+    "barclaycard\n"
+    "barclays\n"
+    "barefoot\n"
+    "bargains\n"
+    "baseball\n"
+    "basketball\n"
+    "bauhaus\n"
+    "bayern\n"
+    "bbc\n"
+    "bbt\n"
+    "bbva\n"
+    "bcg\n"
+    "bcn\n"
+    "beats\n"
+    "beauty\n"
+    "beer\n"
+    "bentley\n"
+    "berlin\n"
+    "best\n"
+    "bestbuy\n"
+    "bet\n"
+    "bharti\n"
+    "bible\n"
+    "bid\n"
+    "bike\n"
+    "bing\n"
+    "bingo\n"
+    "bio\n"
+    "black\n"
+    "blackfriday\n"
+    "blockbuster\n"
+    "blog\n"
+    "bloomberg\n"
+    "blue\n"
+    "bms\n"
+    "bmw\n"
+    "bnpparibas\n"
+    "boats\n"
+    "boehringer\n"
+    "bofa\n"
+    "bom\n"
+    "bond\n"
+    "boo\n"
+    "book\n"
+    "booking\n"
+    "bosch\n"
+    "bostik\n"
+    "boston\n"
+    "bot\n"
+    "boutique\n"
+    "box\n"
+    "bradesco\n"
+    "bridgestone\n"
+    "broadway\n"
+    "broker\n"
+    "brother\n"
+    "brussels\n"
+    "build\n"
+    "builders\n"
+    "business\n"
+    "buy\n"
+    "buzz\n"
+    "bzh\n"
+    "cab\n"
+    "cafe\n"
+    "cal\n"
+    "call\n"
+    "calvinklein\n"
+    "cam\n"
+    "camera\n"
+    "camp\n"
+    "canon\n"
+    "capetown\n"
+    "capital\n"
+    "capitalone\n"
+    "car\n"
+    "caravan\n"
+    "cards\n"
+    "care\n"
+    "career\n"
+    "careers\n"
+    "cars\n"
+    "casa\n"
+    "case\n"
+    "cash\n"
+    "casino\n"
+    "catering\n"
+    "catholic\n"
+    "cba\n"
+    "cbn\n"
+    "cbre\n"
+    "cbs\n"
+    "center\n"
+    "ceo\n"
+    "cern\n"
+    "cfa\n"
+    "cfd\n"
+    "chanel\n"
+    "channel\n"
+    "charity\n"
+    "chase\n"
+    "chat\n"
+    "cheap\n"
+    "chintai\n"
+    "christmas\n"
+    "chrome\n"
+    "church\n"
+    "cipriani\n"
+    "circle\n"
+    "cisco\n"
+    "citadel\n"
+    "citi\n"
+    "citic\n"
+    "city\n"
+    "cityeats\n"
+    "claims\n"
+    "cleaning\n"
+    "click\n"
+    "clinic\n"
+    "clinique\n"
+    "clothing\n"
+    "cloud\n"
+    "club\n"
+    "clubmed\n"
+    "coach\n"
+    "codes\n"
+    "coffee\n"
+    "college\n"
+    "cologne\n"
+    "comcast\n"
+    "commbank\n"
+    "community\n"
+    "company\n"
+    "compare\n"
+    "computer\n"
+    "comsec\n"
+    "condos\n"
+    "construction\n"
+    "consulting\n"
+    "contact\n"
+    "contractors\n"
+    "cooking\n"
+    "cookingchannel\n"
+    "cool\n"
+    "corsica\n"
+    "country\n"
+    "coupon\n"
+    "coupons\n"
+    "courses\n"
+    "cpa\n"
+    "credit\n"
+    "creditcard\n"
+    "creditunion\n"
+    "cricket\n"
+    "crown\n"
+    "crs\n"
+    "cruise\n"
+    "cruises\n"
+    "cuisinella\n"
+    "cymru\n"
+    "cyou\n"
+    "dabur\n"
+    "dad\n"
+    "dance\n"
+    "data\n"
+    "date\n"
+    "dating\n"
+    "datsun\n"
+    "day\n"
+    "dclk\n"
+    "dds\n"
+    "deal\n"
+    "dealer\n"
+    "deals\n"
+    "degree\n"
+    "delivery\n"
+    "dell\n"
+    "deloitte\n"
+    "delta\n"
+    "democrat\n"
+    "dental\n"
+    "dentist\n"
+    "desi\n"
+    "design\n"
+    "dev\n"
+    "dhl\n"
+    "diamonds\n"
+    "diet\n"
+    "digital\n"
+    "direct\n"
+    "directory\n"
+    "discount\n"
+    "discover\n"
+    "dish\n"
+    "diy\n"
+    "dnp\n"
+    "docs\n"
+    "doctor\n"
+    "dog\n"
+    "domains\n"
+    "dot\n"
+    "download\n"
+    "drive\n"
+    "dtv\n"
+    "dubai\n"
+    "dunlop\n"
+    "dupont\n"
+    "durban\n"
+    "dvag\n"
+    "dvr\n"
+    "earth\n"
+    "eat\n"
+    "eco\n"
+    "edeka\n"
+    "education\n"
+    "email\n"
+    "emerck\n"
+    "energy\n"
+    "engineer\n"
+    "engineering\n"
+    "enterprises\n"
+    "epson\n"
+    "equipment\n"
+    "ericsson\n"
+    "erni\n"
+    "esq\n"
+    "estate\n"
+    "etisalat\n"
+    "eurovision\n"
+    "eus\n"
+    "events\n"
+    "exchange\n"
+    "expert\n"
+    "exposed\n"
+    "express\n"
+    "extraspace\n"
+    "fage\n"
+    "fail\n"
+    "fairwinds\n"
+    "faith\n"
+    "family\n"
+    "fan\n"
+    "fans\n"
+    "farm\n"
+    "farmers\n"
+    "fashion\n"
+    "fast\n"
+    "fedex\n"
+    "feedback\n"
+    "ferrari\n"
+    "ferrero\n"
+    "fiat\n"
+    "fidelity\n"
+    "fido\n"
+    "film\n"
+    "final\n"
+    "finance\n"
+    "financial\n"
+    "fire\n"
+    "firestone\n"
+    "firmdale\n"
+    "fish\n"
+    "fishing\n"
+    "fit\n"
+    "fitness\n"
+    "flickr\n"
+    "flights\n"
+    "flir\n"
+    "florist\n"
+    "flowers\n"
+    "fly\n"
+    "foo\n"
+    "food\n"
+    "foodnetwork\n"
+    "football\n"
+    "ford\n"
+    "forex\n"
+    "forsale\n"
+    "forum\n"
+    "foundation\n"
+    "fox\n"
+    "free\n"
+    "fresenius\n"
+    "frl\n"
+    "frogans\n"
+    "frontdoor\n"
+    "frontier\n"
+    "ftr\n"
+    "fujitsu\n"
+    "fun\n"
+    "fund\n"
+    "furniture\n"
+    "futbol\n"
+    "fyi\n"
+    "gal\n"
+    "gallery\n"
+    "gallo\n"
+    "gallup\n"
+    "game\n"
+    "games\n"
+    "gap\n"
+    "garden\n"
+    "gay\n"
+    "gbiz\n"
+    "gdn\n"
+    "gea\n"
+    "gent\n"
+    "genting\n"
+    "george\n"
+    "ggee\n"
+    "gift\n"
+    "gifts\n"
+    "gives\n"
+    "giving\n"
+    "glass\n"
+    "gle\n"
+    "global\n"
+    "globo\n"
+    "gmail\n"
+    "gmbh\n"
+    "gmo\n"
+    "gmx\n"
+    "godaddy\n"
+    "gold\n"
+    "goldpoint\n"
+    "golf\n"
+    "goo\n"
+    "goodyear\n"
+    "goog\n"
+    "google\n"
+    "gop\n"
+    "got\n"
+    "grainger\n"
+    "graphics\n"
+    "gratis\n"
+    "green\n"
+    "gripe\n"
+    "grocery\n"
+    "group\n"
+    "guardian\n"
+    "gucci\n"
+    "guge\n"
+    "guide\n"
+    "guitars\n"
+    "guru\n"
+    "hair\n"
+    "hamburg\n"
+    "hangout\n"
+    "haus\n"
+    "hbo\n"
+    "hdfc\n"
+    "hdfcbank\n"
+    "health\n"
+    "healthcare\n"
+    "help\n"
+    "helsinki\n"
+    "here\n"
+    "hermes\n"
+    "hgtv\n"
+    "hiphop\n"
+    "hisamitsu\n"
+    "hitachi\n"
+    "hiv\n"
+    "hkt\n"
+    "hockey\n"
+    "holdings\n"
+    "holiday\n"
+    "homedepot\n"
+    "homegoods\n"
+    "homes\n"
+    "homesense\n"
+    "honda\n"
+    "horse\n"
+    "hospital\n"
+    "host\n"
+    "hosting\n"
+    "hot\n"
+    "hoteles\n"
+    "hotels\n"
+    "hotmail\n"
+    "house\n"
+    "how\n"
+    "hsbc\n"
+    "hughes\n"
+    "hyatt\n"
+    "hyundai\n"
+    "ibm\n"
+    "icbc\n"
+    "ice\n"
+    "icu\n"
+    "ieee\n"
+    "ifm\n"
+    "ikano\n"
+    "imamat\n"
+    "imdb\n"
+    "immo\n"
+    "immobilien\n"
+    "inc\n"
+    "industries\n"
+    "infiniti\n"
+    "ing\n"
+    "ink\n"
+    "institute\n"
+    "insurance\n"
+    "insure\n"
+    "international\n"
+    "intuit\n"
+    "investments\n"
+    "ipiranga\n"
+    "irish\n"
+    "ismaili\n"
+    "ist\n"
+    "istanbul\n"
+    "itau\n"
+    "itv\n"
+    "jaguar\n"
+    "java\n"
+    "jcb\n"
+    "jeep\n"
+    "jetzt\n"
+    "jewelry\n"
+    "jio\n"
+    "jll\n"
+    "jmp\n"
+    "jnj\n"
+    "joburg\n"
+    "jot\n"
+    "joy\n"
+    "jpmorgan\n"
+    "jprs\n"
+    "juegos\n"
+    "juniper\n"
+    "kaufen\n"
+    "kddi\n"
+    "kerryhotels\n"
+    "kerrylogistics\n"
+    "kerryproperties\n"
+    "kfh\n"
+    "kia\n"
+    "kids\n"
+    "kim\n"
+    "kinder\n"
+    "kindle\n"
+    "kitchen\n"
+    "kiwi\n"
+    "koeln\n"
+    "komatsu\n"
+    "kosher\n"
+    "kpmg\n"
+    "kpn\n"
+    "krd\n"
+    "kred\n"
+    "kuokgroup\n"
+    "kyoto\n"
+    "lacaixa\n"
+    "lamborghini\n"
+    "lamer\n"
+    "lancaster\n"
+    "lancia\n"
+    "land\n"
+    "landrover\n"
+    "lanxess\n"
+    "lasalle\n"
+    "lat\n"
+    "latino\n"
+    "latrobe\n"
+    "law\n"
+    "lawyer\n"
+    "lds\n"
+    "lease\n"
+    "leclerc\n"
+    "lefrak\n"
+    "legal\n"
+    "lego\n"
+    "lexus\n"
+    "lgbt\n"
+    "lidl\n"
+    "life\n"
+    "lifeinsurance\n"
+    "lifestyle\n"
+    "lighting\n"
+    "like\n"
+    "lilly\n"
+    "limited\n"
+    "limo\n"
+    "lincoln\n"
+    "linde\n"
+    "link\n"
+    "lipsy\n"
+    "live\n"
+    "living\n"
+    "llc\n"
+    "llp\n"
+    "loan\n"
+    "loans\n"
+    "locker\n"
+    "locus\n"
+    "lol\n"
+    "london\n"
+    "lotte\n"
+    "lotto\n"
+    "love\n"
+    "lpl\n"
+    "lplfinancial\n"
+    "ltd\n"
+    "ltda\n"
+    "lundbeck\n"
+    "luxe\n"
+    "luxury\n"
+    "macys\n"
+    "madrid\n"
+    "maif\n"
+    "maison\n"
+    "makeup\n"
+    "man\n"
+    "management\n"
+    "mango\n"
+    "map\n"
+    "market\n"
+    "marketing\n"
+    "markets\n"
+    "marriott\n"
+    "marshalls\n"
+    "maserati\n"
+    "mattel\n"
+    "mba\n"
+    "mckinsey\n"
+    "med\n"
+    "media\n"
+    "meet\n"
+    "melbourne\n"
+    "meme\n"
+    "memorial\n"
+    "men\n"
+    "menu\n"
+    "merckmsd\n"
+    "miami\n"
+    "microsoft\n"
+    "mini\n"
+    "mint\n"
+    "mit\n"
+    "mitsubishi\n"
+    "mlb\n"
+    "mls\n"
+    "mma\n"
+    "mobile\n"
+    "moda\n"
+    "moe\n"
+    "moi\n"
+    "mom\n"
+    "monash\n"
+    "money\n"
+    "monster\n"
+    "mormon\n"
+    "mortgage\n"
+    "moscow\n"
+    "moto\n"
+    "motorcycles\n"
+    "mov\n"
+    "movie\n"
+    "msd\n"
+    "mtn\n"
+    "mtr\n"
+    "music\n"
+    "mutual\n"
+    "nab\n"
+    "nagoya\n"
+    "natura\n"
+    "navy\n"
+    "nba\n"
+    "nec\n"
+    "netbank\n"
+    "netflix\n"
+    "network\n"
+    "neustar\n"
+    "new\n"
+    "news\n"
+    "next\n"
+    "nextdirect\n"
+    "nexus\n"
+    "nfl\n"
+    "ngo\n"
+    "nhk\n"
+    "nico\n"
+    "nike\n"
+    "nikon\n"
+    "ninja\n"
+    "nissan\n"
+    "nissay\n"
+    "nokia\n"
+    "northwesternmutual\n"
+    "norton\n"
+    "now\n"
+    "nowruz\n"
+    "nowtv\n"
+    "nra\n"
+    "nrw\n"
+    "ntt\n"
+    "nyc\n"
+    "obi\n"
+    "observer\n"
+    "office\n"
+    "okinawa\n"
+    "olayan\n"
+    "olayangroup\n"
+    "oldnavy\n"
+    "ollo\n"
+    "omega\n"
+    "one\n"
+    "ong\n"
+    "onl\n"
+    "online\n"
+    "ooo\n"
+    "open\n"
+    "oracle\n"
+    "orange\n"
+    "organic\n"
+    "origins\n"
+    "osaka\n"
+    "otsuka\n"
+    "ott\n"
+    "ovh\n"
+    "page\n"
+    "panasonic\n"
+    "paris\n"
+    "pars\n"
+    "partners\n"
+    "parts\n"
+    "party\n"
+    "passagens\n"
+    "pay\n"
+    "pccw\n"
+    "pet\n"
+    "pfizer\n"
+    "pharmacy\n"
+    "phd\n"
+    "philips\n"
+    "phone\n"
+    "photo\n"
+    "photography\n"
+    "photos\n"
+    "physio\n"
+    "pics\n"
+    "pictet\n"
+    "pictures\n"
+    "pid\n"
+    "pin\n"
+    "ping\n"
+    "pink\n"
+    "pioneer\n"
+    "pizza\n"
+    "place\n"
+    "play\n"
+    "playstation\n"
+    "plumbing\n"
+    "plus\n"
+    "pnc\n"
+    "pohl\n"
+    "poker\n"
+    "politie\n"
+    "porn\n"
+    "pramerica\n"
+    "praxi\n"
+    "press\n"
+    "prime\n"
+    "prod\n"
+    "productions\n"
+    "prof\n"
+    "progressive\n"
+    "promo\n"
+    "properties\n"
+    "property\n"
+    "protection\n"
+    "pru\n"
+    "prudential\n"
+    "pub\n"
+    "pwc\n"
+    "qpon\n"
+    "quebec\n"
+    "quest\n"
+    "racing\n"
+    "radio\n"
+    "read\n"
+    "realestate\n"
+    "realtor\n"
+    "realty\n"
+    "recipes\n"
+    "red\n"
+    "redstone\n"
+    "redumbrella\n"
+    "rehab\n"
+    "reise\n"
+    "reisen\n"
+    "reit\n"
+    "reliance\n"
+    "ren\n"
+    "rent\n"
+    "rentals\n"
+    "repair\n"
+    "report\n"
+    "republican\n"
+    "rest\n"
+    "restaurant\n"
+    "review\n"
+    "reviews\n"
+    "rexroth\n"
+    "rich\n"
+    "richardli\n"
+    "ricoh\n"
+    "ril\n"
+    "rio\n"
+    "rip\n"
+    "rocher\n"
+    "rocks\n"
+    "rodeo\n"
+    "rogers\n"
+    "room\n"
+    "rsvp\n"
+    "rugby\n"
+    "ruhr\n"
+    "run\n"
+    "rwe\n"
+    "ryukyu\n"
+    "saarland\n"
+    "safe\n"
+    "safety\n"
+    "sakura\n"
+    "sale\n"
+    "salon\n"
+    "samsclub\n"
+    "samsung\n"
+    "sandvik\n"
+    "sandvikcoromant\n"
+    "sanofi\n"
+    "sap\n"
+    "sarl\n"
+    "sas\n"
+    "save\n"
+    "saxo\n"
+    "sbi\n"
+    "sbs\n"
+    "sca\n"
+    "scb\n"
+    "schaeffler\n"
+    "schmidt\n"
+    "scholarships\n"
+    "school\n"
+    "schule\n"
+    "schwarz\n"
+    "science\n"
+    "scot\n"
+    "search\n"
+    "seat\n"
+    "secure\n"
+    "security\n"
+    "seek\n"
+    "select\n"
+    "sener\n"
+    "services\n"
+    "seven\n"
+    "sew\n"
+    "sex\n"
+    "sexy\n"
+    "sfr\n"
+    "shangrila\n"
+    "sharp\n"
+    "shaw\n"
+    "shell\n"
+    "shia\n"
+    "shiksha\n"
+    "shoes\n"
+    "shop\n"
+    "shopping\n"
+    "shouji\n"
+    "show\n"
+    "showtime\n"
+    "silk\n"
+    "sina\n"
+    "singles\n"
+    "site\n"
+    "ski\n"
+    "skin\n"
+    "sky\n"
+    "skype\n"
+    "sling\n"
+    "smart\n"
+    "smile\n"
+    "sncf\n"
+    "soccer\n"
+    "social\n"
+    "softbank\n"
+    "software\n"
+    "sohu\n"
+    "solar\n"
+    "solutions\n"
+    "song\n"
+    "sony\n"
+    "soy\n"
+    "spa\n"
+    "space\n"
+    "sport\n"
+    "spot\n"
+    "srl\n"
+    "stada\n"
+    "staples\n"
+    "star\n"
+    "statebank\n"
+    "statefarm\n"
+    "stc\n"
+    "stcgroup\n"
+    "stockholm\n"
+    "storage\n"
+    "store\n"
+    "stream\n"
+    "studio\n"
+    "study\n"
+    "style\n"
+    "sucks\n"
+    "supplies\n"
+    "supply\n"
+    "support\n"
+    "surf\n"
+    "surgery\n"
+    "suzuki\n"
+    "swatch\n"
+    "swiss\n"
+    "sydney\n"
+    "systems\n"
+    "tab\n"
+    "taipei\n"
+    "talk\n"
+    "taobao\n"
+    "target\n"
+    "tatamotors\n"
+    "tatar\n"
+    "tattoo\n"
+    "tax\n"
+    "taxi\n"
+    "tci\n"
+    "tdk\n"
+    "team\n"
+    "tech\n"
+    "technology\n"
+    "temasek\n"
+    "tennis\n"
+    "teva\n"
+    "thd\n"
+    "theater\n"
+    "theatre\n"
+    "tiaa\n"
+    "tickets\n"
+    "tienda\n"
+    "tiffany\n"
+    "tips\n"
+    "tires\n"
+    "tirol\n"
+    "tjmaxx\n"
+    "tjx\n"
+    "tkmaxx\n"
+    "tmall\n"
+    "today\n"
+    "tokyo\n"
+    "tools\n"
+    "top\n"
+    "toray\n"
+    "toshiba\n"
+    "total\n"
+    "tours\n"
+    "town\n"
+    "toyota\n"
+    "toys\n"
+    "trade\n"
+    "trading\n"
+    "training\n"
+    "travel\n"
+    "travelchannel\n"
+    "travelers\n"
+    "travelersinsurance\n"
+    "trust\n"
+    "trv\n"
+    "tube\n"
+    "tui\n"
+    "tunes\n"
+    "tushu\n"
+    "tvs\n"
+    "ubank\n"
+    "ubs\n"
+    "unicom\n"
+    "university\n"
+    "uno\n"
+    "uol\n"
+    "ups\n"
+    "vacations\n"
+    "vana\n"
+    "vanguard\n"
+    "vegas\n"
+    "ventures\n"
+    "verisign\n"
+    "versicherung\n"
+    "vet\n"
+    "viajes\n"
+    "video\n"
+    "vig\n"
+    "viking\n"
+    "villas\n"
+    "vin\n"
+    "vip\n"
+    "virgin\n"
+    "visa\n"
+    "vision\n"
+    "viva\n"
+    "vivo\n"
+    "vlaanderen\n"
+    "vodka\n"
+    "volkswagen\n"
+    "volvo\n"
+    "vote\n"
+    "voting\n"
+    "voto\n"
+    "voyage\n"
+    "vuelos\n"
+    "wales\n"
+    "walmart\n"
+    "walter\n"
+    "wang\n"
+    "wanggou\n"
+    "watch\n"
+    "watches\n"
+    "weather\n"
+    "weatherchannel\n"
+    "webcam\n"
+    "weber\n"
+    "website\n"
+    "wedding\n"
+    "weibo\n"
+    "weir\n"
+    "whoswho\n"
+    "wien\n"
+    "wiki\n"
+    "williamhill\n"
+    "win\n"
+    "windows\n"
+    "wine\n"
+    "winners\n"
+    "wme\n"
+    "wolterskluwer\n"
+    "woodside\n"
+    "work\n"
+    "works\n"
+    "world\n"
+    "wow\n"
+    "wtc\n"
+    "wtf\n"
+    "xbox\n"
+    "xerox\n"
+    "xfinity\n"
+    "xihuan\n"
+    "xin\n"
+    "\xe0\xa4\x95\xe0\xa5\x89\xe0\xa4\xae\n"
+    "\xe3\x82\xbb\xe3\x83\xbc\xe3\x83\xab\n"
+    "\xe4\xbd\x9b\xe5\xb1\xb1\n"
+    "\xe6\x85\x88\xe5\x96\x84\n"
+    "\xe9\x9b\x86\xe5\x9b\xa2\n"
+    "\xe5\x9c\xa8\xe7\xba\xbf\n"
+    "\xe7\x82\xb9\xe7\x9c\x8b\n"
+    "\xe0\xb8\x84\xe0\xb8\xad\xe0\xb8\xa1\n"
+    "\xe5\x85\xab\xe5\x8d\xa6\n"
+    "\xd9\x85\xd9\x88\xd9\x82\xd8\xb9\n"
+    "\xe5\x85\xac\xe7\x9b\x8a\n"
+    "\xe5\x85\xac\xe5\x8f\xb8\n"
+    "\xe9\xa6\x99\xe6\xa0\xbc\xe9\x87\x8c\xe6\x8b\x89\n"
+    "\xe7\xbd\x91\xe7\xab\x99\n"
+    "\xe7\xa7\xbb\xe5\x8a\xa8\n"
+    "\xe6\x88\x91\xe7\x88\xb1\xe4\xbd\xa0\n"
+    "\xd0\xbc\xd0\xbe\xd1\x81\xd0\xba\xd0\xb2\xd0\xb0\n"
+    "\xd0\xba\xd0\xb0\xd1\x82\xd0\xbe\xd0\xbb\xd0\xb8\xd0\xba\n"
+    "\xd0\xbe\xd0\xbd\xd0\xbb\xd0\xb0\xd0\xb9\xd0\xbd\n"
+    "\xd1\x81\xd0\xb0\xd0\xb9\xd1\x82\n"
+    "\xe8\x81\x94\xe9\x80\x9a\n"
+    "\xd7\xa7\xd7\x95\xd7\x9d\n"
+    "\xe6\x97\xb6\xe5\xb0\x9a\n"
+    "\xe5\xbe\xae\xe5\x8d\x9a\n"
+    "\xe6\xb7\xa1\xe9\xa9\xac\xe9\x94\xa1\n"
+    "\xe3\x83\x95\xe3\x82\xa1\xe3\x83\x83\xe3\x82\xb7\xe3\x83\xa7\xe3\x83\xb3\n"
+    "\xd0\xbe\xd1\x80\xd0\xb3\n"
+    "\xe0\xa4\xa8\xe0\xa5\x87\xe0\xa4\x9f\n"
+    "\xe3\x82\xb9\xe3\x83\x88\xe3\x82\xa2\n"
+    "\xe3\x82\xa2\xe3\x83\x9e\xe3\x82\xbe\xe3\x83\xb3\n"
+    "\xec\x82\xbc\xec\x84\xb1\n"
+    "\xe5\x95\x86\xe6\xa0\x87\n"
+    "\xe5\x95\x86\xe5\xba\x97\n"
+    "\xe5\x95\x86\xe5\x9f\x8e\n"
+    "\xd0\xb4\xd0\xb5\xd1\x82\xd0\xb8\n"
+    "\xe3\x83\x9d\xe3\x82\xa4\xe3\x83\xb3\xe3\x83\x88\n"
+    "\xe6\x96\xb0\xe9\x97\xbb\n"
+    "\xe5\xae\xb6\xe9\x9b\xbb\n"
+    "\xd9\x83\xd9\x88\xd9\x85\n"
+    "\xe4\xb8\xad\xe6\x96\x87\xe7\xbd\x91\n"
+    "\xe4\xb8\xad\xe4\xbf\xa1\n"
+    "\xe5\xa8\xb1\xe4\xb9\x90\n"
+    "\xe8\xb0\xb7\xe6\xad\x8c\n"
+    "\xe9\x9b\xbb\xe8\xa8\x8a\xe7\x9b\x88\xe7\xa7\x91\n"
+    "\xe8\xb4\xad\xe7\x89\xa9\n"
+    "\xe3\x82\xaf\xe3\x83\xa9\xe3\x82\xa6\xe3\x83\x89\n"
+    "\xe9\x80\x9a\xe8\xb2\xa9\n"
+    "\xe7\xbd\x91\xe5\xba\x97\n"
+    "\xe0\xa4\xb8\xe0\xa4\x82\xe0\xa4\x97\xe0\xa4\xa0\xe0\xa4\xa8\n"
+    "\xe9\xa4\x90\xe5\x8e\x85\n"
+    "\xe7\xbd\x91\xe7\xbb\x9c\n"
+    "\xd0\xba\xd0\xbe\xd0\xbc\n"
+    "\xe4\xba\x9a\xe9\xa9\xac\xe9\x80\x8a\n"
+    "\xe9\xa3\x9f\xe5\x93\x81\n"
+    "\xe9\xa3\x9e\xe5\x88\xa9\xe6\xb5\xa6\n"
+    "\xe6\x89\x8b\xe6\x9c\xba\n"
+    "\xd8\xa7\xd8\xb1\xd8\xa7\xd9\x85\xd9\x83\xd9\x88\n"
+    "\xd8\xa7\xd9\x84\xd8\xb9\xd9\x84\xd9\x8a\xd8\xa7\xd9\x86\n"
+    "\xd8\xa7\xd8\xaa\xd8\xb5\xd8\xa7\xd9\x84\xd8\xa7\xd8\xaa\n"
+    "\xd8\xa8\xd8\xa7\xd8\xb2\xd8\xa7\xd8\xb1\n"
+    "\xd8\xa7\xd8\xa8\xd9\x88\xd8\xb8\xd8\xa8\xd9\x8a\n"
+    "\xd9\x83\xd8\xa7\xd8\xab\xd9\x88\xd9\x84\xd9\x8a\xd9\x83\n"
+    "\xd9\x87\xd9\x85\xd8\xb1\xd8\xa7\xd9\x87\n"
+    "\xeb\x8b\xb7\xec\xbb\xb4\n"
+    "\xe6\x94\xbf\xe5\xba\x9c\n"
+    "\xd8\xb4\xd8\xa8\xd9\x83\xd8\xa9\n"
+    "\xd8\xa8\xd9\x8a\xd8\xaa\xd9\x83\n"
+    "\xd8\xb9\xd8\xb1\xd8\xa8\n"
+    "\xe6\x9c\xba\xe6\x9e\x84\n"
+    "\xe7\xbb\x84\xe7\xbb\x87\xe6\x9c\xba\xe6\x9e\x84\n"
+    "\xe5\x81\xa5\xe5\xba\xb7\n"
+    "\xe6\x8b\x9b\xe8\x81\x98\n"
+    "\xd1\x80\xd1\x83\xd1\x81\n"
+    "\xe5\xa4\xa7\xe6\x8b\xbf\n"
+    "\xe3\x81\xbf\xe3\x82\x93\xe3\x81\xaa\n"
+    "\xe3\x82\xb0\xe3\x83\xbc\xe3\x82\xb0\xe3\x83\xab\n"
+    "\xe4\xb8\x96\xe7\x95\x8c\n"
+    "\xe6\x9b\xb8\xe7\xb1\x8d\n"
+    "\xe7\xbd\x91\xe5\x9d\x80\n"
+    "\xeb\x8b\xb7\xeb\x84\xb7\n"
+    "\xe3\x82\xb3\xe3\x83\xa0\n"
+    "\xe5\xa4\xa9\xe4\xb8\xbb\xe6\x95\x99\n"
+    "\xe6\xb8\xb8\xe6\x88\x8f\n"
+    "verm\xc3\xb6gensberater\n"
+    "verm\xc3\xb6gensberatung\n"
+    "\xe4\xbc\x81\xe4\xb8\x9a\n"
+    "\xe4\xbf\xa1\xe6\x81\xaf\n"
+    "\xe5\x98\x89\xe9\x87\x8c\xe5\xa4\xa7\xe9\x85\x92\xe5\xba\x97\n"
+    "\xe5\x98\x89\xe9\x87\x8c\n"
+    "\xe5\xb9\xbf\xe4\xb8\x9c\n"
+    "\xe6\x94\xbf\xe5\x8a\xa1\n"
+    "xyz\n"
+    "yachts\n"
+    "yahoo\n"
+    "yamaxun\n"
+    "yandex\n"
+    "yodobashi\n"
+    "yoga\n"
+    "yokohama\n"
+    "you\n"
+    "youtube\n"
+    "yun\n"
+    "zappos\n"
+    "zara\n"
+    "zero\n"
+    "zip\n"
+    "zone\n"
+    "zuerich\n"
+    "// ===BEGIN PRIVATE DOMAINS===\n"
+    "cc.ua\n"
+    "inf.ua\n"
+    "ltd.ua\n"
+    "611.to\n"
+    "graphox.us\n"
+    "*.devcdnaccesso.com\n"
+    "*.on-acorn.io\n"
+    "activetrail.biz\n"
+    "adobeaemcloud.com\n"
+    "*.dev.adobeaemcloud.com\n"
+    "hlx.live\n"
+    "adobeaemcloud.net\n"
+    "hlx.page\n"
+    "hlx3.page\n"
+    "adobeio-static.net\n"
+    "adobeioruntime.net\n"
+    "beep.pl\n"
+    "airkitapps.com\n"
+    "airkitapps-au.com\n"
+    "airkitapps.eu\n"
+    "aivencloud.com\n"
+    "akadns.net\n"
+    "akamai.net\n"
+    "akamai-staging.net\n",
+
+    "akamaiedge.net\n"
+    "akamaiedge-staging.net\n"
+    "akamaihd.net\n"
+    "akamaihd-staging.net\n"
+    "akamaiorigin.net\n"
+    "akamaiorigin-staging.net\n"
+    "akamaized.net\n"
+    "akamaized-staging.net\n"
+    "edgekey.net\n"
+    "edgekey-staging.net\n"
+    "edgesuite.net\n"
+    "edgesuite-staging.net\n"
+    "barsy.ca\n"
+    "*.compute.estate\n"
+    "*.alces.network\n"
+    "kasserver.com\n"
+    "altervista.org\n"
+    "alwaysdata.net\n"
+    "myamaze.net\n"
+    "cloudfront.net\n"
+    "*.compute.amazonaws.com\n"
+    "*.compute-1.amazonaws.com\n"
+    "*.compute.amazonaws.com.cn\n"
+    "us-east-1.amazonaws.com\n"
+    "s3.cn-north-1.amazonaws.com.cn\n"
+    "s3.dualstack.ap-northeast-1.amazonaws.com\n"
+    "s3.dualstack.ap-northeast-2.amazonaws.com\n"
+    "s3.ap-northeast-2.amazonaws.com\n"
+    "s3-website.ap-northeast-2.amazonaws.com\n"
+    "s3.dualstack.ap-south-1.amazonaws.com\n"
+    "s3.ap-south-1.amazonaws.com\n"
+    "s3-website.ap-south-1.amazonaws.com\n"
+    "s3.dualstack.ap-southeast-1.amazonaws.com\n"
+    "s3.dualstack.ap-southeast-2.amazonaws.com\n"
+    "s3.dualstack.ca-central-1.amazonaws.com\n"
+    "s3.ca-central-1.amazonaws.com\n"
+    "s3-website.ca-central-1.amazonaws.com\n"
+    "s3.dualstack.eu-central-1.amazonaws.com\n"
+    "s3.eu-central-1.amazonaws.com\n"
+    "s3-website.eu-central-1.amazonaws.com\n"
+    "s3.dualstack.eu-west-1.amazonaws.com\n"
+    "s3.dualstack.eu-west-2.amazonaws.com\n"
+    "s3.eu-west-2.amazonaws.com\n"
+    "s3-website.eu-west-2.amazonaws.com\n"
+    "s3.dualstack.eu-west-3.amazonaws.com\n"
+    "s3.eu-west-3.amazonaws.com\n"
+    "s3-website.eu-west-3.amazonaws.com\n"
+    "s3.amazonaws.com\n"
+    "s3-ap-northeast-1.amazonaws.com\n"
+    "s3-ap-northeast-2.amazonaws.com\n"
+    "s3-ap-south-1.amazonaws.com\n"
+    "s3-ap-southeast-1.amazonaws.com\n"
+    "s3-ap-southeast-2.amazonaws.com\n"
+    "s3-ca-central-1.amazonaws.com\n"
+    "s3-eu-central-1.amazonaws.com\n"
+    "s3-eu-west-1.amazonaws.com\n"
+    "s3-eu-west-2.amazonaws.com\n"
+    "s3-eu-west-3.amazonaws.com\n"
+    "s3-external-1.amazonaws.com\n"
+    "s3-fips-us-gov-west-1.amazonaws.com\n"
+    "s3-sa-east-1.amazonaws.com\n"
+    "s3-us-east-2.amazonaws.com\n"
+    "s3-us-gov-west-1.amazonaws.com\n"
+    "s3-us-west-1.amazonaws.com\n"
+    "s3-us-west-2.amazonaws.com\n"
+    "s3-website-ap-northeast-1.amazonaws.com\n"
+    "s3-website-ap-southeast-1.amazonaws.com\n"
+    "s3-website-ap-southeast-2.amazonaws.com\n"
+    "s3-website-eu-west-1.amazonaws.com\n"
+    "s3-website-sa-east-1.amazonaws.com\n"
+    "s3-website-us-east-1.amazonaws.com\n"
+    "s3-website-us-west-1.amazonaws.com\n"
+    "s3-website-us-west-2.amazonaws.com\n"
+    "s3.dualstack.sa-east-1.amazonaws.com\n"
+    "s3.dualstack.us-east-1.amazonaws.com\n"
+    "s3.dualstack.us-east-2.amazonaws.com\n"
+    "s3.us-east-2.amazonaws.com\n"
+    "s3-website.us-east-2.amazonaws.com\n"
+    "vfs.cloud9.af-south-1.amazonaws.com\n"
+    "webview-assets.cloud9.af-south-1.amazonaws.com\n"
+    "vfs.cloud9.ap-east-1.amazonaws.com\n"
+    "webview-assets.cloud9.ap-east-1.amazonaws.com\n"
+    "vfs.cloud9.ap-northeast-1.amazonaws.com\n"
+    "webview-assets.cloud9.ap-northeast-1.amazonaws.com\n"
+    "vfs.cloud9.ap-northeast-2.amazonaws.com\n"
+    "webview-assets.cloud9.ap-northeast-2.amazonaws.com\n"
+    "vfs.cloud9.ap-northeast-3.amazonaws.com\n"
+    "webview-assets.cloud9.ap-northeast-3.amazonaws.com\n"
+    "vfs.cloud9.ap-south-1.amazonaws.com\n"
+    "webview-assets.cloud9.ap-south-1.amazonaws.com\n"
+    "vfs.cloud9.ap-southeast-1.amazonaws.com\n"
+    "webview-assets.cloud9.ap-southeast-1.amazonaws.com\n"
+    "vfs.cloud9.ap-southeast-2.amazonaws.com\n"
+    "webview-assets.cloud9.ap-southeast-2.amazonaws.com\n"
+    "vfs.cloud9.ca-central-1.amazonaws.com\n"
+    "webview-assets.cloud9.ca-central-1.amazonaws.com\n"
+    "vfs.cloud9.eu-central-1.amazonaws.com\n"
+    "webview-assets.cloud9.eu-central-1.amazonaws.com\n"
+    "vfs.cloud9.eu-north-1.amazonaws.com\n"
+    "webview-assets.cloud9.eu-north-1.amazonaws.com\n"
+    "vfs.cloud9.eu-south-1.amazonaws.com\n"
+    "webview-assets.cloud9.eu-south-1.amazonaws.com\n"
+    "vfs.cloud9.eu-west-1.amazonaws.com\n"
+    "webview-assets.cloud9.eu-west-1.amazonaws.com\n"
+    "vfs.cloud9.eu-west-2.amazonaws.com\n"
+    "webview-assets.cloud9.eu-west-2.amazonaws.com\n"
+    "vfs.cloud9.eu-west-3.amazonaws.com\n"
+    "webview-assets.cloud9.eu-west-3.amazonaws.com\n"
+    "vfs.cloud9.me-south-1.amazonaws.com\n"
+    "webview-assets.cloud9.me-south-1.amazonaws.com\n"
+    "vfs.cloud9.sa-east-1.amazonaws.com\n"
+    "webview-assets.cloud9.sa-east-1.amazonaws.com\n"
+    "vfs.cloud9.us-east-1.amazonaws.com\n"
+    "webview-assets.cloud9.us-east-1.amazonaws.com\n"
+    "vfs.cloud9.us-east-2.amazonaws.com\n"
+    "webview-assets.cloud9.us-east-2.amazonaws.com\n"
+    "vfs.cloud9.us-west-1.amazonaws.com\n"
+    "webview-assets.cloud9.us-west-1.amazonaws.com\n"
+    "vfs.cloud9.us-west-2.amazonaws.com\n"
+    "webview-assets.cloud9.us-west-2.amazonaws.com\n"
+    "cn-north-1.eb.amazonaws.com.cn\n"
+    "cn-northwest-1.eb.amazonaws.com.cn\n"
+    "elasticbeanstalk.com\n"
+    "ap-northeast-1.elasticbeanstalk.com\n"
+    "ap-northeast-2.elasticbeanstalk.com\n"
+    "ap-northeast-3.elasticbeanstalk.com\n"
+    "ap-south-1.elasticbeanstalk.com\n"
+    "ap-southeast-1.elasticbeanstalk.com\n"
+    "ap-southeast-2.elasticbeanstalk.com\n"
+    "ca-central-1.elasticbeanstalk.com\n"
+    "eu-central-1.elasticbeanstalk.com\n"
+    "eu-west-1.elasticbeanstalk.com\n"
+    "eu-west-2.elasticbeanstalk.com\n"
+    "eu-west-3.elasticbeanstalk.com\n"
+    "sa-east-1.elasticbeanstalk.com\n"
+    "us-east-1.elasticbeanstalk.com\n"
+    "us-east-2.elasticbeanstalk.com\n"
+    "us-gov-west-1.elasticbeanstalk.com\n"
+    "us-west-1.elasticbeanstalk.com\n"
+    "us-west-2.elasticbeanstalk.com\n"
+    "*.elb.amazonaws.com.cn\n"
+    "*.elb.amazonaws.com\n"
+    "awsglobalaccelerator.com\n"
+    "eero.online\n"
+    "eero-stage.online\n"
+    "t3l3p0rt.net\n"
+    "tele.amune.org\n"
+    "apigee.io\n"
+    "siiites.com\n"
+    "appspacehosted.com\n"
+    "appspaceusercontent.com\n"
+    "appudo.net\n"
+    "on-aptible.com\n"
+    "user.aseinet.ne.jp\n"
+    "gv.vc\n"
+    "d.gv.vc\n"
+    "user.party.eus\n"
+    "pimienta.org\n"
+    "poivron.org\n"
+    "potager.org\n"
+    "sweetpepper.org\n"
+    "myasustor.com\n"
+    "cdn.prod.atlassian-dev.net\n"
+    "translated.page\n"
+    "autocode.dev\n"
+    "myfritz.net\n"
+    "onavstack.net\n"
+    "*.awdev.ca\n"
+    "*.advisor.ws\n"
+    "ecommerce-shop.pl\n"
+    "b-data.io\n"
+    "backplaneapp.io\n"
+    "balena-devices.com\n"
+    "rs.ba\n"
+    "*.banzai.cloud\n"
+    "app.banzaicloud.io\n"
+    "*.backyards.banzaicloud.io\n"
+    "base.ec\n"
+    "official.ec\n"
+    "buyshop.jp\n"
+    "fashionstore.jp\n"
+    "handcrafted.jp\n"
+    "kawaiishop.jp\n"
+    "supersale.jp\n"
+    "theshop.jp\n"
+    "shopselect.net\n"
+    "base.shop\n"
+    "beagleboard.io\n"
+    "*.beget.app\n"
+    "betainabox.com\n"
+    "bnr.la\n"
+    "bitbucket.io\n"
+    "blackbaudcdn.net\n"
+    "of.je\n"
+    "bluebite.io\n"
+    "boomla.net\n"
+    "boutir.com\n"
+    "boxfuse.io\n"
+    "square7.ch\n"
+    "bplaced.com\n"
+    "bplaced.de\n"
+    "square7.de\n"
+    "bplaced.net\n"
+    "square7.net\n"
+    "shop.brendly.rs\n"
+    "browsersafetymark.io\n"
+    "uk0.bigv.io\n"
+    "dh.bytemark.co.uk\n"
+    "vm.bytemark.co.uk\n"
+    "cafjs.com\n"
+    "mycd.eu\n"
+    "canva-apps.cn\n"
+    "canva-apps.com\n"
+    "drr.ac\n"
+    "uwu.ai\n"
+    "carrd.co\n"
+    "crd.co\n"
+    "ju.mp\n"
+    "ae.org\n"
+    "br.com\n"
+    "cn.com\n"
+    "com.de\n"
+    "com.se\n"
+    "de.com\n"
+    "eu.com\n"
+    "gb.net\n"
+    "hu.net\n"
+    "jp.net\n"
+    "jpn.com\n"
+    "mex.com\n"
+    "ru.com\n"
+    "sa.com\n"
+    "se.net\n"
+    "uk.com\n"
+    "uk.net\n"
+    "us.com\n"
+    "za.bz\n"
+    "za.com\n"
+    "ar.com\n"
+    "hu.com\n"
+    "kr.com\n"
+    "no.com\n"
+    "qc.com\n"
+    "uy.com\n"
+    "africa.com\n"
+    "gr.com\n"
+    "in.net\n"
+    "web.in\n"
+    "us.org\n"
+    "co.com\n"
+    "aus.basketball\n"
+    "nz.basketball\n"
+    "radio.am\n"
+    "radio.fm\n"
+    "c.la\n"
+    "certmgr.org\n"
+    "cx.ua\n"
+    "discourse.group\n"
+    "discourse.team\n"
+    "cleverapps.io\n"
+    "clerk.app\n"
+    "clerkstage.app\n"
+    "*.lcl.dev\n"
+    "*.lclstage.dev\n"
+    "*.stg.dev\n"
+    "*.stgstage.dev\n"
+    "clickrising.net\n"
+    "c66.me\n"
+    "cloud66.ws\n"
+    "cloud66.zone\n"
+    "jdevcloud.com\n"
+    "wpdevcloud.com\n"
+    "cloudaccess.host\n"
+    "freesite.host\n"
+    "cloudaccess.net\n"
+    "cloudcontrolled.com\n"
+    "cloudcontrolapp.com\n"
+    "*.cloudera.site\n"
+    "cf-ipfs.com\n"
+    "cloudflare-ipfs.com\n"
+    "trycloudflare.com\n"
+    "pages.dev\n"
+    "r2.dev\n"
+    "workers.dev\n"
+    "wnext.app\n"
+    "co.ca\n"
+    "*.otap.co\n"
+    "co.cz\n"
+    "c.cdn77.org\n"
+    "cdn77-ssl.net\n"
+    "r.cdn77.net\n"
+    "rsc.cdn77.org\n"
+    "ssl.origin.cdn77-secure.org\n"
+    "cloudns.asia\n"
+    "cloudns.biz\n"
+    "cloudns.club\n"
+    "cloudns.cc\n"
+    "cloudns.eu\n"
+    "cloudns.in\n"
+    "cloudns.info\n"
+    "cloudns.org\n"
+    "cloudns.pro\n"
+    "cloudns.pw\n"
+    "cloudns.us\n"
+    "cnpy.gdn\n"
+    "codeberg.page\n"
+    "co.nl\n"
+    "co.no\n"
+    "webhosting.be\n"
+    "hosting-cluster.nl\n"
+    "ac.ru\n"
+    "edu.ru\n"
+    "gov.ru\n"
+    "int.ru\n"
+    "mil.ru\n"
+    "test.ru\n"
+    "dyn.cosidns.de\n"
+    "dynamisches-dns.de\n"
+    "dnsupdater.de\n"
+    "internet-dns.de\n"
+    "l-o-g-i-n.de\n"
+    "dynamic-dns.info\n"
+    "feste-ip.net\n"
+    "knx-server.net\n"
+    "static-access.net\n"
+    "realm.cz\n"
+    "*.cryptonomic.net\n"
+    "cupcake.is\n"
+    "curv.dev\n"
+    "*.customer-oci.com\n"
+    "*.oci.customer-oci.com\n"
+    "*.ocp.customer-oci.com\n"
+    "*.ocs.customer-oci.com\n"
+    "cyon.link\n"
+    "cyon.site\n"
+    "fnwk.site\n"
+    "folionetwork.site\n"
+    "platform0.app\n"
+    "daplie.me\n"
+    "localhost.daplie.me\n"
+    "dattolocal.com\n"
+    "dattorelay.com\n"
+    "dattoweb.com\n"
+    "mydatto.com\n"
+    "dattolocal.net\n"
+    "mydatto.net\n"
+    "biz.dk\n"
+    "co.dk\n"
+    "firm.dk\n"
+    "reg.dk\n"
+    "store.dk\n"
+    "dyndns.dappnode.io\n"
+    "*.dapps.earth\n"
+    "*.bzz.dapps.earth\n"
+    "builtwithdark.com\n"
+    "demo.datadetect.com\n"
+    "instance.datadetect.com\n"
+    "edgestack.me\n"
+    "ddns5.com\n"
+    "debian.net\n"
+    "deno.dev\n"
+    "deno-staging.dev\n"
+    "dedyn.io\n"
+    "deta.app\n"
+    "deta.dev\n"
+    "*.rss.my.id\n"
+    "*.diher.solutions\n"
+    "discordsays.com\n"
+    "discordsez.com\n"
+    "jozi.biz\n"
+    "dnshome.de\n"
+    "online.th\n"
+    "shop.th\n"
+    "drayddns.com\n"
+    "shoparena.pl\n"
+    "dreamhosters.com\n"
+    "mydrobo.com\n"
+    "drud.io\n"
+    "drud.us\n"
+    "duckdns.org\n"
+    "bip.sh\n"
+    "bitbridge.net\n"
+    "dy.fi\n"
+    "tunk.org\n"
+    "dyndns-at-home.com\n"
+    "dyndns-at-work.com\n"
+    "dyndns-blog.com\n"
+    "dyndns-free.com\n"
+    "dyndns-home.com\n"
+    "dyndns-ip.com\n"
+    "dyndns-mail.com\n"
+    "dyndns-office.com\n"
+    "dyndns-pics.com\n"
+    "dyndns-remote.com\n"
+    "dyndns-server.com\n"
+    "dyndns-web.com\n"
+    "dyndns-wiki.com\n"
+    "dyndns-work.com\n"
+    "dyndns.biz\n"
+    "dyndns.info\n"
+    "dyndns.org\n"
+    "dyndns.tv\n"
+    "at-band-camp.net\n"
+    "ath.cx\n"
+    "barrel-of-knowledge.info\n"
+    "barrell-of-knowledge.info\n"
+    "better-than.tv\n"
+    "blogdns.com\n"
+    "blogdns.net\n"
+    "blogdns.org\n"
+    "blogsite.org\n"
+    "boldlygoingnowhere.org\n"
+    "broke-it.net\n"
+    "buyshouses.net\n"
+    "cechire.com\n"
+    "dnsalias.com\n"
+    "dnsalias.net\n"
+    "dnsalias.org\n"
+    "dnsdojo.com\n"
+    "dnsdojo.net\n"
+    "dnsdojo.org\n"
+    "does-it.net\n"
+    "doesntexist.com\n"
+    "doesntexist.org\n"
+    "dontexist.com\n"
+    "dontexist.net\n"
+    "dontexist.org\n"
+    "doomdns.com\n"
+    "doomdns.org\n"
+    "dvrdns.org\n"
+    "dyn-o-saur.com\n"
+    "dynalias.com\n"
+    "dynalias.net\n"
+    "dynalias.org\n"
+    "dynathome.net\n"
+    "dyndns.ws\n"
+    "endofinternet.net\n"
+    "endofinternet.org\n"
+    "endoftheinternet.org\n"
+    "est-a-la-maison.com\n"
+    "est-a-la-masion.com\n"
+    "est-le-patron.com\n"
+    "est-mon-blogueur.com\n"
+    "for-better.biz\n"
+    "for-more.biz\n"
+    "for-our.info\n"
+    "for-some.biz\n"
+    "for-the.biz\n"
+    "forgot.her.name\n"
+    "forgot.his.name\n"
+    "from-ak.com\n"
+    "from-al.com\n"
+    "from-ar.com\n"
+    "from-az.net\n"
+    "from-ca.com\n"
+    "from-co.net\n"
+    "from-ct.com\n"
+    "from-dc.com\n"
+    "from-de.com\n"
+    "from-fl.com\n"
+    "from-ga.com\n"
+    "from-hi.com\n"
+    "from-ia.com\n"
+    "from-id.com\n"
+    "from-il.com\n"
+    "from-in.com\n"
+    "from-ks.com\n"
+    "from-ky.com\n"
+    "from-la.net\n"
+    "from-ma.com\n"
+    "from-md.com\n"
+    "from-me.org\n"
+    "from-mi.com\n"
+    "from-mn.com\n"
+    "from-mo.com\n"
+    "from-ms.com\n"
+    "from-mt.com\n"
+    "from-nc.com\n"
+    "from-nd.com\n"
+    "from-ne.com\n"
+    "from-nh.com\n"
+    "from-nj.com\n"
+    "from-nm.com\n"
+    "from-nv.com\n"
+    "from-ny.net\n"
+    "from-oh.com\n"
+    "from-ok.com\n"
+    "from-or.com\n"
+    "from-pa.com\n"
+    "from-pr.com\n"
+    "from-ri.com\n"
+    "from-sc.com\n"
+    "from-sd.com\n"
+    "from-tn.com\n"
+    "from-tx.com\n"
+    "from-ut.com\n"
+    "from-va.com\n"
+    "from-vt.com\n"
+    "from-wa.com\n"
+    "from-wi.com\n"
+    "from-wv.com\n"
+    "from-wy.com\n"
+    "ftpaccess.cc\n"
+    "fuettertdasnetz.de\n"
+    "game-host.org\n"
+    "game-server.cc\n"
+    "getmyip.com\n"
+    "gets-it.net\n"
+    "go.dyndns.org\n"
+    "gotdns.com\n"
+    "gotdns.org\n"
+    "groks-the.info\n"
+    "groks-this.info\n"
+    "ham-radio-op.net\n"
+    "here-for-more.info\n"
+    "hobby-site.com\n"
+    "hobby-site.org\n"
+    "home.dyndns.org\n"
+    "homedns.org\n"
+    "homeftp.net\n"
+    "homeftp.org\n"
+    "homeip.net\n"
+    "homelinux.com\n"
+    "homelinux.net\n"
+    "homelinux.org\n"
+    "homeunix.com\n"
+    "homeunix.net\n"
+    "homeunix.org\n"
+    "iamallama.com\n"
+    "in-the-band.net\n"
+    "is-a-anarchist.com\n"
+    "is-a-blogger.com\n"
+    "is-a-bookkeeper.com\n"
+    "is-a-bruinsfan.org\n"
+    "is-a-bulls-fan.com\n"
+    "is-a-candidate.org\n"
+    "is-a-caterer.com\n"
+    "is-a-celticsfan.org\n"
+    "is-a-chef.com\n"
+    "is-a-chef.net\n"
+    "is-a-chef.org\n"
+    "is-a-conservative.com\n"
+    "is-a-cpa.com\n"
+    "is-a-cubicle-slave.com\n"
+    "is-a-democrat.com\n"
+    "is-a-designer.com\n"
+    "is-a-doctor.com\n"
+    "is-a-financialadvisor.com\n"
+    "is-a-geek.com\n"
+    "is-a-geek.net\n"
+    "is-a-geek.org\n"
+    "is-a-green.com\n"
+    "is-a-guru.com\n"
+    "is-a-hard-worker.com\n"
+    "is-a-hunter.com\n"
+    "is-a-knight.org\n"
+    "is-a-landscaper.com\n"
+    "is-a-lawyer.com\n"
+    "is-a-liberal.com\n"
+    "is-a-libertarian.com\n"
+    "is-a-linux-user.org\n"
+    "is-a-llama.com\n"
+    "is-a-musician.com\n"
+    "is-a-nascarfan.com\n"
+    "is-a-nurse.com\n"
+    "is-a-painter.com\n"
+    "is-a-patsfan.org\n"
+    "is-a-personaltrainer.com\n"
+    "is-a-photographer.com\n"
+    "is-a-player.com\n"
+    "is-a-republican.com\n"
+    "is-a-rockstar.com\n"
+    "is-a-socialist.com\n"
+    "is-a-soxfan.org\n"
+    "is-a-student.com\n"
+    "is-a-teacher.com\n"
+    "is-a-techie.com\n"
+    "is-a-therapist.com\n"
+    "is-an-accountant.com\n"
+    "is-an-actor.com\n"
+    "is-an-actress.com\n"
+    "is-an-anarchist.com\n"
+    "is-an-artist.com\n"
+    "is-an-engineer.com\n"
+    "is-an-entertainer.com\n"
+    "is-by.us\n"
+    "is-certified.com\n"
+    "is-found.org\n"
+    "is-gone.com\n"
+    "is-into-anime.com\n"
+    "is-into-cars.com\n"
+    "is-into-cartoons.com\n"
+    "is-into-games.com\n"
+    "is-leet.com\n"
+    "is-lost.org\n"
+    "is-not-certified.com\n"
+    "is-saved.org\n"
+    "is-slick.com\n"
+    "is-uberleet.com\n"
+    "is-very-bad.org\n"
+    "is-very-evil.org\n"
+    "is-very-good.org\n"
+    "is-very-nice.org\n"
+    "is-very-sweet.org\n"
+    "is-with-theband.com\n"
+    "isa-geek.com\n"
+    "isa-geek.net\n"
+    "isa-geek.org\n"
+    "isa-hockeynut.com\n"
+    "issmarterthanyou.com\n"
+    "isteingeek.de\n"
+    "istmein.de\n"
+    "kicks-ass.net\n"
+    "kicks-ass.org\n"
+    "knowsitall.info\n"
+    "land-4-sale.us\n"
+    "lebtimnetz.de\n"
+    "leitungsen.de\n"
+    "likes-pie.com\n"
+    "likescandy.com\n"
+    "merseine.nu\n"
+    "mine.nu\n"
+    "misconfused.org\n"
+    "mypets.ws\n"
+    "myphotos.cc\n"
+    "neat-url.com\n"
+    "office-on-the.net\n"
+    "on-the-web.tv\n"
+    "podzone.net\n"
+    "podzone.org\n"
+    "readmyblog.org\n"
+    "saves-the-whales.com\n"
+    "scrapper-site.net\n"
+    "scrapping.cc\n"
+    "selfip.biz\n"
+    "selfip.com\n"
+    "selfip.info\n"
+    "selfip.net\n"
+    "selfip.org\n"
+    "sells-for-less.com\n"
+    "sells-for-u.com\n"
+    "sells-it.net\n"
+    "sellsyourhome.org\n"
+    "servebbs.com\n"
+    "servebbs.net\n"
+    "servebbs.org\n"
+    "serveftp.net\n"
+    "serveftp.org\n"
+    "servegame.org\n"
+    "shacknet.nu\n"
+    "simple-url.com\n"
+    "space-to-rent.com\n"
+    "stuff-4-sale.org\n"
+    "stuff-4-sale.us\n"
+    "teaches-yoga.com\n"
+    "thruhere.net\n"
+    "traeumtgerade.de\n"
+    "webhop.biz\n"
+    "webhop.info\n"
+    "webhop.net\n"
+    "webhop.org\n"
+    "worse-than.tv\n"
+    "writesthisblog.com\n"
+    "ddnss.de\n"
+    "dyn.ddnss.de\n"
+    "dyndns.ddnss.de\n"
+    "dyndns1.de\n"
+    "dyn-ip24.de\n"
+    "home-webserver.de\n"
+    "dyn.home-webserver.de\n"
+    "myhome-server.de\n"
+    "ddnss.org\n"
+    "definima.net\n"
+    "definima.io\n"
+    "ondigitalocean.app\n"
+    "*.digitaloceanspaces.com\n"
+    "bci.dnstrace.pro\n",
+
+    "ddnsfree.com\n"
+    "ddnsgeek.com\n"
+    "giize.com\n"
+    "gleeze.com\n"
+    "kozow.com\n"
+    "loseyourip.com\n"
+    "ooguy.com\n"
+    "theworkpc.com\n"
+    "casacam.net\n"
+    "dynu.net\n"
+    "accesscam.org\n"
+    "camdvr.org\n"
+    "freeddns.org\n"
+    "mywire.org\n"
+    "webredirect.org\n"
+    "myddns.rocks\n"
+    "blogsite.xyz\n"
+    "dynv6.net\n"
+    "e4.cz\n"
+    "easypanel.app\n"
+    "easypanel.host\n"
+    "elementor.cloud\n"
+    "elementor.cool\n"
+    "en-root.fr\n"
+    "mytuleap.com\n"
+    "tuleap-partners.com\n"
+    "encr.app\n"
+    "encoreapi.com\n"
+    "onred.one\n"
+    "staging.onred.one\n"
+    "eu.encoway.cloud\n"
+    "eu.org\n"
+    "al.eu.org\n"
+    "asso.eu.org\n"
+    "at.eu.org\n"
+    "au.eu.org\n"
+    "be.eu.org\n"
+    "bg.eu.org\n"
+    "ca.eu.org\n"
+    "cd.eu.org\n"
+    "ch.eu.org\n"
+    "cn.eu.org\n"
+    "cy.eu.org\n"
+    "cz.eu.org\n"
+    "de.eu.org\n"
+    "dk.eu.org\n"
+    "edu.eu.org\n"
+    "ee.eu.org\n"
+    "es.eu.org\n"
+    "fi.eu.org\n"
+    "fr.eu.org\n"
+    "gr.eu.org\n"
+    "hr.eu.org\n"
+    "hu.eu.org\n"
+    "ie.eu.org\n"
+    "il.eu.org\n"
+    "in.eu.org\n"
+    "int.eu.org\n"
+    "is.eu.org\n"
+    "it.eu.org\n"
+    "jp.eu.org\n"
+    "kr.eu.org\n"
+    "lt.eu.org\n"
+    "lu.eu.org\n"
+    "lv.eu.org\n"
+    "mc.eu.org\n"
+    "me.eu.org\n"
+    "mk.eu.org\n"
+    "mt.eu.org\n"
+    "my.eu.org\n"
+    "net.eu.org\n"
+    "ng.eu.org\n"
+    "nl.eu.org\n"
+    "no.eu.org\n"
+    "nz.eu.org\n"
+    "paris.eu.org\n"
+    "pl.eu.org\n"
+    "pt.eu.org\n"
+    "q-a.eu.org\n"
+    "ro.eu.org\n"
+    "ru.eu.org\n"
+    "se.eu.org\n"
+    "si.eu.org\n"
+    "sk.eu.org\n"
+    "tr.eu.org\n"
+    "uk.eu.org\n"
+    "us.eu.org\n"
+    "eurodir.ru\n"
+    "eu-1.evennode.com\n"
+    "eu-2.evennode.com\n"
+    "eu-3.evennode.com\n"
+    "eu-4.evennode.com\n"
+    "us-1.evennode.com\n"
+    "us-2.evennode.com\n"
+    "us-3.evennode.com\n"
+    "us-4.evennode.com\n"
+    "twmail.cc\n"
+    "twmail.net\n"
+    "twmail.org\n"
+    "mymailer.com.tw\n"
+    "url.tw\n"
+    "onfabrica.com\n"
+    "apps.fbsbx.com\n"
+    "ru.net\n"
+    "adygeya.ru\n"
+    "bashkiria.ru\n"
+    "bir.ru\n"
+    "cbg.ru\n"
+    "com.ru\n"
+    "dagestan.ru\n"
+    "grozny.ru\n"
+    "kalmykia.ru\n"
+    "kustanai.ru\n"
+    "marine.ru\n"
+    "mordovia.ru\n"
+    "msk.ru\n"
+    "mytis.ru\n"
+    "nalchik.ru\n"
+    "nov.ru\n"
+    "pyatigorsk.ru\n"
+    "spb.ru\n"
+    "vladikavkaz.ru\n"
+    "vladimir.ru\n"
+    "abkhazia.su\n"
+    "adygeya.su\n"
+    "aktyubinsk.su\n"
+    "arkhangelsk.su\n"
+    "armenia.su\n"
+    "ashgabad.su\n"
+    "azerbaijan.su\n"
+    "balashov.su\n"
+    "bashkiria.su\n"
+    "bryansk.su\n"
+    "bukhara.su\n"
+    "chimkent.su\n"
+    "dagestan.su\n"
+    "east-kazakhstan.su\n"
+    "exnet.su\n"
+    "georgia.su\n"
+    "grozny.su\n"
+    "ivanovo.su\n"
+    "jambyl.su\n"
+    "kalmykia.su\n"
+    "kaluga.su\n"
+    "karacol.su\n"
+    "karaganda.su\n"
+    "karelia.su\n"
+    "khakassia.su\n"
+    "krasnodar.su\n"
+    "kurgan.su\n"
+    "kustanai.su\n"
+    "lenug.su\n"
+    "mangyshlak.su\n"
+    "mordovia.su\n"
+    "msk.su\n"
+    "murmansk.su\n"
+    "nalchik.su\n"
+    "navoi.su\n"
+    "north-kazakhstan.su\n"
+    "nov.su\n"
+    "obninsk.su\n"
+    "penza.su\n"
+    "pokrovsk.su\n"
+    "sochi.su\n"
+    "spb.su\n"
+    "tashkent.su\n"
+    "termez.su\n"
+    "togliatti.su\n"
+    "troitsk.su\n"
+    "tselinograd.su\n"
+    "tula.su\n"
+    "tuva.su\n"
+    "vladikavkaz.su\n"
+    "vladimir.su\n"
+    "vologda.su\n"
+    "channelsdvr.net\n"
+    "u.channelsdvr.net\n"
+    "edgecompute.app\n"
+    "fastly-edge.com\n"
+    "fastly-terrarium.com\n"
+    "fastlylb.net\n"
+    "map.fastlylb.net\n"
+    "freetls.fastly.net\n"
+    "map.fastly.net\n"
+    "a.prod.fastly.net\n"
+    "global.prod.fastly.net\n"
+    "a.ssl.fastly.net\n"
+    "b.ssl.fastly.net\n"
+    "global.ssl.fastly.net\n"
+    "*.user.fm\n"
+    "fastvps-server.com\n"
+    "fastvps.host\n"
+    "myfast.host\n"
+    "fastvps.site\n"
+    "myfast.space\n"
+    "fedorainfracloud.org\n"
+    "fedorapeople.org\n"
+    "cloud.fedoraproject.org\n"
+    "app.os.fedoraproject.org\n"
+    "app.os.stg.fedoraproject.org\n"
+    "conn.uk\n"
+    "copro.uk\n"
+    "hosp.uk\n"
+    "mydobiss.com\n"
+    "fh-muenster.io\n"
+    "filegear.me\n"
+    "filegear-au.me\n"
+    "filegear-de.me\n"
+    "filegear-gb.me\n"
+    "filegear-ie.me\n"
+    "filegear-jp.me\n"
+    "filegear-sg.me\n"
+    "firebaseapp.com\n"
+    "fireweb.app\n"
+    "flap.id\n"
+    "onflashdrive.app\n"
+    "fldrv.com\n"
+    "fly.dev\n"
+    "edgeapp.net\n"
+    "shw.io\n"
+    "flynnhosting.net\n"
+    "forgeblocks.com\n"
+    "id.forgerock.io\n"
+    "framer.app\n"
+    "framercanvas.com\n"
+    "framer.media\n"
+    "framer.photos\n"
+    "framer.website\n"
+    "framer.wiki\n"
+    "*.frusky.de\n"
+    "ravpage.co.il\n"
+    "0e.vc\n"
+    "freebox-os.com\n"
+    "freeboxos.com\n"
+    "fbx-os.fr\n"
+    "fbxos.fr\n"
+    "freebox-os.fr\n"
+    "freeboxos.fr\n"
+    "freedesktop.org\n"
+    "freemyip.com\n"
+    "wien.funkfeuer.at\n"
+    "*.futurecms.at\n"
+    "*.ex.futurecms.at\n"
+    "*.in.futurecms.at\n"
+    "futurehosting.at\n"
+    "futuremailing.at\n"
+    "*.ex.ortsinfo.at\n"
+    "*.kunden.ortsinfo.at\n"
+    "*.statics.cloud\n"
+    "independent-commission.uk\n"
+    "independent-inquest.uk\n"
+    "independent-inquiry.uk\n"
+    "independent-panel.uk\n"
+    "independent-review.uk\n"
+    "public-inquiry.uk\n"
+    "royal-commission.uk\n"
+    "campaign.gov.uk\n"
+    "service.gov.uk\n"
+    "api.gov.uk\n"
+    "gehirn.ne.jp\n"
+    "usercontent.jp\n"
+    "gentapps.com\n"
+    "gentlentapis.com\n"
+    "lab.ms\n"
+    "cdn-edges.net\n"
+    "ghost.io\n"
+    "gsj.bz\n"
+    "githubusercontent.com\n"
+    "githubpreview.dev\n"
+    "github.io\n"
+    "gitlab.io\n"
+    "gitapp.si\n"
+    "gitpage.si\n"
+    "glitch.me\n"
+    "nog.community\n"
+    "co.ro\n"
+    "shop.ro\n"
+    "lolipop.io\n"
+    "angry.jp\n"
+    "babyblue.jp\n"
+    "babymilk.jp\n"
+    "backdrop.jp\n"
+    "bambina.jp\n"
+    "bitter.jp\n"
+    "blush.jp\n"
+    "boo.jp\n"
+    "boy.jp\n"
+    "boyfriend.jp\n"
+    "but.jp\n"
+    "candypop.jp\n"
+    "capoo.jp\n"
+    "catfood.jp\n"
+    "cheap.jp\n"
+    "chicappa.jp\n"
+    "chillout.jp\n"
+    "chips.jp\n"
+    "chowder.jp\n"
+    "chu.jp\n"
+    "ciao.jp\n"
+    "cocotte.jp\n"
+    "coolblog.jp\n"
+    "cranky.jp\n"
+    "cutegirl.jp\n"
+    "daa.jp\n"
+    "deca.jp\n"
+    "deci.jp\n"
+    "digick.jp\n"
+    "egoism.jp\n"
+    "fakefur.jp\n"
+    "fem.jp\n"
+    "flier.jp\n"
+    "floppy.jp\n"
+    "fool.jp\n"
+    "frenchkiss.jp\n"
+    "girlfriend.jp\n"
+    "girly.jp\n"
+    "gloomy.jp\n"
+    "gonna.jp\n"
+    "greater.jp\n"
+    "hacca.jp\n"
+    "heavy.jp\n"
+    "her.jp\n"
+    "hiho.jp\n"
+    "hippy.jp\n"
+    "holy.jp\n"
+    "hungry.jp\n"
+    "icurus.jp\n"
+    "itigo.jp\n"
+    "jellybean.jp\n"
+    "kikirara.jp\n"
+    "kill.jp\n"
+    "kilo.jp\n"
+    "kuron.jp\n"
+    "littlestar.jp\n"
+    "lolipopmc.jp\n"
+    "lolitapunk.jp\n"
+    "lomo.jp\n"
+    "lovepop.jp\n"
+    "lovesick.jp\n"
+    "main.jp\n"
+    "mods.jp\n"
+    "mond.jp\n"
+    "mongolian.jp\n"
+    "moo.jp\n"
+    "namaste.jp\n"
+    "nikita.jp\n"
+    "nobushi.jp\n"
+    "noor.jp\n"
+    "oops.jp\n"
+    "parallel.jp\n"
+    "parasite.jp\n"
+    "pecori.jp\n"
+    "peewee.jp\n"
+    "penne.jp\n"
+    "pepper.jp\n"
+    "perma.jp\n"
+    "pigboat.jp\n"
+    "pinoko.jp\n"
+    "punyu.jp\n"
+    "pupu.jp\n"
+    "pussycat.jp\n"
+    "pya.jp\n"
+    "raindrop.jp\n"
+    "readymade.jp\n"
+    "sadist.jp\n"
+    "schoolbus.jp\n"
+    "secret.jp\n"
+    "staba.jp\n"
+    "stripper.jp\n"
+    "sub.jp\n"
+    "sunnyday.jp\n"
+    "thick.jp\n"
+    "tonkotsu.jp\n"
+    "under.jp\n"
+    "upper.jp\n"
+    "velvet.jp\n"
+    "verse.jp\n"
+    "versus.jp\n"
+    "vivian.jp\n"
+    "watson.jp\n"
+    "weblike.jp\n"
+    "whitesnow.jp\n"
+    "zombie.jp\n"
+    "heteml.net\n"
+    "cloudapps.digital\n"
+    "london.cloudapps.digital\n"
+    "pymnt.uk\n"
+    "homeoffice.gov.uk\n"
+    "ro.im\n"
+    "goip.de\n"
+    "run.app\n"
+    "a.run.app\n"
+    "web.app\n"
+    "*.0emm.com\n"
+    "appspot.com\n"
+    "*.r.appspot.com\n"
+    "codespot.com\n"
+    "googleapis.com\n"
+    "googlecode.com\n"
+    "pagespeedmobilizer.com\n"
+    "publishproxy.com\n"
+    "withgoogle.com\n"
+    "withyoutube.com\n"
+    "*.gateway.dev\n"
+    "cloud.goog\n"
+    "translate.goog\n"
+    "*.usercontent.goog\n"
+    "cloudfunctions.net\n"
+    "blogspot.ae\n"
+    "blogspot.al\n"
+    "blogspot.am\n"
+    "blogspot.ba\n"
+    "blogspot.be\n"
+    "blogspot.bg\n"
+    "blogspot.bj\n"
+    "blogspot.ca\n"
+    "blogspot.cf\n"
+    "blogspot.ch\n"
+    "blogspot.cl\n"
+    "blogspot.co.at\n"
+    "blogspot.co.id\n"
+    "blogspot.co.il\n"
+    "blogspot.co.ke\n"
+    "blogspot.co.nz\n"
+    "blogspot.co.uk\n"
+    "blogspot.co.za\n"
+    "blogspot.com\n"
+    "blogspot.com.ar\n"
+    "blogspot.com.au\n"
+    "blogspot.com.br\n"
+    "blogspot.com.by\n"
+    "blogspot.com.co\n"
+    "blogspot.com.cy\n"
+    "blogspot.com.ee\n"
+    "blogspot.com.eg\n"
+    "blogspot.com.es\n"
+    "blogspot.com.mt\n"
+    "blogspot.com.ng\n"
+    "blogspot.com.tr\n"
+    "blogspot.com.uy\n"
+    "blogspot.cv\n"
+    "blogspot.cz\n"
+    "blogspot.de\n"
+    "blogspot.dk\n"
+    "blogspot.fi\n"
+    "blogspot.fr\n"
+    "blogspot.gr\n"
+    "blogspot.hk\n"
+    "blogspot.hr\n"
+    "blogspot.hu\n"
+    "blogspot.ie\n"
+    "blogspot.in\n"
+    "blogspot.is\n"
+    "blogspot.it\n"
+    "blogspot.jp\n"
+    "blogspot.kr\n"
+    "blogspot.li\n"
+    "blogspot.lt\n"
+    "blogspot.lu\n"
+    "blogspot.md\n"
+    "blogspot.mk\n"
+    "blogspot.mr\n"
+    "blogspot.mx\n"
+    "blogspot.my\n"
+    "blogspot.nl\n"
+    "blogspot.no\n"
+    "blogspot.pe\n"
+    "blogspot.pt\n"
+    "blogspot.qa\n"
+    "blogspot.re\n"
+    "blogspot.ro\n"
+    "blogspot.rs\n"
+    "blogspot.ru\n"
+    "blogspot.se\n"
+    "blogspot.sg\n"
+    "blogspot.si\n"
+    "blogspot.sk\n"
+    "blogspot.sn\n"
+    "blogspot.td\n"
+    "blogspot.tw\n"
+    "blogspot.ug\n"
+    "blogspot.vn\n"
+    "goupile.fr\n"
+    "gov.nl\n"
+    "awsmppl.com\n"
+    "g\xc3\xbcnstigbestellen.de\n"
+    "g\xc3\xbcnstigliefern.de\n"
+    "fin.ci\n"
+    "free.hr\n"
+    "caa.li\n"
+    "ua.rs\n"
+    "conf.se\n"
+    "hs.zone\n"
+    "hs.run\n"
+    "hashbang.sh\n"
+    "hasura.app\n"
+    "hasura-app.io\n"
+    "pages.it.hs-heilbronn.de\n"
+    "hepforge.org\n"
+    "herokuapp.com\n"
+    "herokussl.com\n"
+    "ravendb.cloud\n"
+    "ravendb.community\n"
+    "ravendb.me\n"
+    "development.run\n"
+    "ravendb.run\n"
+    "homesklep.pl\n"
+    "secaas.hk\n"
+    "hoplix.shop\n"
+    "orx.biz\n"
+    "biz.gl\n"
+    "col.ng\n"
+    "firm.ng\n"
+    "gen.ng\n"
+    "ltd.ng\n"
+    "ngo.ng\n"
+    "edu.scot\n"
+    "sch.so\n"
+    "hostyhosting.io\n"
+    "h\xc3\xa4kkinen.fi\n"
+    "*.moonscale.io\n"
+    "moonscale.net\n"
+    "iki.fi\n"
+    "ibxos.it\n"
+    "iliadboxos.it\n"
+    "impertrixcdn.com\n"
+    "impertrix.com\n"
+    "smushcdn.com\n"
+    "wphostedmail.com\n"
+    "wpmucdn.com\n"
+    "tempurl.host\n"
+    "wpmudev.host\n"
+    "dyn-berlin.de\n"
+    "in-berlin.de\n"
+    "in-brb.de\n"
+    "in-butter.de\n"
+    "in-dsl.de\n"
+    "in-dsl.net\n"
+    "in-dsl.org\n"
+    "in-vpn.de\n"
+    "in-vpn.net\n"
+    "in-vpn.org\n"
+    "biz.at\n"
+    "info.at\n"
+    "info.cx\n"
+    "ac.leg.br\n"
+    "al.leg.br\n"
+    "am.leg.br\n"
+    "ap.leg.br\n"
+    "ba.leg.br\n"
+    "ce.leg.br\n"
+    "df.leg.br\n"
+    "es.leg.br\n"
+    "go.leg.br\n"
+    "ma.leg.br\n"
+    "mg.leg.br\n"
+    "ms.leg.br\n"
+    "mt.leg.br\n"
+    "pa.leg.br\n"
+    "pb.leg.br\n"
+    "pe.leg.br\n"
+    "pi.leg.br\n"
+    "pr.leg.br\n"
+    "rj.leg.br\n"
+    "rn.leg.br\n"
+    "ro.leg.br\n"
+    "rr.leg.br\n"
+    "rs.leg.br\n"
+    "sc.leg.br\n"
+    "se.leg.br\n"
+    "sp.leg.br\n"
+    "to.leg.br\n"
+    "pixolino.com\n"
+    "na4u.ru\n"
+    "iopsys.se\n"
+    "ipifony.net\n"
+    "iservschule.de\n"
+    "mein-iserv.de\n"
+    "schulplattform.de\n"
+    "schulserver.de\n"
+    "test-iserv.de\n"
+    "iserv.dev\n"
+    "iobb.net\n"
+    "mel.cloudlets.com.au\n"
+    "cloud.interhostsolutions.be\n"
+    "users.scale.virtualcloud.com.br\n"
+    "mycloud.by\n"
+    "alp1.ae.flow.ch\n"
+    "appengine.flow.ch\n"
+    "es-1.axarnet.cloud\n"
+    "diadem.cloud\n"
+    "vip.jelastic.cloud\n"
+    "jele.cloud\n"
+    "it1.eur.aruba.jenv-aruba.cloud\n"
+    "it1.jenv-aruba.cloud\n"
+    "keliweb.cloud\n"
+    "cs.keliweb.cloud\n"
+    "oxa.cloud\n"
+    "tn.oxa.cloud\n"
+    "uk.oxa.cloud\n"
+    "primetel.cloud\n"
+    "uk.primetel.cloud\n"
+    "ca.reclaim.cloud\n"
+    "uk.reclaim.cloud\n"
+    "us.reclaim.cloud\n"
+    "ch.trendhosting.cloud\n"
+    "de.trendhosting.cloud\n"
+    "jele.club\n"
+    "amscompute.com\n"
+    "clicketcloud.com\n"
+    "dopaas.com\n"
+    "hidora.com\n"
+    "paas.hosted-by-previder.com\n"
+    "rag-cloud.hosteur.com\n"
+    "rag-cloud-ch.hosteur.com\n"
+    "jcloud.ik-server.com\n"
+    "jcloud-ver-jpc.ik-server.com\n"
+    "demo.jelastic.com\n"
+    "kilatiron.com\n"
+    "paas.massivegrid.com\n"
+    "jed.wafaicloud.com\n"
+    "lon.wafaicloud.com\n"
+    "ryd.wafaicloud.com\n"
+    "j.scaleforce.com.cy\n"
+    "jelastic.dogado.eu\n"
+    "fi.cloudplatform.fi\n"
+    "demo.datacenter.fi\n"
+    "paas.datacenter.fi\n"
+    "jele.host\n"
+    "mircloud.host\n"
+    "paas.beebyte.io\n"
+    "sekd1.beebyteapp.io\n"
+    "jele.io\n"
+    "cloud-fr1.unispace.io\n"
+    "jc.neen.it\n"
+    "cloud.jelastic.open.tim.it\n"
+    "jcloud.kz\n"
+    "upaas.kazteleport.kz\n"
+    "cloudjiffy.net\n"
+    "fra1-de.cloudjiffy.net\n"
+    "west1-us.cloudjiffy.net\n"
+    "jls-sto1.elastx.net\n"
+    "jls-sto2.elastx.net\n"
+    "jls-sto3.elastx.net\n"
+    "faststacks.net\n"
+    "fr-1.paas.massivegrid.net\n"
+    "lon-1.paas.massivegrid.net\n"
+    "lon-2.paas.massivegrid.net\n"
+    "ny-1.paas.massivegrid.net\n"
+    "ny-2.paas.massivegrid.net\n"
+    "sg-1.paas.massivegrid.net\n"
+    "jelastic.saveincloud.net\n"
+    "nordeste-idc.saveincloud.net\n"
+    "j.scaleforce.net\n"
+    "jelastic.tsukaeru.net\n"
+    "sdscloud.pl\n"
+    "unicloud.pl\n"
+    "mircloud.ru\n"
+    "jelastic.regruhosting.ru\n"
+    "enscaled.sg\n"
+    "jele.site\n"
+    "jelastic.team\n"
+    "orangecloud.tn\n"
+    "j.layershift.co.uk\n"
+    "phx.enscaled.us\n"
+    "mircloud.us\n"
+    "myjino.ru\n"
+    "*.hosting.myjino.ru\n"
+    "*.landing.myjino.ru\n"
+    "*.spectrum.myjino.ru\n"
+    "*.vps.myjino.ru\n"
+    "jotelulu.cloud\n"
+    "*.triton.zone\n"
+    "*.cns.joyent.com\n"
+    "js.org\n"
+    "kaas.gg\n"
+    "khplay.nl\n"
+    "ktistory.com\n"
+    "kapsi.fi\n"
+    "keymachine.de\n"
+    "kinghost.net\n"
+    "uni5.net\n"
+    "knightpoint.systems\n"
+    "koobin.events\n"
+    "oya.to\n"
+    "kuleuven.cloud\n"
+    "ezproxy.kuleuven.be\n"
+    "co.krd\n"
+    "edu.krd\n"
+    "krellian.net\n"
+    "webthings.io\n"
+    "git-repos.de\n"
+    "lcube-server.de\n"
+    "svn-repos.de\n"
+    "leadpages.co\n"
+    "lpages.co\n"
+    "lpusercontent.com\n"
+    "lelux.site\n"
+    "co.business\n"
+    "co.education\n"
+    "co.events\n"
+    "co.financial\n"
+    "co.network\n"
+    "co.place\n"
+    "co.technology\n"
+    "app.lmpm.com\n"
+    "linkyard.cloud\n"
+    "linkyard-cloud.ch\n"
+    "members.linode.com\n"
+    "*.nodebalancer.linode.com\n"
+    "*.linodeobjects.com\n"
+    "ip.linodeusercontent.com\n"
+    "we.bs\n"
+    "*.user.localcert.dev\n"
+    "localzone.xyz\n"
+    "loginline.app\n"
+    "loginline.dev\n"
+    "loginline.io\n"
+    "loginline.services\n"
+    "loginline.site\n"
+    "servers.run\n"
+    "lohmus.me\n"
+    "krasnik.pl\n"
+    "leczna.pl\n"
+    "lubartow.pl\n"
+    "lublin.pl\n"
+    "poniatowa.pl\n"
+    "swidnik.pl\n"
+    "glug.org.uk\n"
+    "lug.org.uk\n"
+    "lugs.org.uk\n"
+    "barsy.bg\n"
+    "barsy.co.uk\n"
+    "barsyonline.co.uk\n"
+    "barsycenter.com\n"
+    "barsyonline.com\n"
+    "barsy.club\n"
+    "barsy.de\n"
+    "barsy.eu\n"
+    "barsy.in\n"
+    "barsy.info\n"
+    "barsy.io\n"
+    "barsy.me\n"
+    "barsy.menu\n"
+    "barsy.mobi\n"
+    "barsy.net\n"
+    "barsy.online\n"
+    "barsy.org\n"
+    "barsy.pro\n"
+    "barsy.pub\n"
+    "barsy.ro\n"
+    "barsy.shop\n"
+    "barsy.site\n"
+    "barsy.support\n"
+    "barsy.uk\n"
+    "*.magentosite.cloud\n"
+    "mayfirst.info\n"
+    "mayfirst.org\n"
+    "hb.cldmail.ru\n"
+    "cn.vu\n"
+    "mazeplay.com\n"
+    "mcpe.me\n"
+    "mcdir.me\n"
+    "mcdir.ru\n"
+    "mcpre.ru\n"
+    "vps.mcdir.ru\n"
+    "mediatech.by\n"
+    "mediatech.dev\n"
+    "hra.health\n"
+    "miniserver.com\n"
+    "memset.net\n"
+    "messerli.app\n"
+    "*.cloud.metacentrum.cz\n"
+    "custom.metacentrum.cz\n"
+    "flt.cloud.muni.cz\n"
+    "usr.cloud.muni.cz\n"
+    "meteorapp.com\n"
+    "eu.meteorapp.com\n"
+    "co.pl\n"
+    "*.azurecontainer.io\n"
+    "azurewebsites.net\n"
+    "azure-mobile.net\n"
+    "cloudapp.net\n"
+    "azurestaticapps.net\n"
+    "1.azurestaticapps.net\n"
+    "2.azurestaticapps.net\n"
+    "centralus.azurestaticapps.net\n"
+    "eastasia.azurestaticapps.net\n"
+    "eastus2.azurestaticapps.net\n"
+    "westeurope.azurestaticapps.net\n"
+    "westus2.azurestaticapps.net\n"
+    "csx.cc\n"
+    "mintere.site\n"
+    "forte.id\n"
+    "mozilla-iot.org\n"
+    "bmoattachments.org\n"
+    "net.ru\n"
+    "org.ru\n"
+    "pp.ru\n"
+    "hostedpi.com\n"
+    "customer.mythic-beasts.com\n"
+    "caracal.mythic-beasts.com\n"
+    "fentiger.mythic-beasts.com\n"
+    "lynx.mythic-beasts.com\n"
+    "ocelot.mythic-beasts.com\n"
+    "oncilla.mythic-beasts.com\n"
+    "onza.mythic-beasts.com\n"
+    "sphinx.mythic-beasts.com\n"
+    "vs.mythic-beasts.com\n"
+    "x.mythic-beasts.com\n"
+    "yali.mythic-beasts.com\n"
+    "cust.retrosnub.co.uk\n"
+    "ui.nabu.casa\n"
+    "cloud.nospamproxy.com\n"
+    "netlify.app\n"
+    "4u.com\n"
+    "ngrok.io\n"
+    "nh-serv.co.uk\n"
+    "nfshost.com\n"
+    "*.developer.app\n"
+    "noop.app\n"
+    "*.northflank.app\n"
+    "*.build.run\n"
+    "*.code.run\n"
+    "*.database.run\n"
+    "*.migration.run\n"
+    "noticeable.news\n"
+    "dnsking.ch\n"
+    "mypi.co\n"
+    "n4t.co\n"
+    "001www.com\n"
+    "ddnslive.com\n"
+    "myiphost.com\n"
+    "forumz.info\n"
+    "16-b.it\n"
+    "32-b.it\n"
+    "64-b.it\n"
+    "soundcast.me\n"
+    "tcp4.me\n"
+    "dnsup.net\n"
+    "hicam.net\n"
+    "now-dns.net\n"
+    "ownip.net\n"
+    "vpndns.net\n"
+    "dynserv.org\n"
+    "now-dns.org\n"
+    "x443.pw\n"
+    "now-dns.top\n"
+    "ntdll.top\n"
+    "freeddns.us\n"
+    "crafting.xyz\n"
+    "zapto.xyz\n"
+    "nsupdate.info\n"
+    "nerdpol.ovh\n"
+    "blogsyte.com\n"
+    "brasilia.me\n"
+    "cable-modem.org\n"
+    "ciscofreak.com\n"
+    "collegefan.org\n"
+    "couchpotatofries.org\n"
+    "damnserver.com\n"
+    "ddns.me\n"
+    "ditchyourip.com\n"
+    "dnsfor.me\n"
+    "dnsiskinky.com\n"
+    "dvrcam.info\n"
+    "dynns.com\n"
+    "eating-organic.net\n"
+    "fantasyleague.cc\n"
+    "geekgalaxy.com\n"
+    "golffan.us\n"
+    "health-carereform.com\n"
+    "homesecuritymac.com\n"
+    "homesecuritypc.com\n"
+    "hopto.me\n"
+    "ilovecollege.info\n"
+    "loginto.me\n"
+    "mlbfan.org\n"
+    "mmafan.biz\n"
+    "myactivedirectory.com\n"
+    "mydissent.net\n"
+    "myeffect.net\n"
+    "mymediapc.net\n"
+    "mypsx.net\n"
+    "mysecuritycamera.com\n"
+    "mysecuritycamera.net\n"
+    "mysecuritycamera.org\n"
+    "net-freaks.com\n"
+    "nflfan.org\n"
+    "nhlfan.net\n"
+    "no-ip.ca\n"
+    "no-ip.co.uk\n"
+    "no-ip.net\n"
+    "noip.us\n"
+    "onthewifi.com\n"
+    "pgafan.net\n"
+    "point2this.com\n"
+    "pointto.us\n"
+    "privatizehealthinsurance.net\n"
+    "quicksytes.com\n"
+    "read-books.org\n"
+    "securitytactics.com\n"
+    "serveexchange.com\n"
+    "servehumour.com\n"
+    "servep2p.com\n"
+    "servesarcasm.com\n"
+    "stufftoread.com\n"
+    "ufcfan.org\n",
+
+    "unusualperson.com\n"
+    "workisboring.com\n"
+    "3utilities.com\n"
+    "bounceme.net\n"
+    "ddns.net\n"
+    "ddnsking.com\n"
+    "gotdns.ch\n"
+    "hopto.org\n"
+    "myftp.biz\n"
+    "myftp.org\n"
+    "myvnc.com\n"
+    "no-ip.biz\n"
+    "no-ip.info\n"
+    "no-ip.org\n"
+    "noip.me\n"
+    "redirectme.net\n"
+    "servebeer.com\n"
+    "serveblog.net\n"
+    "servecounterstrike.com\n"
+    "serveftp.com\n"
+    "servegame.com\n"
+    "servehalflife.com\n"
+    "servehttp.com\n"
+    "serveirc.com\n"
+    "serveminecraft.net\n"
+    "servemp3.com\n"
+    "servepics.com\n"
+    "servequake.com\n"
+    "sytes.net\n"
+    "webhop.me\n"
+    "zapto.org\n"
+    "stage.nodeart.io\n"
+    "pcloud.host\n"
+    "nyc.mn\n"
+    "static.observableusercontent.com\n"
+    "cya.gg\n"
+    "omg.lol\n"
+    "cloudycluster.net\n"
+    "omniwe.site\n"
+    "123hjemmeside.dk\n"
+    "123hjemmeside.no\n"
+    "123homepage.it\n"
+    "123kotisivu.fi\n"
+    "123minsida.se\n"
+    "123miweb.es\n"
+    "123paginaweb.pt\n"
+    "123sait.ru\n"
+    "123siteweb.fr\n"
+    "123webseite.at\n"
+    "123webseite.de\n"
+    "123website.be\n"
+    "123website.ch\n"
+    "123website.lu\n"
+    "123website.nl\n"
+    "service.one\n"
+    "simplesite.com\n"
+    "simplesite.com.br\n"
+    "simplesite.gr\n"
+    "simplesite.pl\n"
+    "nid.io\n"
+    "opensocial.site\n"
+    "opencraft.hosting\n"
+    "orsites.com\n"
+    "operaunite.com\n"
+    "tech.orange\n"
+    "authgear-staging.com\n"
+    "authgearapps.com\n"
+    "skygearapp.com\n"
+    "outsystemscloud.com\n"
+    "*.webpaas.ovh.net\n"
+    "*.hosting.ovh.net\n"
+    "ownprovider.com\n"
+    "own.pm\n"
+    "*.owo.codes\n"
+    "ox.rs\n"
+    "oy.lc\n"
+    "pgfog.com\n"
+    "pagefrontapp.com\n"
+    "pagexl.com\n"
+    "*.paywhirl.com\n"
+    "bar0.net\n"
+    "bar1.net\n"
+    "bar2.net\n"
+    "rdv.to\n"
+    "art.pl\n"
+    "gliwice.pl\n"
+    "krakow.pl\n"
+    "poznan.pl\n"
+    "wroc.pl\n"
+    "zakopane.pl\n"
+    "pantheonsite.io\n"
+    "gotpantheon.com\n"
+    "mypep.link\n"
+    "perspecta.cloud\n"
+    "lk3.ru\n"
+    "on-web.fr\n"
+    "bc.platform.sh\n"
+    "ent.platform.sh\n"
+    "eu.platform.sh\n"
+    "us.platform.sh\n"
+    "*.platformsh.site\n"
+    "*.tst.site\n"
+    "platter-app.com\n"
+    "platter-app.dev\n"
+    "platterp.us\n"
+    "pdns.page\n"
+    "plesk.page\n"
+    "pleskns.com\n"
+    "dyn53.io\n"
+    "onporter.run\n"
+    "co.bn\n"
+    "postman-echo.com\n"
+    "pstmn.io\n"
+    "mock.pstmn.io\n"
+    "httpbin.org\n"
+    "prequalifyme.today\n"
+    "xen.prgmr.com\n"
+    "priv.at\n"
+    "prvcy.page\n"
+    "*.dweb.link\n"
+    "protonet.io\n"
+    "chirurgiens-dentistes-en-france.fr\n"
+    "byen.site\n"
+    "pubtls.org\n"
+    "pythonanywhere.com\n"
+    "eu.pythonanywhere.com\n"
+    "qoto.io\n"
+    "qualifioapp.com\n"
+    "qbuser.com\n"
+    "cloudsite.builders\n"
+    "instances.spawn.cc\n"
+    "instantcloud.cn\n"
+    "ras.ru\n"
+    "qa2.com\n"
+    "qcx.io\n"
+    "*.sys.qcx.io\n"
+    "dev-myqnapcloud.com\n"
+    "alpha-myqnapcloud.com\n"
+    "myqnapcloud.com\n"
+    "*.quipelements.com\n"
+    "vapor.cloud\n"
+    "vaporcloud.io\n"
+    "rackmaze.com\n"
+    "rackmaze.net\n"
+    "g.vbrplsbx.io\n"
+    "*.on-k3s.io\n"
+    "*.on-rancher.cloud\n"
+    "*.on-rio.io\n"
+    "readthedocs.io\n"
+    "rhcloud.com\n"
+    "app.render.com\n"
+    "onrender.com\n"
+    "firewalledreplit.co\n"
+    "id.firewalledreplit.co\n"
+    "repl.co\n"
+    "id.repl.co\n"
+    "repl.run\n"
+    "resindevice.io\n"
+    "devices.resinstaging.io\n"
+    "hzc.io\n"
+    "wellbeingzone.eu\n"
+    "wellbeingzone.co.uk\n"
+    "adimo.co.uk\n"
+    "itcouldbewor.se\n"
+    "git-pages.rit.edu\n"
+    "rocky.page\n"
+    "\xd0\xb1\xd0\xb8\xd0\xb7.\xd1\x80\xd1\x83\xd1\x81\n"
+    "\xd0\xba\xd0\xbe\xd0\xbc.\xd1\x80\xd1\x83\xd1\x81\n"
+    "\xd0\xba\xd1\x80\xd1\x8b\xd0\xbc.\xd1\x80\xd1\x83\xd1\x81\n"
+    "\xd0\xbc\xd0\xb8\xd1\x80.\xd1\x80\xd1\x83\xd1\x81\n"
+    "\xd0\xbc\xd1\x81\xd0\xba.\xd1\x80\xd1\x83\xd1\x81\n"
+    "\xd0\xbe\xd1\x80\xd0\xb3.\xd1\x80\xd1\x83\xd1\x81\n"
+    "\xd1\x81\xd0\xb0\xd0\xbc\xd0\xb0\xd1\x80\xd0\xb0.\xd1\x80\xd1\x83\xd1\x81\n"
+    "\xd1\x81\xd0\xbe\xd1\x87\xd0\xb8.\xd1\x80\xd1\x83\xd1\x81\n"
+    "\xd1\x81\xd0\xbf\xd0\xb1.\xd1\x80\xd1\x83\xd1\x81\n"
+    "\xd1\x8f.\xd1\x80\xd1\x83\xd1\x81\n"
+    "*.builder.code.com\n"
+    "*.dev-builder.code.com\n"
+    "*.stg-builder.code.com\n"
+    "sandcats.io\n"
+    "logoip.de\n"
+    "logoip.com\n"
+    "fr-par-1.baremetal.scw.cloud\n"
+    "fr-par-2.baremetal.scw.cloud\n"
+    "nl-ams-1.baremetal.scw.cloud\n"
+    "fnc.fr-par.scw.cloud\n"
+    "functions.fnc.fr-par.scw.cloud\n"
+    "k8s.fr-par.scw.cloud\n"
+    "nodes.k8s.fr-par.scw.cloud\n"
+    "s3.fr-par.scw.cloud\n"
+    "s3-website.fr-par.scw.cloud\n"
+    "whm.fr-par.scw.cloud\n"
+    "priv.instances.scw.cloud\n"
+    "pub.instances.scw.cloud\n"
+    "k8s.scw.cloud\n"
+    "k8s.nl-ams.scw.cloud\n"
+    "nodes.k8s.nl-ams.scw.cloud\n"
+    "s3.nl-ams.scw.cloud\n"
+    "s3-website.nl-ams.scw.cloud\n"
+    "whm.nl-ams.scw.cloud\n"
+    "k8s.pl-waw.scw.cloud\n"
+    "nodes.k8s.pl-waw.scw.cloud\n"
+    "s3.pl-waw.scw.cloud\n"
+    "s3-website.pl-waw.scw.cloud\n"
+    "scalebook.scw.cloud\n"
+    "smartlabeling.scw.cloud\n"
+    "dedibox.fr\n"
+    "schokokeks.net\n"
+    "gov.scot\n"
+    "service.gov.scot\n"
+    "scrysec.com\n"
+    "firewall-gateway.com\n"
+    "firewall-gateway.de\n"
+    "my-gateway.de\n"
+    "my-router.de\n"
+    "spdns.de\n"
+    "spdns.eu\n"
+    "firewall-gateway.net\n"
+    "my-firewall.org\n"
+    "myfirewall.org\n"
+    "spdns.org\n"
+    "seidat.net\n"
+    "sellfy.store\n"
+    "senseering.net\n"
+    "minisite.ms\n"
+    "magnet.page\n"
+    "biz.ua\n"
+    "co.ua\n"
+    "pp.ua\n"
+    "shiftcrypto.dev\n"
+    "shiftcrypto.io\n"
+    "shiftedit.io\n"
+    "myshopblocks.com\n"
+    "myshopify.com\n"
+    "shopitsite.com\n"
+    "shopware.store\n"
+    "mo-siemens.io\n"
+    "1kapp.com\n"
+    "appchizi.com\n"
+    "applinzi.com\n"
+    "sinaapp.com\n"
+    "vipsinaapp.com\n"
+    "siteleaf.net\n"
+    "bounty-full.com\n"
+    "alpha.bounty-full.com\n"
+    "beta.bounty-full.com\n"
+    "small-web.org\n"
+    "vp4.me\n"
+    "snowflake.app\n"
+    "privatelink.snowflake.app\n"
+    "streamlit.app\n"
+    "streamlitapp.com\n"
+    "try-snowplow.com\n"
+    "srht.site\n"
+    "stackhero-network.com\n"
+    "musician.io\n"
+    "novecore.site\n"
+    "static.land\n"
+    "dev.static.land\n"
+    "sites.static.land\n"
+    "storebase.store\n"
+    "vps-host.net\n"
+    "atl.jelastic.vps-host.net\n"
+    "njs.jelastic.vps-host.net\n"
+    "ric.jelastic.vps-host.net\n"
+    "playstation-cloud.com\n"
+    "apps.lair.io\n"
+    "*.stolos.io\n"
+    "spacekit.io\n"
+    "customer.speedpartner.de\n"
+    "myspreadshop.at\n"
+    "myspreadshop.com.au\n"
+    "myspreadshop.be\n"
+    "myspreadshop.ca\n"
+    "myspreadshop.ch\n"
+    "myspreadshop.com\n"
+    "myspreadshop.de\n"
+    "myspreadshop.dk\n"
+    "myspreadshop.es\n"
+    "myspreadshop.fi\n"
+    "myspreadshop.fr\n"
+    "myspreadshop.ie\n"
+    "myspreadshop.it\n"
+    "myspreadshop.net\n"
+    "myspreadshop.nl\n"
+    "myspreadshop.no\n"
+    "myspreadshop.pl\n"
+    "myspreadshop.se\n"
+    "myspreadshop.co.uk\n"
+    "api.stdlib.com\n"
+    "storj.farm\n"
+    "utwente.io\n"
+    "soc.srcf.net\n"
+    "user.srcf.net\n"
+    "temp-dns.com\n"
+    "supabase.co\n"
+    "supabase.in\n"
+    "supabase.net\n"
+    "su.paba.se\n"
+    "*.s5y.io\n"
+    "*.sensiosite.cloud\n"
+    "syncloud.it\n"
+    "dscloud.biz\n"
+    "direct.quickconnect.cn\n"
+    "dsmynas.com\n"
+    "familyds.com\n"
+    "diskstation.me\n"
+    "dscloud.me\n"
+    "i234.me\n"
+    "myds.me\n"
+    "synology.me\n"
+    "dscloud.mobi\n"
+    "dsmynas.net\n"
+    "familyds.net\n"
+    "dsmynas.org\n"
+    "familyds.org\n"
+    "vpnplus.to\n"
+    "direct.quickconnect.to\n"
+    "tabitorder.co.il\n"
+    "mytabit.co.il\n"
+    "mytabit.com\n"
+    "taifun-dns.de\n"
+    "beta.tailscale.net\n"
+    "ts.net\n"
+    "gda.pl\n"
+    "gdansk.pl\n"
+    "gdynia.pl\n"
+    "med.pl\n"
+    "sopot.pl\n"
+    "site.tb-hosting.com\n"
+    "edugit.io\n"
+    "s3.teckids.org\n"
+    "telebit.app\n"
+    "telebit.io\n"
+    "*.telebit.xyz\n"
+    "*.firenet.ch\n"
+    "*.svc.firenet.ch\n"
+    "reservd.com\n"
+    "thingdustdata.com\n"
+    "cust.dev.thingdust.io\n"
+    "cust.disrec.thingdust.io\n"
+    "cust.prod.thingdust.io\n"
+    "cust.testing.thingdust.io\n"
+    "reservd.dev.thingdust.io\n"
+    "reservd.disrec.thingdust.io\n"
+    "reservd.testing.thingdust.io\n"
+    "tickets.io\n"
+    "arvo.network\n"
+    "azimuth.network\n"
+    "tlon.network\n"
+    "torproject.net\n"
+    "pages.torproject.net\n"
+    "bloxcms.com\n"
+    "townnews-staging.com\n"
+    "12hp.at\n"
+    "2ix.at\n"
+    "4lima.at\n"
+    "lima-city.at\n"
+    "12hp.ch\n"
+    "2ix.ch\n"
+    "4lima.ch\n"
+    "lima-city.ch\n"
+    "trafficplex.cloud\n"
+    "de.cool\n"
+    "12hp.de\n"
+    "2ix.de\n"
+    "4lima.de\n"
+    "lima-city.de\n"
+    "1337.pictures\n"
+    "clan.rip\n"
+    "lima-city.rocks\n"
+    "webspace.rocks\n"
+    "lima.zone\n"
+    "*.transurl.be\n"
+    "*.transurl.eu\n"
+    "*.transurl.nl\n"
+    "site.transip.me\n"
+    "tuxfamily.org\n"
+    "dd-dns.de\n"
+    "diskstation.eu\n"
+    "diskstation.org\n"
+    "dray-dns.de\n"
+    "draydns.de\n"
+    "dyn-vpn.de\n"
+    "dynvpn.de\n"
+    "mein-vigor.de\n"
+    "my-vigor.de\n"
+    "my-wan.de\n"
+    "syno-ds.de\n"
+    "synology-diskstation.de\n"
+    "synology-ds.de\n"
+    "typedream.app\n"
+    "pro.typeform.com\n"
+    "uber.space\n"
+    "*.uberspace.de\n"
+    "hk.com\n"
+    "hk.org\n"
+    "ltd.hk\n"
+    "inc.hk\n"
+    "it.com\n"
+    "name.pm\n"
+    "sch.tf\n"
+    "biz.wf\n"
+    "sch.wf\n"
+    "org.yt\n"
+    "virtualuser.de\n"
+    "virtual-user.de\n"
+    "upli.io\n"
+    "urown.cloud\n"
+    "dnsupdate.info\n"
+    "lib.de.us\n"
+    "2038.io\n"
+    "vercel.app\n"
+    "vercel.dev\n"
+    "now.sh\n"
+    "router.management\n"
+    "v-info.info\n"
+    "voorloper.cloud\n"
+    "neko.am\n"
+    "nyaa.am\n"
+    "be.ax\n"
+    "cat.ax\n"
+    "es.ax\n"
+    "eu.ax\n"
+    "gg.ax\n"
+    "mc.ax\n"
+    "us.ax\n"
+    "xy.ax\n"
+    "nl.ci\n"
+    "xx.gl\n"
+    "app.gp\n"
+    "blog.gt\n"
+    "de.gt\n"
+    "to.gt\n"
+    "be.gy\n"
+    "cc.hn\n"
+    "blog.kg\n"
+    "io.kg\n"
+    "jp.kg\n"
+    "tv.kg\n"
+    "uk.kg\n"
+    "us.kg\n"
+    "de.ls\n"
+    "at.md\n"
+    "de.md\n"
+    "jp.md\n"
+    "to.md\n"
+    "indie.porn\n"
+    "vxl.sh\n"
+    "ch.tc\n"
+    "me.tc\n"
+    "we.tc\n"
+    "nyan.to\n"
+    "at.vg\n"
+    "blog.vu\n"
+    "dev.vu\n"
+    "me.vu\n"
+    "v.ua\n"
+    "*.vultrobjects.com\n"
+    "wafflecell.com\n"
+    "*.webhare.dev\n"
+    "reserve-online.net\n"
+    "reserve-online.com\n"
+    "bookonline.app\n"
+    "hotelwithflight.com\n"
+    "wedeploy.io\n"
+    "wedeploy.me\n"
+    "wedeploy.sh\n"
+    "remotewd.com\n"
+    "pages.wiardweb.com\n"
+    "wmflabs.org\n"
+    "toolforge.org\n"
+    "wmcloud.org\n"
+    "panel.gg\n"
+    "daemon.panel.gg\n"
+    "messwithdns.com\n"
+    "woltlab-demo.com\n"
+    "myforum.community\n"
+    "community-pro.de\n"
+    "diskussionsbereich.de\n"
+    "community-pro.net\n"
+    "meinforum.net\n"
+    "affinitylottery.org.uk\n"
+    "raffleentry.org.uk\n"
+    "weeklylottery.org.uk\n"
+    "wpenginepowered.com\n"
+    "js.wpenginepowered.com\n"
+    "wixsite.com\n"
+    "editorx.io\n"
+    "half.host\n"
+    "xnbay.com\n"
+    "u2.xnbay.com\n"
+    "u2-local.xnbay.com\n"
+    "cistron.nl\n"
+    "demon.nl\n"
+    "xs4all.space\n"
+    "yandexcloud.net\n"
+    "storage.yandexcloud.net\n"
+    "website.yandexcloud.net\n"
+    "official.academy\n"
+    "yolasite.com\n"
+    "ybo.faith\n"
+    "yombo.me\n"
+    "homelink.one\n"
+    "ybo.party\n"
+    "ybo.review\n"
+    "ybo.science\n"
+    "ybo.trade\n"
+    "ynh.fr\n"
+    "nohost.me\n"
+    "noho.st\n"
+    "za.net\n"
+    "za.org\n"
+    "bss.design\n"
+    "basicserver.io\n"
+    "virtualserver.io\n"
+    "enterprisecloud.nu\n"
+    "// ===END PRIVATE DOMAINS===\n",
+};
+
+} // namespace detail
+
+absl::Span<const std::string_view> vendored_public_suffix_list() {
+    return detail::public_suffix_list;
+}
+
+} // namespace internal
+
+} // namespace net
+
+} // namespace batteries
@@ -14,8 +14,12 @@
 
 #pragma once
 
+#include <functional>
+#include <string>
 #include <string_view>
 
+#include <absl/types/span.h>
+
 #include "batteries/net/base.hpp"
 
 namespace batteries {
@@ -24,6 +28,17 @@ namespace net {
 
 namespace internal {
 
+// Inputs shorter than this are escaped and unescaped serially by the
+// parallel variants
+constexpr std::size_t parallel_escape_min_length = 1 << 20;
+
+/**
+ * An executor runs task(0), ..., task(count - 1), possibly concurrently, and
+ * returns once all of them have run.
+ */
+using executor = std::function<void(
+    std::size_t count, const std::function<void(std::size_t)>& task)>;
+
 // This determines what part of the encoding/decoding is being completed
 enum class encoding : uint8_t {
     encodePath,
@@ -58,9 +73,62 @@ bool shouldEscape(byte c, encoding mode);
  * which section of the URL string is being unescaped.
  * @param s A URL encoded string
  * @param mode The portion of the URL that is evaluated
- * @returns The decoded string and an error if any
+ * @returns The decoded string, or the error if any
+ */
+result<std::string> unescape(std::string_view s, encoding mode);
+
+/**
+ * @brief check_escapes checks that the escapes of s are well-formed for
+ * mode, the first pass of unescape.
+ * @param s A URL encoded string
+ * @param mode The portion of the URL that is evaluated
+ * @param changes Set to whether decoding s changes it.
+ * @returns The error unescape returns for s, if any.
+ */
+error check_escapes(std::string_view s, encoding mode, bool* changes);
+
+/**
+ * @brief decode_escapes decodes a string that check_escapes accepted, the
+ * second pass of unescape.
+ * @param s A URL encoded string
+ * @param mode The portion of the URL that is evaluated
+ * @param out Room for s.length() bytes. It may be s.data() since the
+ * decoded string is never longer.
+ * @returns One past the last byte written.
+ */
+char* decode_escapes(std::string_view s, encoding mode, char* out);
+
+/**
+ * @brief unescape_in_place decodes a string inside the caller's buffer by
+ * compacting it; the decoded form is never longer. It validates like unescape
+ * and nothing is allocated or copied elsewhere.
+ * @param data The URL encoded string.
+ * @param len The length of data, set to the decoded length.
+ * @param mode The portion of the URL that is evaluated
+ * @returns A view of the decoded string in data, or the error if any. data
+ * is unchanged on error.
+ */
+result<std::string_view> unescape_in_place(char* data, std::size_t& len,
+                                           encoding mode);
+
+/**
+ * @brief unescape_in_place decodes the string that fills data in place.
+ * @param data The URL encoded string.
+ * @param mode The portion of the URL that is evaluated
+ * @returns A view of the decoded string, a prefix of data, or the error if
+ * any. data is unchanged on error.
  */
-std::tuple<std::string, error> unescape(std::string_view s, encoding mode);
+result<std::string_view> unescape_in_place(absl::Span<char> data,
+                                           encoding mode);
+
+/**
+ * @brief needs_escape reports whether escaping s would change it; the mode
+ * specifies which section of the URL string is being escaped.
+ * @param s A raw string which may contain reserved URL characters
+ * @param mode The portion of the URL that is evaluated
+ * @returns true if escape(s, mode) differs from s, otherwise false.
+ */
+bool needs_escape(std::string_view s, encoding mode);
 
 /**
  * @brief escapes a string; the mode specifies
@@ -71,6 +139,78 @@ std::tuple<std::string, error> unescape(std::string_view s, encoding mode);
  */
 std::string escape(std::string_view s, encoding mode);
 
+/**
+ * @brief escapes a string and appends the result to dest; the mode specifies
+ * which section of the URL string is being escaped. The destination is grown
+ * once to the exact escaped size.
+ * @param dest The string the encoded form of s is appended to.
+ * @param s A raw string which contains reserved URL characters
+ * @param mode The portion of the URL that is evaluated
+ */
+void append_escaped(std::string* dest, std::string_view s, encoding mode);
+
+/**
+ * @brief escaped_length returns the exact length of escape(s, mode) without
+ * escaping s.
+ * @param s A raw string which may contain reserved URL characters
+ * @param mode The portion of the URL that is evaluated
+ * @returns The length of the encoded string.
+ */
+std::size_t escaped_length(std::string_view s, encoding mode);
+
+/**
+ * @brief parallel_escape escapes a large string in chunks. The escaped length
+ * of every chunk is counted concurrently, then every chunk is written
+ * concurrently at its final offset in the result.
+ * @param s A raw string which contains reserved URL characters
+ * @param mode The portion of the URL that is evaluated
+ * @param run The executor that runs the chunks.
+ * @param chunks The number of chunks to split s into.
+ * @returns escape(s, mode), computed serially if s is shorter than
+ * parallel_escape_min_length.
+ */
+std::string parallel_escape(std::string_view s, encoding mode,
+                            const executor& run, std::size_t chunks);
+
+/**
+ * @brief parallel_escape escapes a large string with threads threads, the
+ * calling thread included.
+ */
+std::string parallel_escape(std::string_view s, encoding mode,
+                            std::size_t threads);
+
+/**
+ * @brief parallel_unescape unescapes a large string in chunks that never
+ * split a %XX escape. Chunks are validated and their decoded lengths counted
+ * concurrently, then every chunk is decoded concurrently at its final offset
+ * in the result.
+ * @param s A URL encoded string
+ * @param mode The portion of the URL that is evaluated
+ * @param run The executor that runs the chunks.
+ * @param chunks The number of chunks to split s into.
+ * @returns unescape(s, mode), computed serially if s is shorter than
+ * parallel_escape_min_length. Errors are the same as unescape's.
+ */
+result<std::string> parallel_unescape(std::string_view s, encoding mode,
+                                      const executor& run, std::size_t chunks);
+
+/**
+ * @brief parallel_unescape unescapes a large string with threads threads,
+ * the calling thread included.
+ */
+result<std::string> parallel_unescape(std::string_view s, encoding mode,
+                                      std::size_t threads);
+
+/**
+ * @brief write_escaped writes the encoded form of s to out, which must have
+ * room for escaped_length(s, mode) bytes.
+ * @param out The buffer the encoded string is written to.
+ * @param s A raw string which may contain reserved URL characters
+ * @param mode The portion of the URL that is evaluated
+ * @returns One past the last byte written.
+ */
+char* write_escaped(char* out, std::string_view s, encoding mode);
+
 } // namespace internal
 
 } // namespace net
@@ -0,0 +1,213 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "label_trie.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <utility>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/strings/ascii.h>
+
+namespace batteries {
+
+namespace net {
+
+namespace internal {
+
+namespace detail {
+
+// Compares a lower case label to a label of any case like
+// std::string_view::compare.
+inline int compare_label(std::string_view lower, std::string_view label) {
+    auto n = std::min(lower.length(), label.length());
+    for (std::size_t i = 0; i < n; i++) {
+        byte l = lower[i];
+        byte r = absl::ascii_tolower(label[i]);
+        if (l != r) {
+            return l < r ? -1 : 1;
+        }
+    }
+    if (lower.length() == label.length()) {
+        return 0;
+    }
+    return lower.length() < label.length() ? -1 : 1;
+}
+
+} // namespace detail
+
+label_trie::label_trie()
+    : nodes_(1, node{0, 0, 0, 0, 0})
+    , labels_() {}
+
+label_trie::node_id label_trie::find_child(node_id id,
+                                           std::string_view label) const {
+    const auto& parent = nodes_[id];
+    uint32_t first = parent.first_child;
+    uint32_t count = parent.child_count;
+
+    // Binary search of the sorted children
+    while (count > 0) {
+        uint32_t half = count / 2;
+        const auto& child = nodes_[first + half];
+        int cmp = detail::compare_label(
+            std::string_view(labels_.data() + child.label_offset,
+                             child.label_length),
+            label);
+        if (cmp == 0) {
+            return first + half;
+        }
+        if (cmp < 0) {
+            first += half + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+    return npos;
+}
+
+uint8_t label_trie::flags(node_id id) const { return nodes_[id].flags; }
+
+std::string_view label_trie::label(node_id id) const {
+    const auto& n = nodes_[id];
+    return std::string_view(labels_.data() + n.label_offset, n.label_length);
+}
+
+std::size_t label_trie::size() const { return nodes_.size(); }
+
+std::size_t label_trie::memory_usage() const {
+    return nodes_.capacity() * sizeof(node) + labels_.capacity();
+}
+
+label_trie::builder::builder()
+    : entries_() {}
+
+void label_trie::builder::insert(std::string_view name, uint8_t flags) {
+    std::string key;
+    key.reserve(name.length());
+    std::size_t end = name.length();
+    while (end != name.npos) {
+        auto label = next_label(name, end);
+        if (label.empty()) {
+            continue;
+        }
+        if (!key.empty()) {
+            key.push_back('\0');
+        }
+        for (char c : label) {
+            key.push_back(absl::ascii_tolower(c));
+        }
+    }
+    if (!key.empty()) {
+        entries_.push_back(entry{std::move(key), flags});
+    }
+}
+
+void label_trie::builder::reserve(std::size_t count) {
+    entries_.reserve(count);
+}
+
+label_trie label_trie::builder::build() {
+    // '\0' sorts before every other byte, so the keys are ordered label by
+    // label and a key sorts before the keys that extend it.
+    std::sort(entries_.begin(), entries_.end(),
+              [](const entry& lhs, const entry& rhs) {
+                  return lhs.key < rhs.key;
+              });
+
+    label_trie trie;
+    // The offsets of the distinct labels, sized for about one per key
+    absl::flat_hash_map<std::string_view, uint32_t> interned;
+    interned.reserve(entries_.size());
+
+    // The start of the next label of every key, past the end once every
+    // label has a node.
+    std::vector<std::size_t> cursors(entries_.size(), 0);
+    auto next = [&](std::size_t i) {
+        const auto& key = entries_[i].key;
+        auto begin = cursors[i];
+        auto end = std::min(key.find('\0', begin), key.length());
+        return std::string_view(key).substr(begin, end - begin);
+    };
+
+    // Breadth first so the children of every node are contiguous. The nodes
+    // of a range of entries share all labels before the cursors.
+    struct range {
+        node_id id;
+        std::size_t first;
+        std::size_t last;
+    };
+    std::deque<range> pending;
+    pending.push_back(range{root, 0, entries_.size()});
+    while (!pending.empty()) {
+        auto [id, first, last] = pending.front();
+        pending.pop_front();
+
+        // Keys that end at this node
+        while (first < last &&
+               cursors[first] > entries_[first].key.length()) {
+            trie.nodes_[id].flags |= entries_[first].flags;
+            first++;
+        }
+
+        trie.nodes_[id].first_child = static_cast<uint32_t>(trie.nodes_.size());
+        uint32_t child_count = 0;
+        while (first < last) {
+            auto label = next(first);
+            auto child_last = first;
+            while (child_last < last && next(child_last) == label) {
+                cursors[child_last] += label.length() + 1;
+                child_last++;
+            }
+
+            auto found = interned.find(label);
+            uint32_t offset;
+            if (found != interned.end()) {
+                offset = found->second;
+            } else {
+                offset = static_cast<uint32_t>(trie.labels_.size());
+                trie.labels_.append(label.data(), label.length());
+                interned.emplace(label, offset);
+            }
+
+            auto child_id = static_cast<node_id>(trie.nodes_.size());
+            trie.nodes_.push_back(
+                label_trie::node{offset, 0, 0,
+                                 static_cast<uint16_t>(label.length()), 0});
+            pending.push_back(range{child_id, first, child_last});
+            child_count++;
+            first = child_last;
+        }
+        trie.nodes_[id].child_count = child_count;
+    }
+    trie.nodes_.shrink_to_fit();
+    trie.labels_.shrink_to_fit();
+    return trie;
+}
+
+std::string_view next_label(std::string_view name, std::size_t& end) {
+    auto dot = end == 0 ? name.npos : name.rfind('.', end - 1);
+    std::size_t begin = dot == name.npos ? 0 : dot + 1;
+    auto label = name.substr(begin, end - begin);
+    end = dot;
+    return label;
+}
+
+} // namespace internal
+
+} // namespace net
+
+} // namespace batteries
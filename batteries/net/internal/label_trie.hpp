@@ -0,0 +1,150 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "batteries/net/base.hpp"
+
+namespace batteries {
+
+namespace net {
+
+namespace internal {
+
+/**
+ * A label_trie is a compact trie of domain names keyed by their labels from
+ * right to left, so "www.example.com" is stored as com -> example -> www. The
+ * nodes are stored in a single array in breadth first order with the
+ * children of a node contiguous and sorted, and every distinct label is
+ * stored once in a shared buffer. Each node carries a set of flags defined by
+ * the user of the trie.
+ *
+ * Lookups never allocate and compare labels ASCII case-insensitively. The
+ * stored labels are lower case.
+ */
+class label_trie {
+
+  public:
+    using node_id = uint32_t;
+
+    static constexpr node_id root = 0;
+    static constexpr node_id npos = UINT32_MAX;
+
+    class builder;
+
+    label_trie();
+
+    /**
+     * @brief find_child finds the child of node whose label is label.
+     * @param node The parent node.
+     * @param label A single label, it may use any case.
+     * @returns The child or npos if there is none.
+     */
+    node_id find_child(node_id node, std::string_view label) const;
+
+    /**
+     * @brief flags returns the flags of a node.
+     */
+    uint8_t flags(node_id node) const;
+
+    /**
+     * @brief label returns the label of a node. The root has an empty label.
+     */
+    std::string_view label(node_id node) const;
+
+    /**
+     * @brief size returns the number of nodes including the root.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief memory_usage returns the number of bytes used by the nodes and
+     * labels.
+     */
+    std::size_t memory_usage() const;
+
+  private:
+    struct node {
+        uint32_t label_offset;
+        uint32_t first_child;
+        uint32_t child_count;
+        uint16_t label_length;
+        uint8_t flags;
+    };
+
+    std::vector<node> nodes_;
+    std::string labels_;
+};
+
+/**
+ * A label_trie::builder collects domain names and compiles them into a
+ * label_trie. The names are kept as flat keys and sorted when the trie is
+ * built, so building needs no per-label allocations even for millions of
+ * names.
+ */
+class label_trie::builder {
+
+  public:
+    builder();
+
+    /**
+     * @brief insert adds a domain name and sets flags on the node of its
+     * leftmost label. Flags of names inserted more than once are combined.
+     * @param name A domain name such as "www.example.com". Empty labels are
+     * skipped.
+     * @param flags The flags to set.
+     */
+    void insert(std::string_view name, uint8_t flags);
+
+    /**
+     * @brief reserve reserves space for count names.
+     */
+    void reserve(std::size_t count);
+
+    /**
+     * @brief build compiles the names inserted so far.
+     * @returns The compiled trie.
+     */
+    label_trie build();
+
+  private:
+    struct entry {
+        // The lower case labels from right to left separated by '\0'
+        std::string key;
+        uint8_t flags;
+    };
+
+    std::vector<entry> entries_;
+};
+
+/**
+ * @brief next_label returns the label of name that ends at end and moves end
+ * to the end of the label to its left. Use end = name.length() for the
+ * rightmost label; there are no labels left once end is npos.
+ * @param name A domain name.
+ * @param end The end of the label, updated to the end of the next label.
+ * @returns The label.
+ */
+std::string_view next_label(std::string_view name, std::size_t& end);
+
+} // namespace internal
+
+} // namespace net
+
+} // namespace batteries
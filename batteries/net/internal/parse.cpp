@@ -27,7 +27,6 @@ SOFTWARE.
 
 #include <absl/strings/ascii.h>
 #include <absl/strings/match.h>
-#include <absl/strings/str_split.h>
 
 #include "parse.hpp"
 
@@ -55,7 +54,7 @@ bool valid_optional_port(std::string_view port) {
         return true;
     }
 
-    if (port.at(0) != ':') {
+    if (port[0] != ':') {
         return false;
     }
     for (auto c : port.substr(1)) {
@@ -80,27 +79,20 @@ bool valid_userinfo(std::string_view s) {
     return true;
 }
 
-std::tuple<std::string, std::string_view, error>
-parse_fragment(std::string_view rawurl) {
-    std::string fragment;
-    std::string_view fragment_view, rest;
-    error err;
-
-    std::tie(rest, fragment_view) = split(rawurl, "#", true);
-    if (fragment_view.empty()) {
-        return std::make_tuple(fragment, rest, err);
-    }
-
-    std::tie(fragment, err) = unescape(fragment_view, encoding::encodeFragment);
-    if (err != errors::no_error) {
-        return std::make_tuple(std::string(), rest, err);
+result<fragment_parts> parse_fragment(std::string_view rawurl) {
+    std::string_view rest, fragment;
+    std::tie(rest, fragment) = split(rawurl, "#", true);
+    if (fragment.empty()) {
+        return fragment_parts{std::string(), rest};
     }
 
-    return std::make_tuple(fragment, rest, err);
+    return unescape(fragment, encoding::encodeFragment)
+        .transform([rest](std::string&& unescaped) {
+            return fragment_parts{std::move(unescaped), rest};
+        });
 }
 
-std::tuple<std::string, std::string_view, error>
-parse_scheme(std::string_view rawurl) {
+result<scheme_parts> parse_scheme(std::string_view rawurl) {
     for (int i = 0; i < rawurl.length(); i++) {
         byte c = rawurl[i];
         if (absl::ascii_isalpha(c)) {
@@ -109,78 +101,72 @@ parse_scheme(std::string_view rawurl) {
 
         if (absl::ascii_isdigit(c) || c == '+' || c == '-' || c == '.') {
             if (i == 0) {
-                return std::make_tuple("", rawurl, errors::no_error);
+                return scheme_parts{std::string(), rawurl};
             }
         }
         if (c == ':') {
             if (i == 0) {
-                return std::make_tuple("", std::string_view(),
-                                       error(url_error_code::parse_error,
-                                             "missing protocol scheme"));
+                return error(url_error_code::parse_error,
+                             errors::static_message{"missing protocol scheme"});
             }
-            return std::make_tuple((std::string)rawurl.substr(0, i),
-                                   rawurl.substr(i + 1), errors::no_error);
+            return scheme_parts{std::string(rawurl.substr(0, i)),
+                                rawurl.substr(i + 1)};
         }
 
         // we have encountered an invalid character,
         // so there is no valid scheme
-        return std::make_tuple("", rawurl, errors::no_error);
+        return scheme_parts{std::string(), rawurl};
     }
-    return std::make_tuple("", rawurl, errors::no_error);
+    return scheme_parts{std::string(), rawurl};
 }
 
-std::tuple<std::string, std::string, std::string_view, error>
-parse_authority(std::string_view authority) {
+result<authority_parts> parse_authority(std::string_view authority) {
     auto i = authority.rfind('@');
 
     if (i == authority.npos) {
-        return std::make_tuple("", "", authority, errors::no_error);
+        return authority_parts{std::string(), std::string(), authority};
     }
 
     std::string_view userinfo = authority.substr(0, i);
 
     if (!internal::valid_userinfo(userinfo)) {
-        return std::make_tuple(
-            "", "", std::string_view(),
-            error(url_error_code::parse_error, "invalid userinfo"));
+        return error(url_error_code::parse_error,
+                     errors::static_message{"invalid userinfo"});
     }
 
-    // Return values
-    std::string username;
-    std::string password;
-    std::string_view host = authority.substr(i + 1);
-    error err;
+    authority_parts parts;
+    parts.host = authority.substr(i + 1);
 
     // Has no password
     if (!absl::StrContains(userinfo, ":")) {
-        std::tie(userinfo, err) =
+        auto username =
             unescape(userinfo, internal::encoding::encodeUserPassword);
-        if (err != errors::no_error) {
-            return std::make_tuple("", "", host, err);
+        if (!username) {
+            return username.error();
         }
-        username = (std::string)userinfo;
+        parts.username = *std::move(username);
     } else { // Has password
         std::string_view username_view;
         std::string_view password_view;
         std::tie(username_view, password_view) =
             internal::split(userinfo, ":", true);
-        std::tie(username, err) =
+        auto username =
             unescape(username_view, internal::encoding::encodeUserPassword);
-        if (err != errors::no_error) {
-            return std::make_tuple("", "", host, err);
+        if (!username) {
+            return username.error();
         }
-        std::tie(password, err) =
+        auto password =
             unescape(password_view, internal::encoding::encodeUserPassword);
-        if (err != errors::no_error) {
-            return std::make_tuple("", "", host, err);
+        if (!password) {
+            return password.error();
         }
+        parts.username = *std::move(username);
+        parts.password = *std::move(password);
     }
-    return std::make_tuple(username, password, host, err);
+    return parts;
 }
 
-std::tuple<std::string, std::string, error> parse_host(std::string_view host) {
-    error err;
-    std::string hostString;
+result<host_parts> parse_host(std::string_view host) {
     std::string portString;
     std::string_view port;
 
@@ -190,16 +176,13 @@ std::tuple<std::string, std::string, error> parse_host(std::string_view host) {
         // E.g., "[fe80::1]", "[fe80::1%25en0]", "[fe80::1]:80".
         auto i = host.find("]");
         if (i == host.npos) {
-            return std::make_tuple(
-                "", "",
-                error(url_error_code::parse_error, "missing ']' in host"));
+            return error(url_error_code::parse_error,
+                         errors::static_message{"missing ']' in host"});
         }
         port = host.substr(i + 1);
         if (!internal::valid_optional_port(port)) {
-            return std::make_tuple(
-                "", "",
-                error(url_error_code::parse_error,
-                      absl::StrCat("invalid port ", port, " after host")));
+            return error(url_error_code::parse_error,
+                         absl::StrCat("invalid port ", port, " after host"));
         }
         if (!port.empty()) {
             // Remove leading ':'
@@ -217,34 +200,30 @@ std::tuple<std::string, std::string, error> parse_host(std::string_view host) {
         // like newlines.
         auto zone = host.find("%25");
         if (zone != host.npos) {
-            std::string host1;
-            std::string host2;
-            std::string host3;
-            std::tie(host1, err) =
+            auto host1 =
                 unescape(host.substr(0, zone), internal::encoding::encodeHost);
-            if (err != errors::no_error) {
-                return std::make_tuple("", "", err);
+            if (!host1) {
+                return host1.error();
             }
-            std::tie(host2, err) =
+            auto host2 =
                 unescape(host.substr(zone, i), internal::encoding::encodeZone);
-            if (err != errors::no_error) {
-                return std::make_tuple("", "", err);
+            if (!host2) {
+                return host2.error();
             }
-            hostString = absl::StrCat(host1, host2);
 
-            return std::make_tuple(hostString, portString, errors::no_error);
+            return host_parts{absl::StrCat(*host1, *host2),
+                              std::move(portString)};
         }
     } else {
 
         // Handle IPv4
         auto i = host.rfind(':');
         if (i != host.npos) { // Process with port number
-            port = (std::string)host.substr(i);
+            port = host.substr(i);
             if (!internal::valid_optional_port(port)) {
-                return std::make_tuple(
-                    "", "",
-                    error(url_error_code::parse_error,
-                          absl::StrCat("invalid port ", port, " after host")));
+                return error(
+                    url_error_code::parse_error,
+                    absl::StrCat("invalid port ", port, " after host"));
             }
             // Remove colon and assign to return value
             portString = (std::string)port.substr(1);
@@ -253,50 +232,359 @@ std::tuple<std::string, std::string, error> parse_host(std::string_view host) {
         }
     }
 
-    std::tie(hostString, err) = unescape(host, internal::encoding::encodeHost);
-    if (err != errors::no_error) {
-        return std::make_tuple("", "", err);
+    return unescape(host, internal::encoding::encodeHost)
+        .transform([&portString](std::string&& hostname) {
+            return host_parts{std::move(hostname), std::move(portString)};
+        });
+}
+
+namespace detail {
+
+// Parses an IPv4 address the way inet_aton does: one to four parts in
+// decimal, octal or hexadecimal, the last part filling the remaining bytes.
+static bool parse_ipv4(std::string_view s, uint32_t* address) {
+    uint64_t parts[4];
+    std::size_t count = 0;
+    while (true) {
+        if (count == 4) {
+            return false;
+        }
+        auto dot = s.find('.');
+        auto part = s.substr(0, dot);
+
+        uint64_t base = 10;
+        if (absl::StartsWithIgnoreCase(part, "0x")) {
+            base = 16;
+            part.remove_prefix(2);
+        } else if (part.length() > 1 && part[0] == '0') {
+            base = 8;
+            part.remove_prefix(1);
+        }
+        if (part.empty() || part.length() > 32) {
+            return false;
+        }
+
+        uint64_t value = 0;
+        for (byte c : part) {
+            uint64_t digit;
+            if (absl::ascii_isdigit(c)) {
+                digit = c - '0';
+            } else if (base == 16 && absl::ascii_isxdigit(c)) {
+                digit = absl::ascii_tolower(c) - 'a' + 10;
+            } else {
+                return false;
+            }
+            if (digit >= base) {
+                return false;
+            }
+            value = value * base + digit;
+            if (value > UINT32_MAX) {
+                return false;
+            }
+        }
+        parts[count++] = value;
+
+        if (dot == s.npos) {
+            break;
+        }
+        s.remove_prefix(dot + 1);
     }
 
-    return std::make_tuple(hostString, portString, errors::no_error);
+    // Every part but the last is a single byte
+    uint64_t result = 0;
+    for (std::size_t i = 0; i + 1 < count; i++) {
+        if (parts[i] > 0xff) {
+            return false;
+        }
+        result |= parts[i] << (8 * (3 - i));
+    }
+    auto last = parts[count - 1];
+    if (last >> (8 * (5 - count)) != 0) {
+        return false;
+    }
+    *address = static_cast<uint32_t>(result | last);
+    return true;
 }
 
-std::tuple<query_map, error> parse_query(std::string_view query) {
-    error err;
-    query_map map;
-    std::string key;
-    std::string value;
+// Parses a dotted quad of decimal bytes, the only IPv4 form allowed inside
+// an IPv6 address.
+static bool parse_dotted_quad(std::string_view s, byte* bytes) {
+    for (std::size_t i = 0; i < 4; i++) {
+        auto dot = s.find('.');
+        if ((i < 3) == (dot == s.npos)) {
+            return false;
+        }
+        auto part = s.substr(0, dot);
+        if (part.empty() || part.length() > 3 ||
+            (part.length() > 1 && part[0] == '0')) {
+            return false;
+        }
+        unsigned value = 0;
+        for (byte c : part) {
+            if (!absl::ascii_isdigit(c)) {
+                return false;
+            }
+            value = value * 10 + (c - '0');
+        }
+        if (value > 0xff) {
+            return false;
+        }
+        bytes[i] = static_cast<byte>(value);
+        s.remove_prefix(part.length() + (dot == s.npos ? 0 : 1));
+    }
+    return true;
+}
+
+static bool parse_ipv6(std::string_view s, ip_address* address) {
+    uint16_t groups[8] = {};
+    std::size_t count = 0;
+    std::size_t gap = 8;
+
+    if (absl::StartsWith(s, "::")) {
+        gap = 0;
+        s.remove_prefix(2);
+    }
+    while (!s.empty()) {
+        if (count == 8) {
+            return false;
+        }
+        auto colon = s.find(':');
+        auto part = s.substr(0, colon);
+
+        // An IPv4 address may end the address
+        if (colon == s.npos && part.find('.') != part.npos) {
+            byte bytes[4];
+            if (count > 6 || !parse_dotted_quad(part, bytes)) {
+                return false;
+            }
+            groups[count++] = static_cast<uint16_t>(bytes[0] << 8 | bytes[1]);
+            groups[count++] = static_cast<uint16_t>(bytes[2] << 8 | bytes[3]);
+            break;
+        }
 
-    std::vector<std::string_view> splitResults =
-        absl::StrSplit(query, absl::ByAnyChar("&;"));
-    for (auto& result : splitResults) {
-        if (result.empty()) {
-            return std::make_tuple(query_map(),
-                                   error(url_error_code::parse_error, query));
+        if (part.empty() || part.length() > 4) {
+            return false;
         }
-        std::vector<std::string_view> keyValueResults =
-            absl::StrSplit(result, '=');
-        if (keyValueResults.size() != 2) {
-            return std::make_tuple(query_map(),
-                                   error(url_error_code::parse_error, query));
+        uint16_t value = 0;
+        for (byte c : part) {
+            if (!absl::ascii_isxdigit(c)) {
+                return false;
+            }
+            value = static_cast<uint16_t>(value << 4 | unhex(c));
         }
+        groups[count++] = value;
 
-        std::tie(key, err) =
-            unescape(keyValueResults[0], encoding::encodeQueryComponent);
-        if (err != errors::no_error) {
+        if (colon == s.npos) {
             break;
         }
+        s.remove_prefix(colon + 1);
+        if (absl::StartsWith(s, ":")) {
+            if (gap != 8) {
+                return false;
+            }
+            gap = count;
+            s.remove_prefix(1);
+        } else if (s.empty()) {
+            return false;
+        }
+    }
 
-        std::tie(value, err) =
-            unescape(keyValueResults[1], encoding::encodeQueryComponent);
-        if (err != errors::no_error) {
+    if (gap == 8) {
+        if (count != 8) {
+            return false;
+        }
+    } else {
+        if (count == 8) {
+            return false;
+        }
+        // Move the groups after the gap to the end
+        std::size_t tail = count - gap;
+        for (std::size_t i = 0; i < tail; i++) {
+            groups[7 - i] = groups[count - 1 - i];
+            groups[count - 1 - i] = 0;
+        }
+    }
+
+    for (std::size_t i = 0; i < 8; i++) {
+        (*address)[2 * i] = static_cast<byte>(groups[i] >> 8);
+        (*address)[2 * i + 1] = static_cast<byte>(groups[i]);
+    }
+    return true;
+}
+
+} // namespace detail
+
+bool parse_ip(std::string_view hostname, ip_address* address) {
+    bool bracketed = absl::StartsWith(hostname, "[");
+    if (bracketed) {
+        if (!absl::EndsWith(hostname, "]")) {
+            return false;
+        }
+        hostname = hostname.substr(1, hostname.length() - 2);
+    }
+
+    if (bracketed || hostname.find(':') != hostname.npos) {
+        // The zone doesn't change the address
+        return detail::parse_ipv6(hostname.substr(0, hostname.find('%')),
+                                  address);
+    }
+
+    uint32_t ipv4;
+    if (!detail::parse_ipv4(hostname, &ipv4)) {
+        return false;
+    }
+    *address = ip_address{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff};
+    (*address)[12] = static_cast<byte>(ipv4 >> 24);
+    (*address)[13] = static_cast<byte>(ipv4 >> 16);
+    (*address)[14] = static_cast<byte>(ipv4 >> 8);
+    (*address)[15] = static_cast<byte>(ipv4);
+    return true;
+}
+
+error check_query_limits(std::string_view query, const parse_limits& limits) {
+    if (query.length() > limits.max_length) {
+        return error(url_error_code::limit_exceeded,
+                     errors::static_message{"query too long"});
+    }
+
+    std::size_t params = 1;
+    std::size_t escapes = 0;
+    std::size_t key_length = 0;
+    std::size_t value_length = 0;
+    bool in_value = false;
+    for (char c : query) {
+        switch (c) {
+        case '&':
+        case ';':
+            if (++params > limits.max_params) {
+                return error(url_error_code::limit_exceeded,
+                             errors::static_message{
+                                 "too many query parameters"});
+            }
+            key_length = 0;
+            value_length = 0;
+            in_value = false;
+            continue;
+        case '=':
+            if (!in_value) {
+                in_value = true;
+                continue;
+            }
+            break;
+        case '%':
+            if (++escapes > limits.max_escapes) {
+                return error(url_error_code::limit_exceeded,
+                             errors::static_message{
+                                 "too many escapes in query"});
+            }
             break;
         }
+        if (in_value) {
+            if (++value_length > limits.max_value_length) {
+                return error(url_error_code::limit_exceeded,
+                             errors::static_message{"query value too long"});
+            }
+        } else if (++key_length > limits.max_key_length) {
+            return error(url_error_code::limit_exceeded,
+                         errors::static_message{"query key too long"});
+        }
+    }
+    return errors::no_error;
+}
+
+error validate_query(std::string_view query) {
+    const char* begin = query.data();
+    bool done = false;
+    while (!done) {
+        auto separator = query.find_first_of("&;");
+        auto pair = query.substr(0, separator);
+        if (separator == query.npos) {
+            done = true;
+        } else {
+            query.remove_prefix(separator + 1);
+        }
+
+        auto equals = pair.find('=');
+        if (pair.empty() || equals == pair.npos ||
+            pair.find('=', equals + 1) != pair.npos) {
+            return error(url_error_code::parse_error, pair.data() - begin,
+                         pair);
+        }
+
+        bool changes;
+        auto err = check_escapes(pair.substr(0, equals),
+                                 encoding::encodeQueryComponent, &changes);
+        if (err != errors::no_error) {
+            return err;
+        }
+        err = check_escapes(pair.substr(equals + 1),
+                            encoding::encodeQueryComponent, &changes);
+        if (err != errors::no_error) {
+            return err;
+        }
+    }
+    return errors::no_error;
+}
+
+bool escaped_equals(std::string_view escaped, std::string_view decoded) {
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < escaped.length(); i++, j++) {
+        if (j == decoded.length()) {
+            return false;
+        }
+        byte c = escaped[i];
+        if (c == '+') {
+            c = ' ';
+        } else if (c == '%') {
+            if (i + 2 >= escaped.length() ||
+                !absl::ascii_isxdigit(escaped[i + 1]) ||
+                !absl::ascii_isxdigit(escaped[i + 2])) {
+                return false;
+            }
+            c = static_cast<byte>(unhex(escaped[i + 1]) << 4 |
+                                  unhex(escaped[i + 2]));
+            i += 2;
+        }
+        if (c != static_cast<byte>(decoded[j])) {
+            return false;
+        }
+    }
+    return j == decoded.length();
+}
 
-        map.emplace(key, value);
+error parse_bool(std::string_view s, bool* value) {
+    if (s == "1" || s == "t" || s == "T" || s == "TRUE" || s == "true" ||
+        s == "True") {
+        *value = true;
+        return errors::no_error;
+    }
+    if (s == "0" || s == "f" || s == "F" || s == "FALSE" || s == "false" ||
+        s == "False") {
+        *value = false;
+        return errors::no_error;
+    }
+    return error(url_error_code::conversion_error, 0, s);
+}
+
+result<query_map> parse_query(std::string_view query,
+                              const parse_limits& limits) {
+    error err = check_query_limits(query, limits);
+    if (err != errors::no_error) {
+        return err;
+    }
+
+    query_map map;
+    err = decode_query(query, [&](std::string key, std::string value) {
+        map.emplace(std::move(key), std::move(value));
+    });
+    if (err.error_code() == url_error_code::parse_error) {
+        return error(url_error_code::parse_error, 0, query);
+    }
+    if (err) {
+        return err;
     }
 
-    return std::make_tuple(map, err);
+    return map;
 }
 
 } // namespace internal
@@ -14,9 +14,17 @@
 
 #pragma once
 
-#include <sstream>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <iterator>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <absl/strings/str_cat.h>
 
@@ -32,6 +40,12 @@ namespace internal {
 
 using query_map = std::multimap<std::string, std::string>;
 
+/**
+ * An IP address in network byte order. IPv4 addresses are stored IPv4-mapped
+ * (::ffff:a.b.c.d) so both families share one representation.
+ */
+using ip_address = std::array<byte, 16>;
+
 /**
  * @brief splits a string into two and only two parts at "match". If cutMatch is
  * true, the delimiter is consumed.
@@ -64,14 +78,46 @@ bool valid_optional_port(std::string_view port);
  */
 bool valid_userinfo(std::string_view s);
 
+/**
+ * The fragment of a raw url and the rest of it, see parse_fragment.
+ */
+struct fragment_parts {
+    std::string fragment;
+    std::string_view rest;
+};
+
+/**
+ * The scheme of a raw url and the rest of it, see parse_scheme.
+ */
+struct scheme_parts {
+    std::string scheme;
+    std::string_view rest;
+};
+
+/**
+ * The userinfo of an authority and its host, see parse_authority.
+ */
+struct authority_parts {
+    std::string username;
+    std::string password;
+    std::string_view host;
+};
+
+/**
+ * The hostname and port of a host, see parse_host.
+ */
+struct host_parts {
+    std::string hostname;
+    std::string port;
+};
+
 /**
  * @brief Takes a raw url that may contain the form path?query#fragment
  * and removes the fragment.
  * @param rawurl The url that may contain a fragment section.
  * @returns If there is a fragment found, returns fragment,path; else "",rawurl.
  */
-std::tuple<std::string, std::string_view, error>
-parse_fragment(std::string_view rawurl);
+result<fragment_parts> parse_fragment(std::string_view rawurl);
 
 /**
  * @brief Takes a raw url that may contain the form scheme:path
@@ -79,8 +125,7 @@ parse_fragment(std::string_view rawurl);
  * @param rawurl The url that may contain a scheme section.
  * @returns If there is a scheme found, returns scheme,path; else "",rawurl.
  */
-std::tuple<std::string, std::string_view, error>
-parse_scheme(std::string_view rawurl);
+result<scheme_parts> parse_scheme(std::string_view rawurl);
 
 /**
  * @brief parse_authority takes a string of form [userinfo@]host] and returns
@@ -90,41 +135,243 @@ parse_scheme(std::string_view rawurl);
  * @param authority a string_view of the form [userinfo@]host].
  * @returns The username, password, and the host portion of the input.
  */
-std::tuple<std::string, std::string, std::string_view, error>
-parse_authority(std::string_view authority);
+result<authority_parts> parse_authority(std::string_view authority);
 
 /**
  * @brief parse_host parses the portion of the URL that contains the DNS or IP
  * address and, optionally, the port.
  * @param host The portion of the URL that contains the hostname information.
- * @returns A tuple containing the hostname, port number, and error if any.
+ * @returns The hostname and port number, or the error if any.
+ */
+result<host_parts> parse_host(std::string_view host);
+
+/**
+ * @brief parse_ip parses a hostname returned by parse_host that is an IP
+ * literal. IPv6 addresses may be enclosed in '[]' and carry a zone, which is
+ * ignored. IPv4 addresses are accepted in every form resolvers accept, such
+ * as "127.1" or "0x7f000001", because that is how the host will be reached.
+ * @param hostname The hostname.
+ * @param address The parsed address.
+ * @returns true if hostname is an IP literal.
+ */
+bool parse_ip(std::string_view hostname, ip_address* address);
+
+/**
+ * @brief check_query_limits checks a raw query against limits without
+ * decoding or allocating anything.
+ * @param query The raw query.
+ * @param limits The limits to enforce.
+ * @returns A url_error_code::limit_exceeded error if a limit is crossed.
+ */
+error check_query_limits(std::string_view query, const parse_limits& limits);
+
+/**
+ * @brief validate_query reports the error decode_query would return for
+ * query without decoding or allocating anything.
+ * @param query The raw query.
+ * @returns error indicating an error while parsing if any.
  */
-std::tuple<std::string, std::string, error> parse_host(std::string_view host);
+error validate_query(std::string_view query);
+
+/**
+ * @brief escaped_equals compares an escaped query component to a decoded one
+ * without decoding it.
+ * @param escaped The escaped component, such as "a%20b+c".
+ * @param decoded The decoded component, such as "a b c".
+ * @returns true if escaped decodes to decoded.
+ */
+bool escaped_equals(std::string_view escaped, std::string_view decoded);
+
+/**
+ * @brief parse_bool converts a decoded query value to a boolean. It accepts
+ * 1, t, T, TRUE, true, True, 0, f, F, FALSE, false and False.
+ * @param s The decoded value.
+ * @param value The converted value, unchanged on error.
+ * @returns url_error_code::conversion_error if s isn't a boolean.
+ */
+error parse_bool(std::string_view s, bool* value);
+
+/**
+ * @brief parse_value converts a decoded query value to an arithmetic type
+ * without allocating. Numbers are parsed with std::from_chars, so they have
+ * no leading '+' or whitespace, and must span all of s.
+ * @param s The decoded value.
+ * @param value The converted value, unchanged on error.
+ * @returns url_error_code::conversion_error if s isn't a T, or
+ * url_error_code::out_of_range if it doesn't fit in a T.
+ */
+template <typename T> error parse_value(std::string_view s, T* value) {
+    static_assert(std::is_arithmetic_v<T>, "query values convert to numbers");
+    if constexpr (std::is_same_v<T, bool>) {
+        return parse_bool(s, value);
+    } else {
+        const char* last = s.data() + s.length();
+        auto result = std::from_chars(s.data(), last, *value);
+        if (result.ec == std::errc::result_out_of_range) {
+            return error(url_error_code::out_of_range, 0, s);
+        }
+        if (result.ec != std::errc() || result.ptr != last) {
+            return error(url_error_code::conversion_error, 0, s);
+        }
+        return errors::no_error;
+    }
+}
+
+/**
+ * @brief decode_query decodes the key/value pairs of a raw query in the order
+ * they appear and passes each to emit. Decoding stops at the first error; the
+ * pairs emitted before a url_error_code::parse_error belong to a malformed
+ * query and are usually discarded.
+ * @param query The raw query.
+ * @param emit Called as emit(std::string key, std::string value).
+ * @returns error indicating an error while parsing if any.
+ */
+template <typename F> error decode_query(std::string_view query, F&& emit) {
+    const char* begin = query.data();
+
+    bool done = false;
+    while (!done) {
+        auto separator = query.find_first_of("&;");
+        auto pair = query.substr(0, separator);
+        if (separator == query.npos) {
+            done = true;
+        } else {
+            query.remove_prefix(separator + 1);
+        }
+
+        auto equals = pair.find('=');
+        if (pair.empty() || equals == pair.npos ||
+            pair.find('=', equals + 1) != pair.npos) {
+            return error(url_error_code::parse_error, pair.data() - begin,
+                         pair);
+        }
+
+        auto key =
+            unescape(pair.substr(0, equals), encoding::encodeQueryComponent);
+        if (!key) {
+            return key.error();
+        }
+
+        auto value =
+            unescape(pair.substr(equals + 1), encoding::encodeQueryComponent);
+        if (!value) {
+            return value.error();
+        }
+
+        emit(*std::move(key), *std::move(value));
+    }
+
+    return errors::no_error;
+}
 
 /**
  * @brief Takes a raw query and converts it to a multimap of the values.
  * @param query The raw query to be parsed.
- * @returns A multimap[key] = []{value1, value2, ...}.
- * @returns error indicating an error while parsing if any.
+ * @param limits The limits to enforce, see check_query_limits.
+ * @returns A multimap[key] = []{value1, value2, ...}, or the error while
+ * parsing if any.
  */
-std::tuple<query_map, error> parse_query(std::string_view query);
+result<query_map> parse_query(std::string_view query,
+                              const parse_limits& limits = {});
+
+namespace detail {
+
+// Elements of the pairs being serialized are either the pairs themselves or
+// pointers to them once sorted.
+template <typename P> const P& pair_of(const P& pair) { return pair; }
+template <typename P> const P& pair_of(const P* pair) { return *pair; }
+
+} // namespace detail
 
 /**
- * @brief Takes vector of key value pairs and build a query string.
+ * @brief query_length returns the exact length of the query built from key
+ * value pairs.
  * @param begin A const_iterator to the begining of the values.
  * @param end A const_iterator to the end of the values.
  */
-template <typename T> std::string build_query(T begin, T end) {
-    std::ostringstream buf;
+template <typename T> std::size_t query_length(T begin, T end) {
+    std::size_t length = 0;
+    std::size_t count = 0;
+    for (auto it = begin; it != end; ++it, ++count) {
+        const auto& pair = detail::pair_of(*it);
+        length += escaped_length(pair.first, encoding::encodeQueryComponent) +
+                  escaped_length(pair.second, encoding::encodeQueryComponent);
+    }
+    // An '=' per pair and a separator between pairs
+    return count == 0 ? 0 : length + 2 * count - 1;
+}
+
+/**
+ * @brief write_query writes the query built from key value pairs to out,
+ * which must have room for query_length(begin, end) bytes.
+ * @param begin A const_iterator to the begining of the values.
+ * @param end A const_iterator to the end of the values.
+ * @param separator The separator written between pairs.
+ * @param out The buffer the query is written to.
+ * @returns One past the last byte written.
+ */
+template <typename T>
+char* write_query(T begin, T end, char separator, char* out) {
     for (auto it = begin; it != end; ++it) {
-        auto key = escape(it->first, encoding::encodeQueryComponent);
-        auto value = escape(it->second, encoding::encodeQueryComponent);
-        buf << absl::StrCat(key, "=", value, "&");
+        const auto& pair = detail::pair_of(*it);
+        if (it != begin) {
+            *out++ = separator;
+        }
+        out = write_escaped(out, pair.first, encoding::encodeQueryComponent);
+        *out++ = '=';
+        out = write_escaped(out, pair.second, encoding::encodeQueryComponent);
+    }
+    return out;
+}
+
+namespace detail {
+
+template <typename T>
+void append_pairs(std::string* dest, T begin, T end, char separator) {
+    auto offset = dest->length();
+    dest->resize(offset + query_length(begin, end));
+    write_query(begin, end, separator, &(*dest)[0] + offset);
+}
+
+} // namespace detail
+
+/**
+ * @brief Takes key value pairs and appends the query string built from them
+ * to dest. dest is grown once to the exact size of the query.
+ * @param dest The string the query is appended to.
+ * @param begin A const_iterator to the begining of the values.
+ * @param end A const_iterator to the end of the values.
+ * @param format The separator and order of the pairs.
+ */
+template <typename T>
+void append_query(std::string* dest, T begin, T end,
+                  const query_format& format = {}) {
+    if (format.sorted) {
+        std::vector<const typename std::iterator_traits<T>::value_type*> pairs;
+        for (auto it = begin; it != end; ++it) {
+            pairs.push_back(&*it);
+        }
+        std::stable_sort(pairs.begin(), pairs.end(),
+                         [](const auto* a, const auto* b) {
+                             return a->first < b->first;
+                         });
+        detail::append_pairs(dest, pairs.cbegin(), pairs.cend(),
+                             format.separator);
+    } else {
+        detail::append_pairs(dest, begin, end, format.separator);
     }
+}
 
-    std::string retVal = buf.str();
-    // Remove the last &
-    retVal.pop_back();
+/**
+ * @brief Takes key value pairs and build a query string.
+ * @param begin A const_iterator to the begining of the values.
+ * @param end A const_iterator to the end of the values.
+ * @param format The separator and order of the pairs.
+ */
+template <typename T>
+std::string build_query(T begin, T end, const query_format& format = {}) {
+    std::string retVal;
+    append_query(&retVal, begin, end, format);
     return retVal;
 }
 
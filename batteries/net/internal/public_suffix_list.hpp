@@ -0,0 +1,38 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string_view>
+
+#include <absl/types/span.h>
+
+namespace batteries {
+
+namespace net {
+
+namespace internal {
+
+/**
+ * @brief vendored_public_suffix_list returns the rules and section markers
+ * of batteries/net/data/public_suffix_list.dat in chunks of whole lines. They
+ * are compiled into the library from GENERATED_public_suffix_list.cpp.
+ */
+absl::Span<const std::string_view> vendored_public_suffix_list();
+
+} // namespace internal
+
+} // namespace net
+
+} // namespace batteries
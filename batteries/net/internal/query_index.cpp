@@ -0,0 +1,214 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "query_index.hpp"
+
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <absl/numeric/bits.h>
+#include <absl/strings/ascii.h>
+
+#include "escape.hpp"
+
+namespace batteries {
+
+namespace net {
+
+namespace internal {
+
+namespace detail {
+
+constexpr std::size_t block_size = 16;
+
+inline bool is_structural(char c) {
+    return c == '&' || c == ';' || c == '=' || c == '%' || c == '+';
+}
+
+// A bit per byte of p[0, length) that is one of "&;=%+".
+inline uint32_t structural_mask(const char* p, std::size_t length) {
+#if defined(__SSE2__)
+    if (length == block_size) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i m = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('&')),
+                         _mm_cmpeq_epi8(v, _mm_set1_epi8(';'))),
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('=')),
+                                      _mm_cmpeq_epi8(v, _mm_set1_epi8('%'))),
+                         _mm_cmpeq_epi8(v, _mm_set1_epi8('+'))));
+        return static_cast<uint32_t>(_mm_movemask_epi8(m));
+    }
+#endif
+    uint32_t mask = 0;
+    for (std::size_t i = 0; i < length; i++) {
+        mask |= static_cast<uint32_t>(is_structural(p[i])) << i;
+    }
+    return mask;
+}
+
+// Checks the escape at query[i] the way unescape does for the component that
+// contains it. A component ends at '&', ';' or '='; a second '=' in a pair
+// is a parse error that takes precedence anyway.
+inline error check_escape(std::string_view query, std::size_t i) {
+    for (std::size_t j = i + 1; j <= i + 2; j++) {
+        if (j >= query.length() || query[j] == '&' || query[j] == ';' ||
+            query[j] == '=') {
+            return error(url_error_code::range_error, i, query.substr(i, 3));
+        }
+        if (!absl::ascii_isxdigit(query[j])) {
+            return error(url_error_code::escape_error, i, query.substr(i, 3));
+        }
+    }
+    return errors::no_error;
+}
+
+inline void decode_component(std::string_view component, bool escaped,
+                             std::string* out) {
+    if (escaped) {
+        *out = unescape(component, encoding::encodeQueryComponent)
+                   .value_or(std::string());
+    } else {
+        out->assign(component.data(), component.length());
+    }
+}
+
+} // namespace detail
+
+query_index::query_index()
+    : spans_() {}
+
+error query_index::build(std::string_view query) {
+    spans_.clear();
+    return index(query, 0);
+}
+
+error query_index::append(std::string_view query, std::size_t first) {
+    return index(query, first);
+}
+
+const std::vector<query_span>& query_index::spans() const { return spans_; }
+
+void query_index::clear() { spans_.clear(); }
+
+error query_index::index(std::string_view query, std::size_t first) {
+    if (query.length() > UINT32_MAX) {
+        return error(url_error_code::parse_error,
+                     errors::static_message{"query too long to index"});
+    }
+
+    auto indexed = spans_.size();
+    std::size_t pair = first;
+    std::size_t equals = query.npos;
+    bool malformed = false;
+    uint8_t flags = 0;
+    error escape_error;
+
+    // Errors are reported per pair in order, the structure of a pair before
+    // its escapes, like decode_query.
+    auto finish_pair = [&](std::size_t end) {
+        if (end == pair || equals == query.npos || malformed) {
+            return error(url_error_code::parse_error, pair,
+                         query.substr(pair, end - pair));
+        }
+        if (escape_error) {
+            return escape_error;
+        }
+        spans_.push_back(query_span{static_cast<uint32_t>(pair),
+                                    static_cast<uint32_t>(equals),
+                                    static_cast<uint32_t>(end), flags});
+        pair = end + 1;
+        equals = query.npos;
+        flags = 0;
+        return errors::no_error;
+    };
+
+    for (std::size_t block = first; block < query.length();
+         block += detail::block_size) {
+        auto length = std::min(detail::block_size, query.length() - block);
+        auto mask = detail::structural_mask(query.data() + block, length);
+        while (mask != 0) {
+            auto i = block + absl::countr_zero(mask);
+            mask &= mask - 1;
+
+            switch (query[i]) {
+            case '&':
+            case ';': {
+                auto err = finish_pair(i);
+                if (err) {
+                    spans_.resize(indexed);
+                    return err;
+                }
+                break;
+            }
+            case '=':
+                if (equals == query.npos) {
+                    equals = i;
+                } else {
+                    malformed = true;
+                }
+                break;
+            case '%':
+                if (!escape_error) {
+                    escape_error = detail::check_escape(query, i);
+                }
+                [[fallthrough]];
+            case '+':
+                flags |= equals == query.npos ? query_span::key_escaped
+                                              : query_span::value_escaped;
+                break;
+            }
+        }
+    }
+
+    auto err = finish_pair(query.length());
+    if (err) {
+        spans_.resize(indexed);
+    }
+    return err;
+}
+
+void decode_spans(std::string_view query, absl::Span<const query_span> spans,
+                  query_value* values) {
+    for (std::size_t i = 0; i < spans.size(); i++) {
+        const auto& span = spans[i];
+        detail::decode_component(
+            query.substr(span.key, span.equals - span.key),
+            span.flags & query_span::key_escaped, &values[i].first);
+        detail::decode_component(
+            query.substr(span.equals + 1, span.end - span.equals - 1),
+            span.flags & query_span::value_escaped, &values[i].second);
+    }
+}
+
+void decode_spans(std::string_view query, absl::Span<const query_span> spans,
+                  query_value* values, const executor& run,
+                  std::size_t chunks) {
+    chunks = std::max<std::size_t>(1, std::min(chunks, spans.size()));
+    std::size_t size = (spans.size() + chunks - 1) / chunks;
+    run(chunks, [&](std::size_t chunk) {
+        auto first = std::min(chunk * size, spans.size());
+        auto last = std::min(first + size, spans.size());
+        decode_spans(query, spans.subspan(first, last - first),
+                     values + first);
+    });
+}
+
+} // namespace internal
+
+} // namespace net
+
+} // namespace batteries
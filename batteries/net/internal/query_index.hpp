@@ -0,0 +1,129 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include "batteries/net/base.hpp"
+#include "escape.hpp"
+
+namespace batteries {
+
+namespace net {
+
+namespace internal {
+
+// Queries at least this long are indexed before they are decoded
+constexpr std::size_t query_index_min_length = 1024;
+
+// Indexed queries with at least this many pairs are decoded in parallel by
+// query::decode with an executor
+constexpr std::size_t parallel_decode_min_pairs = 4096;
+
+/**
+ * A query_span locates a key=value pair in a raw query by offsets.
+ */
+struct query_span {
+    enum flags : uint8_t {
+        // The key contains '%' or '+'
+        key_escaped = 1 << 0,
+        // The value contains '%' or '+'
+        value_escaped = 1 << 1,
+    };
+
+    // The first byte of the key
+    uint32_t key;
+    // The '=' between the key and the value
+    uint32_t equals;
+    // One past the last byte of the value
+    uint32_t end;
+    uint8_t flags;
+};
+
+/**
+ * A query_index is the structure of a raw query: the span of every pair and
+ * which of their keys and values need unescaping. It is built in a single
+ * pass that compares 16 bytes at a time against the structural characters
+ * "&;=%+" and then visits only the bytes that matched, so building it costs
+ * little more than reading the query once.
+ */
+class query_index {
+
+  public:
+    query_index();
+
+    /**
+     * @brief build indexes a raw query and validates it like validate_query.
+     * @param query The raw query, at most 4 GiB.
+     * @returns The error validate_query would return. The index is empty on
+     * error.
+     */
+    error build(std::string_view query);
+
+    /**
+     * @brief append indexes pairs appended to an indexed query.
+     * @param query The raw query including the appended pairs.
+     * @param first The first byte of the appended pairs.
+     * @returns The error validate_query would return for the appended pairs.
+     * The index is unchanged on error.
+     */
+    error append(std::string_view query, std::size_t first);
+
+    /**
+     * @brief spans returns the pairs of the query in order.
+     */
+    const std::vector<query_span>& spans() const;
+
+    /**
+     * @brief clear empties the index, keeping its storage.
+     */
+    void clear();
+
+  private:
+    // Indexes the pairs of query from first on.
+    error index(std::string_view query, std::size_t first);
+
+  private:
+    std::vector<query_span> spans_;
+};
+
+/**
+ * @brief decode_spans decodes indexed pairs of a valid query.
+ * @param query The raw query that was indexed.
+ * @param spans The spans of the pairs to decode.
+ * @param values The decoded pairs, one per span.
+ */
+void decode_spans(std::string_view query, absl::Span<const query_span> spans,
+                  query_value* values);
+
+/**
+ * @brief decode_spans decodes indexed pairs of a valid query in chunks of
+ * consecutive pairs, each decoded by a task of run.
+ * @param run The executor that runs the chunks.
+ * @param chunks The number of chunks to split spans into.
+ */
+void decode_spans(std::string_view query, absl::Span<const query_span> spans,
+                  query_value* values, const executor& run,
+                  std::size_t chunks);
+
+} // namespace internal
+
+} // namespace net
+
+} // namespace batteries
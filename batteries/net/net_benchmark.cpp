@@ -0,0 +1,194 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Throughput benchmarks of the net library. They aren't tests: build the
+// net_benchmark target optimized and compare its output before and after a
+// change.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+
+#include "query.hpp"
+#include "url.hpp"
+#include "validate.hpp"
+
+namespace {
+
+// Keeps the results of the benchmarked calls alive
+volatile std::size_t sink = 0;
+
+// Calls op for at least a quarter of a second and prints the time of a call
+// and the throughput over bytes, the input of a single call.
+template <typename Op>
+void run(const char* name, std::size_t bytes, Op op) {
+    using clock = std::chrono::steady_clock;
+    std::size_t calls = 0;
+    std::size_t results = 0;
+    auto start = clock::now();
+    std::chrono::duration<double> elapsed{};
+    do {
+        for (int i = 0; i < 8; i++) {
+            results += op();
+        }
+        calls += 8;
+        elapsed = clock::now() - start;
+    } while (elapsed < std::chrono::milliseconds(250));
+    sink = sink + results;
+
+    double seconds = elapsed.count() / calls;
+    std::printf("%-40s %12.1f ns/call %10.1f MB/s\n", name, seconds * 1e9,
+                bytes / seconds / 1e6);
+}
+
+// URLs like those of a request log. Every escaped_every-th URL has an escape
+// and is validated by url::parse.
+std::vector<std::string> make_urls(std::size_t count,
+                                   std::size_t escaped_every) {
+    std::vector<std::string> urls;
+    for (std::size_t i = 0; i < count; i++) {
+        urls.push_back(absl::StrCat(
+            "https://www.example.com/catalog/item/", i,
+            escaped_every != 0 && i % escaped_every == 0 ? "%20" : "",
+            "?id=", i * 7919, "&lang=en&ref=search#reviews"));
+    }
+    return urls;
+}
+
+std::size_t total_length(const std::vector<std::string_view>& views) {
+    std::size_t length = 0;
+    for (auto view : views) {
+        length += view.length();
+    }
+    return length;
+}
+
+void validate_benchmarks() {
+    for (std::size_t escaped_every : {0, 8}) {
+        auto urls = make_urls(1024, escaped_every);
+        std::vector<std::string_view> views(urls.begin(), urls.end());
+        std::vector<std::error_code> results(views.size());
+        auto bytes = total_length(views);
+        const char* suffix = escaped_every == 0 ? "plain" : "mixed";
+
+        run(absl::StrCat("url::parse/", suffix).c_str(), bytes, [&] {
+            std::size_t invalid = 0;
+            batteries::net::url url;
+            for (auto view : views) {
+                invalid += static_cast<bool>(url.parse(view));
+            }
+            return invalid;
+        });
+        run(absl::StrCat("validate/", suffix).c_str(), bytes, [&] {
+            std::size_t invalid = 0;
+            for (auto view : views) {
+                invalid += static_cast<bool>(batteries::net::validate(view));
+            }
+            return invalid;
+        });
+        run(absl::StrCat("validate_batch/", suffix).c_str(), bytes, [&] {
+            return batteries::net::validate_batch(views,
+                                                  absl::MakeSpan(results));
+        });
+    }
+}
+
+// A parsed query of count pairs like "k0=v0&k1=v1".
+std::string make_query(std::size_t count) {
+    std::string raw;
+    for (std::size_t i = 0; i < count; i++) {
+        absl::StrAppend(&raw, i == 0 ? "" : "&", "k", i, "=v", i);
+    }
+    return raw;
+}
+
+void append_benchmarks() {
+    // The cost of add should stay flat as the query grows, while set
+    // re-serializes the whole query
+    for (std::size_t count : {16, 1024, 65536}) {
+        auto raw = make_query(count);
+        batteries::net::query base(raw);
+        base.raw_query();
+
+        // The query is restored every 4096 adds, a copy amortized over them
+        batteries::net::query query = base;
+        std::size_t added = 0;
+        run(absl::StrCat("query::add+raw_query/", count).c_str(), 6, [&] {
+            if (++added == 4096) {
+                query = base;
+                added = 0;
+            }
+            query.add("sig", "1");
+            return query.raw_query().length();
+        });
+
+        batteries::net::query rebuilt = base;
+        run(absl::StrCat("query::set+raw_query/", count).c_str(),
+            raw.length(), [&] {
+                rebuilt.set("k0", "1");
+                return rebuilt.raw_query().length();
+            });
+    }
+}
+
+void limit_benchmarks() {
+    // An adversarial query of 100000 parameters: the cost of a rejected parse
+    // should depend on the limit, not on the size of the query
+    auto hostile = make_query(100000);
+    batteries::net::parse_limits unlimited;
+    batteries::net::parse_limits limited;
+    limited.max_params = 1000;
+
+    // Parsed and decoded, as a handler that looks at the parameters does
+    batteries::net::query query;
+    run("query::parse+size/hostile/unlimited", hostile.length(), [&] {
+        query.parse(hostile, unlimited);
+        return query.size();
+    });
+    run("query::parse+size/hostile/max_params=1000", hostile.length(), [&] {
+        query.parse(hostile, limited);
+        return query.size();
+    });
+
+    auto rawurl = absl::StrCat("https://www.example.com/search?", hostile);
+    batteries::net::url url;
+    run("url::parse/hostile/unlimited", rawurl.length(), [&] {
+        return static_cast<std::size_t>(
+            static_cast<bool>(url.parse(rawurl, unlimited)));
+    });
+    run("url::parse/hostile/max_params=1000", rawurl.length(), [&] {
+        return static_cast<std::size_t>(
+            static_cast<bool>(url.parse(rawurl, limited)));
+    });
+    // The rest of the url is still scanned once, unless it is too long
+    batteries::net::parse_limits short_urls;
+    short_urls.max_length = 8192;
+    run("url::parse/hostile/max_length=8192", rawurl.length(), [&] {
+        return static_cast<std::size_t>(
+            static_cast<bool>(url.parse(rawurl, short_urls)));
+    });
+}
+
+} // namespace
+
+int main() {
+    validate_benchmarks();
+    append_benchmarks();
+    limit_benchmarks();
+    return 0;
+}
@@ -0,0 +1,154 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "path_segments.hpp"
+
+#include <absl/strings/match.h>
+
+#include "internal/escape.hpp"
+
+namespace batteries {
+
+namespace net {
+
+path_segment::path_segment()
+    : raw_() {}
+
+path_segment::path_segment(std::string_view raw)
+    : raw_(raw) {}
+
+std::string_view path_segment::raw() const { return raw_; }
+
+std::tuple<std::string, error> path_segment::unescape() const {
+    return internal::unescape(raw_, internal::encoding::encodePathSegment)
+        .to_tuple();
+}
+
+bool path_segment::is_dot() const {
+    return raw_ == "." || absl::EqualsIgnoreCase(raw_, "%2e");
+}
+
+bool path_segment::is_dot_dot() const {
+    return raw_ == ".." || absl::EqualsIgnoreCase(raw_, ".%2e") ||
+           absl::EqualsIgnoreCase(raw_, "%2e.") ||
+           absl::EqualsIgnoreCase(raw_, "%2e%2e");
+}
+
+bool path_segment::empty() const { return raw_.empty(); }
+
+bool path_segment::operator==(const path_segment& rhs) const {
+    return raw_ == rhs.raw_;
+}
+
+bool path_segment::operator!=(const path_segment& rhs) const {
+    return !(*this == rhs);
+}
+
+path_segments::iterator::iterator()
+    : path_()
+    , first_(1)
+    , last_(0) {}
+
+path_segments::iterator::iterator(std::string_view path, std::size_t first,
+                                  std::size_t last)
+    : path_(path)
+    , first_(first)
+    , last_(last) {}
+
+path_segment path_segments::iterator::operator*() const {
+    return path_segment(path_.substr(first_, last_ - first_));
+}
+
+path_segments::iterator& path_segments::iterator::operator++() {
+    first_ = last_ + 1;
+    if (first_ > path_.length()) {
+        // Past the last segment
+        first_ = path_.length() + 1;
+        last_ = first_;
+        return *this;
+    }
+    last_ = path_.find('/', first_);
+    if (last_ == path_.npos) {
+        last_ = path_.length();
+    }
+    return *this;
+}
+
+path_segments::iterator path_segments::iterator::operator++(int) {
+    auto retVal = *this;
+    ++*this;
+    return retVal;
+}
+
+path_segments::iterator& path_segments::iterator::operator--() {
+    // The previous segment ends at the '/' before this one or, for the end
+    // iterator, at the end of the path.
+    last_ = (first_ > path_.length()) ? path_.length() : first_ - 1;
+    if (last_ == 0) {
+        first_ = 0;
+        return *this;
+    }
+    auto slash = path_.rfind('/', last_ - 1);
+    first_ = (slash == path_.npos) ? 0 : slash + 1;
+    return *this;
+}
+
+path_segments::iterator path_segments::iterator::operator--(int) {
+    auto retVal = *this;
+    --*this;
+    return retVal;
+}
+
+bool path_segments::iterator::operator==(const iterator& rhs) const {
+    return path_.data() == rhs.path_.data() && first_ == rhs.first_;
+}
+
+bool path_segments::iterator::operator!=(const iterator& rhs) const {
+    return !(*this == rhs);
+}
+
+path_segments::path_segments(std::string_view escaped_path)
+    : path_(escaped_path)
+    , empty_(escaped_path.empty()) {
+    // The leading '/' of an absolute path doesn't start a segment.
+    if (absl::StartsWith(path_, "/")) {
+        path_.remove_prefix(1);
+    }
+}
+
+path_segments::iterator path_segments::begin() const {
+    if (empty_) {
+        return end();
+    }
+    auto last = path_.find('/');
+    return iterator(path_, 0, last == path_.npos ? path_.length() : last);
+}
+
+path_segments::iterator path_segments::end() const {
+    return iterator(path_, path_.length() + 1, path_.length() + 1);
+}
+
+path_segments::reverse_iterator path_segments::rbegin() const {
+    return reverse_iterator(end());
+}
+
+path_segments::reverse_iterator path_segments::rend() const {
+    return reverse_iterator(begin());
+}
+
+bool path_segments::empty() const { return empty_; }
+
+} // namespace net
+
+} // namespace batteries
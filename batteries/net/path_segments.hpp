@@ -0,0 +1,138 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include "base.hpp"
+
+namespace batteries {
+
+namespace net {
+
+/**
+ * A path_segment is a view of a single escaped segment of a URL path. The
+ * segment is only decoded when unescape is called, so an escaped '/' (%2F)
+ * stays part of the segment it appears in.
+ */
+class path_segment {
+
+  public:
+    path_segment();
+    explicit path_segment(std::string_view raw);
+
+    /**
+     * @brief raw returns the escaped segment.
+     * @returns The segment as it appears in the escaped path.
+     */
+    std::string_view raw() const;
+
+    /**
+     * @brief unescape decodes the segment.
+     * @returns The decoded segment and an error if any.
+     */
+    std::tuple<std::string, error> unescape() const;
+
+    /**
+     * @brief is_dot reports whether the segment is the dot-segment ".",
+     * including its escaped form "%2E".
+     */
+    bool is_dot() const;
+
+    /**
+     * @brief is_dot_dot reports whether the segment is the dot-segment "..",
+     * including escaped forms such as ".%2E".
+     */
+    bool is_dot_dot() const;
+
+    bool empty() const;
+
+    bool operator==(const path_segment& rhs) const;
+    bool operator!=(const path_segment& rhs) const;
+
+  private:
+    std::string_view raw_;
+};
+
+/**
+ * A path_segments is a range over the segments of an escaped URL path split
+ * on '/'. The leading '/' of an absolute path does not produce a segment, a
+ * trailing '/' produces an empty last segment. For example "/a/b%2Fc/" has
+ * the segments "a", "b%2Fc" and "". No memory is allocated; the range is
+ * valid as long as the path it was created from.
+ */
+class path_segments {
+
+  public:
+    class iterator {
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = path_segment;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = path_segment;
+
+        iterator();
+
+        path_segment operator*() const;
+
+        iterator& operator++();
+        iterator operator++(int);
+        iterator& operator--();
+        iterator operator--(int);
+
+        bool operator==(const iterator& rhs) const;
+        bool operator!=(const iterator& rhs) const;
+
+      private:
+        friend class path_segments;
+        iterator(std::string_view path, std::size_t first, std::size_t last);
+
+      private:
+        std::string_view path_;
+        // [first_, last_) is the current segment, first_ is path_.size() + 1
+        // for the end iterator.
+        std::size_t first_;
+        std::size_t last_;
+    };
+
+    using const_iterator = iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    /**
+     * @brief Initializes a range over the segments of an escaped path.
+     * @param escaped_path The path in escaped form, e.g. url::escaped_path().
+     */
+    explicit path_segments(std::string_view escaped_path);
+
+    iterator begin() const;
+    iterator end() const;
+    reverse_iterator rbegin() const;
+    reverse_iterator rend() const;
+
+    bool empty() const;
+
+  private:
+    std::string_view path_;
+    bool empty_;
+};
+
+} // namespace net
+
+} // namespace batteries
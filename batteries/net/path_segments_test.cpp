@@ -0,0 +1,111 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "path_segments.hpp"
+#include "url.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using batteries::net::path_segment;
+using batteries::net::path_segments;
+
+struct PathSegmentsTest {
+    std::string path;
+    std::vector<std::string_view> segments;
+};
+
+std::ostream& operator<<(std::ostream& os, const PathSegmentsTest& pst) {
+    return os << "path: " << pst.path;
+}
+
+class MultiplePathSegmentsTests
+    : public ::testing::TestWithParam<PathSegmentsTest> {};
+
+TEST_P(MultiplePathSegmentsTests, Forward) {
+    std::vector<std::string_view> segments;
+    for (auto segment : path_segments(GetParam().path)) {
+        segments.push_back(segment.raw());
+    }
+    EXPECT_EQ(GetParam().segments, segments);
+}
+
+TEST_P(MultiplePathSegmentsTests, Reverse) {
+    path_segments range(GetParam().path);
+    std::vector<std::string_view> segments;
+    for (auto it = range.rbegin(); it != range.rend(); ++it) {
+        segments.insert(segments.begin(), (*it).raw());
+    }
+    EXPECT_EQ(GetParam().segments, segments);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    PathSegmentsTest, MultiplePathSegmentsTests,
+    ::testing::Values(
+        PathSegmentsTest{"", {}}, PathSegmentsTest{"/", {""}},
+        PathSegmentsTest{"a", {"a"}}, PathSegmentsTest{"/a", {"a"}},
+        PathSegmentsTest{"/a/b", {"a", "b"}},
+        PathSegmentsTest{"/a/b/", {"a", "b", ""}},
+        PathSegmentsTest{"//a", {"", "a"}},
+        PathSegmentsTest{"a/b%2Fc/d", {"a", "b%2Fc", "d"}},
+        PathSegmentsTest{"/./../x", {".", "..", "x"}}));
+
+TEST(PathSegment, Unescape) {
+    std::string decoded;
+    batteries::net::error err;
+    std::tie(decoded, err) = path_segment("b%2Fc%20d").unescape();
+    EXPECT_EQ(err, batteries::errors::no_error);
+    EXPECT_EQ(decoded, "b/c d");
+
+    std::tie(decoded, err) = path_segment("b%2").unescape();
+    EXPECT_TRUE(err);
+}
+
+TEST(PathSegment, DotSegments) {
+    EXPECT_TRUE(path_segment(".").is_dot());
+    EXPECT_TRUE(path_segment("%2E").is_dot());
+    EXPECT_FALSE(path_segment("..").is_dot());
+    EXPECT_TRUE(path_segment("..").is_dot_dot());
+    EXPECT_TRUE(path_segment(".%2e").is_dot_dot());
+    EXPECT_TRUE(path_segment("%2E%2E").is_dot_dot());
+    EXPECT_FALSE(path_segment("...").is_dot_dot());
+    EXPECT_FALSE(path_segment("a").is_dot());
+}
+
+TEST(PathSegment, UrlKeepsEscapedSlash) {
+    batteries::net::url url("http://foo.com/files/a%2Fb/c");
+    EXPECT_EQ(url.path(), "/files/a/b/c");
+    EXPECT_EQ(url.raw_path(), "/files/a%2Fb/c");
+
+    std::vector<std::string_view> segments;
+    for (auto segment : url.path_segments()) {
+        segments.push_back(segment.raw());
+    }
+    EXPECT_THAT(segments, ::testing::ElementsAre("files", "a%2Fb", "c"));
+}
+
+TEST(PathSegment, UrlWithoutRawPath) {
+    batteries::net::url url("http://foo.com/path/to/file");
+    EXPECT_EQ(url.raw_path(), "");
+
+    std::vector<std::string_view> segments;
+    for (auto segment : url.path_segments()) {
+        segments.push_back(segment.raw());
+    }
+    EXPECT_THAT(segments, ::testing::ElementsAre("path", "to", "file"));
+}
+
+} // namespace
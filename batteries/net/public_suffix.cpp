@@ -0,0 +1,438 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "public_suffix.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <absl/strings/ascii.h>
+#include <absl/strings/match.h>
+
+#include "internal/public_suffix_list.hpp"
+
+namespace batteries {
+
+namespace net {
+
+namespace detail {
+
+// The flags of the nodes of the trie. Rules of the private section are kept
+// apart so they can be ignored at lookup time.
+enum suffix_flags : uint8_t {
+    icann_rule = 1 << 0,
+    icann_exception = 1 << 1,
+    private_rule = 1 << 2,
+    private_exception = 1 << 3,
+};
+
+// The position in name of the first of its last n labels, npos if name has
+// fewer labels.
+inline std::size_t labels_begin(std::string_view name, std::size_t n) {
+    std::size_t end = name.length();
+    std::size_t begin = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        if (end == name.npos) {
+            return name.npos;
+        }
+        auto label = internal::next_label(name, end);
+        begin = label.data() - name.data();
+    }
+    return begin;
+}
+
+inline bool is_numeric(std::string_view label) {
+    return !label.empty() && std::all_of(label.begin(), label.end(), [](char c) {
+        return absl::ascii_isdigit(c);
+    });
+}
+
+// Decodes the UTF-8 label into code points. Returns false if the label is not
+// valid UTF-8.
+static bool decode_utf8(std::string_view label, std::vector<uint32_t>& out) {
+    out.clear();
+    for (std::size_t i = 0; i < label.length();) {
+        auto lead = static_cast<uint8_t>(label[i]);
+        std::size_t n;
+        uint32_t cp;
+        if (lead < 0x80) {
+            n = 0;
+            cp = lead;
+        } else if (lead >= 0xc2 && lead < 0xe0) {
+            n = 1;
+            cp = lead & 0x1f;
+        } else if (lead >= 0xe0 && lead < 0xf0) {
+            n = 2;
+            cp = lead & 0x0f;
+        } else if (lead >= 0xf0 && lead < 0xf5) {
+            n = 3;
+            cp = lead & 0x07;
+        } else {
+            return false;
+        }
+        if (label.length() - i <= n) {
+            return false;
+        }
+        for (std::size_t j = 1; j <= n; j++) {
+            auto next = static_cast<uint8_t>(label[i + j]);
+            if ((next & 0xc0) != 0x80) {
+                return false;
+            }
+            cp = (cp << 6) | (next & 0x3f);
+        }
+        out.push_back(cp);
+        i += n + 1;
+    }
+    return true;
+}
+
+// The parameters of Punycode, RFC 3492 section 5
+constexpr uint32_t punycode_base = 36;
+constexpr uint32_t punycode_tmin = 1;
+constexpr uint32_t punycode_tmax = 26;
+constexpr uint32_t punycode_skew = 38;
+constexpr uint32_t punycode_damp = 700;
+constexpr uint32_t punycode_initial_bias = 72;
+constexpr uint32_t punycode_initial_n = 128;
+
+static uint32_t punycode_adapt(uint32_t delta, uint32_t points, bool first) {
+    delta = first ? delta / punycode_damp : delta / 2;
+    delta += delta / points;
+    uint32_t k = 0;
+    while (delta > ((punycode_base - punycode_tmin) * punycode_tmax) / 2) {
+        delta /= punycode_base - punycode_tmin;
+        k += punycode_base;
+    }
+    return k + (punycode_base - punycode_tmin + 1) * delta /
+                   (delta + punycode_skew);
+}
+
+static char punycode_digit(uint32_t d) {
+    return static_cast<char>(d < 26 ? 'a' + d : '0' + (d - 26));
+}
+
+// Appends the Punycode encoding of the code points, RFC 3492 section 6.3.
+static void encode_punycode(const std::vector<uint32_t>& input,
+                            std::string& out) {
+    uint32_t basic = 0;
+    for (auto cp : input) {
+        if (cp < 0x80) {
+            out.push_back(static_cast<char>(cp));
+            basic++;
+        }
+    }
+    if (basic > 0) {
+        out.push_back('-');
+    }
+
+    uint32_t n = punycode_initial_n;
+    uint32_t delta = 0;
+    uint32_t bias = punycode_initial_bias;
+    for (uint32_t h = basic; h < input.size(); delta++, n++) {
+        uint32_t m = UINT32_MAX;
+        for (auto cp : input) {
+            if (cp >= n) {
+                m = std::min(m, cp);
+            }
+        }
+        delta += (m - n) * (h + 1);
+        n = m;
+        for (auto cp : input) {
+            if (cp < n) {
+                delta++;
+            }
+            if (cp != n) {
+                continue;
+            }
+            auto q = delta;
+            for (uint32_t k = punycode_base;; k += punycode_base) {
+                uint32_t t = k <= bias ? punycode_tmin
+                             : k >= bias + punycode_tmax
+                                 ? punycode_tmax
+                                 : k - bias;
+                if (q < t) {
+                    break;
+                }
+                out.push_back(
+                    punycode_digit(t + (q - t) % (punycode_base - t)));
+                q = (q - t) / (punycode_base - t);
+            }
+            out.push_back(punycode_digit(q));
+            bias = punycode_adapt(delta, h + 1, h == basic);
+            delta = 0;
+            h++;
+        }
+    }
+}
+
+// Converts the labels of rule that are not ASCII to A-labels like
+// "xn--55qx5d". Rules of the list are already mapped to lower case, so only
+// the Punycode step of IDNA ToASCII is needed. Returns false if the rule is
+// not valid UTF-8.
+static bool to_ascii(std::string_view rule, std::string& out) {
+    std::vector<uint32_t> code_points;
+    out.clear();
+    while (true) {
+        auto dot = rule.find('.');
+        auto label = rule.substr(0, dot);
+        if (std::all_of(label.begin(), label.end(),
+                        [](char c) { return absl::ascii_isascii(c); })) {
+            out.append(label.data(), label.length());
+        } else {
+            if (!decode_utf8(label, code_points)) {
+                return false;
+            }
+            out.append("xn--");
+            encode_punycode(code_points, out);
+        }
+        if (dot == rule.npos) {
+            return true;
+        }
+        out.push_back('.');
+        rule.remove_prefix(dot + 1);
+    }
+}
+
+// Adds the rules of the whole lines of list to builder. Rules with labels
+// that are not ASCII are added in both their Unicode and A-label forms, so
+// size counts rules rather than names. in_private carries the section from
+// one part of a list to the next.
+static void load_rules(std::string_view list,
+                       internal::label_trie::builder& builder,
+                       std::size_t& size,
+                       bool& in_private) {
+    std::string a_label;
+    while (!list.empty()) {
+        auto eol = list.find('\n');
+        auto line = list.substr(0, eol);
+        list = eol == list.npos ? std::string_view() : list.substr(eol + 1);
+
+        if (absl::StartsWith(line, "//")) {
+            if (absl::StrContains(line, "===BEGIN PRIVATE DOMAINS===")) {
+                in_private = true;
+            } else if (absl::StrContains(line, "===END PRIVATE DOMAINS===")) {
+                in_private = false;
+            }
+            continue;
+        }
+
+        // A rule ends at the first whitespace
+        auto rule = line.substr(0, line.find_first_of(" \t\r"));
+        if (rule.empty()) {
+            continue;
+        }
+
+        uint8_t flags = in_private ? private_rule : icann_rule;
+        if (rule[0] == '!') {
+            rule.remove_prefix(1);
+            flags = in_private ? private_exception : icann_exception;
+        }
+        builder.insert(rule, flags);
+        if (to_ascii(rule, a_label) && a_label != rule) {
+            builder.insert(a_label, flags);
+        }
+        size++;
+    }
+}
+
+} // namespace detail
+
+public_suffix::public_suffix()
+    : trie_()
+    , size_(0) {}
+
+const public_suffix& public_suffix::default_list() {
+    static const public_suffix list = [] {
+        internal::label_trie::builder builder;
+        std::size_t size = 0;
+        bool in_private = false;
+        for (auto part : internal::vendored_public_suffix_list()) {
+            detail::load_rules(part, builder, size, in_private);
+        }
+
+        public_suffix rules;
+        rules.trie_ = builder.build();
+        rules.size_ = size;
+        return rules;
+    }();
+    return list;
+}
+
+error public_suffix::load(std::string_view list) {
+    internal::label_trie::builder builder;
+    std::size_t size = 0;
+    bool in_private = false;
+    detail::load_rules(list, builder, size, in_private);
+
+    if (size == 0) {
+        return error(make_error_code(url_error_code::parse_error),
+                     "public suffix list contains no rules");
+    }
+
+    trie_ = builder.build();
+    size_ = size;
+    return errors::no_error;
+}
+
+error public_suffix::load_file(const std::string& path) {
+#if defined(_WIN32)
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return error(std::error_code(errno, std::generic_category()), path);
+    }
+    std::string list((std::istreambuf_iterator<char>(in)),
+                     std::istreambuf_iterator<char>());
+    return load(list);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return error(std::error_code(errno, std::generic_category()), path);
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        auto err = error(std::error_code(errno, std::generic_category()), path);
+        ::close(fd);
+        return err;
+    }
+
+    auto length = static_cast<std::size_t>(st.st_size);
+    if (length == 0) {
+        ::close(fd);
+        return load(std::string_view());
+    }
+
+    void* data = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return error(std::error_code(errno, std::generic_category()), path);
+    }
+
+    auto err = load(std::string_view(static_cast<const char*>(data), length));
+    ::munmap(data, length);
+    return err;
+#endif
+}
+
+std::string_view public_suffix::suffix(std::string_view hostname,
+                                       bool include_private) const {
+    auto n = suffix_labels(hostname, include_private);
+    if (n == 0) {
+        return {};
+    }
+    if (absl::EndsWith(hostname, ".")) {
+        hostname.remove_suffix(1);
+    }
+    return hostname.substr(detail::labels_begin(hostname, n));
+}
+
+std::string_view public_suffix::registrable_domain(std::string_view hostname,
+                                                   bool include_private) const {
+    auto n = suffix_labels(hostname, include_private);
+    if (n == 0) {
+        return {};
+    }
+    if (absl::EndsWith(hostname, ".")) {
+        hostname.remove_suffix(1);
+    }
+    auto begin = detail::labels_begin(hostname, n + 1);
+    if (begin == hostname.npos) {
+        return {};
+    }
+    return hostname.substr(begin);
+}
+
+bool public_suffix::empty() const { return size_ == 0; }
+
+std::size_t public_suffix::size() const { return size_; }
+
+std::size_t public_suffix::suffix_labels(std::string_view hostname,
+                                         bool include_private) const {
+    if (absl::EndsWith(hostname, ".")) {
+        hostname.remove_suffix(1);
+    }
+    // IPv6 addresses and zones
+    if (hostname.empty() || hostname.find(':') != hostname.npos) {
+        return 0;
+    }
+
+    uint8_t rule_mask = detail::icann_rule;
+    uint8_t exception_mask = detail::icann_exception;
+    if (include_private) {
+        rule_mask |= detail::private_rule;
+        exception_mask |= detail::private_exception;
+    }
+
+    // The implicit "*" rule
+    std::size_t match = 1;
+    std::size_t depth = 0;
+    bool exception = false;
+    auto node = internal::label_trie::root;
+
+    std::size_t end = hostname.length();
+    while (end != hostname.npos) {
+        auto label = internal::next_label(hostname, end);
+        if (label.empty()) {
+            return 0;
+        }
+        // IPv4 addresses, no top-level domain is numeric
+        if (depth == 0 && detail::is_numeric(label)) {
+            return 0;
+        }
+        depth++;
+
+        // Keep looking for empty labels once the trie has no match
+        if (exception || node == internal::label_trie::npos) {
+            continue;
+        }
+
+        auto wildcard = trie_.find_child(node, "*");
+        if (wildcard != internal::label_trie::npos &&
+            (trie_.flags(wildcard) & rule_mask)) {
+            match = std::max(match, depth);
+        }
+
+        node = trie_.find_child(node, label);
+        if (node == internal::label_trie::npos) {
+            continue;
+        }
+        auto flags = trie_.flags(node);
+        // Exception rules take priority over every other rule
+        if (flags & exception_mask) {
+            match = depth - 1;
+            exception = true;
+        } else if (flags & rule_mask) {
+            match = std::max(match, depth);
+        }
+    }
+
+    return match;
+}
+
+} // namespace net
+
+} // namespace batteries
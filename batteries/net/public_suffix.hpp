@@ -0,0 +1,116 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "base.hpp"
+#include "internal/label_trie.hpp"
+
+namespace batteries {
+
+namespace net {
+
+/**
+ * A public_suffix answers Public Suffix List (https://publicsuffix.org)
+ * queries. The rules are compiled into a trie of reversed labels when the list
+ * is loaded, so a lookup is one binary search per label of the hostname and
+ * never allocates. Internationalized rules are added both as written and as
+ * A-labels, so they match hostnames in Unicode and in Punycode.
+ *
+ * The list is vendored in batteries/net/data, see the README there for its
+ * version, and compiled into the library from a generated source;
+ * default_list returns it compiled. Users that track the upstream list load a newer copy
+ * with load_file. A loaded public_suffix is immutable and may be shared
+ * between threads.
+ */
+class public_suffix {
+
+  public:
+    public_suffix();
+
+    /**
+     * @brief default_list returns the rules of the vendored list, compiled
+     * on first use.
+     */
+    static const public_suffix& default_list();
+
+    /**
+     * @brief load compiles the rules of a list in the Public Suffix List
+     * format and replaces the current rules.
+     * @param list The contents of the list.
+     * @returns An error if the list contains no rules.
+     */
+    error load(std::string_view list);
+
+    /**
+     * @brief load_file memory maps a list and compiles it. The current rules
+     * are kept if the file can't be read.
+     * @param path The path of the list.
+     * @returns An error if the file can't be read or contains no rules.
+     */
+    error load_file(const std::string& path);
+
+    /**
+     * @brief suffix returns the public suffix of hostname, such as "co.uk"
+     * for "www.example.co.uk". A hostname that matches no rule has its last
+     * label as its suffix.
+     * @param hostname The hostname, as returned by url::hostname(). A single
+     * trailing dot is ignored.
+     * @param include_private Whether the rules of the private section apply.
+     * @returns A view into hostname, empty if hostname is an IP address or
+     * has empty labels.
+     */
+    std::string_view suffix(std::string_view hostname,
+                            bool include_private = true) const;
+
+    /**
+     * @brief registrable_domain returns the public suffix of hostname plus
+     * one label, also known as eTLD+1, such as "example.co.uk" for
+     * "www.example.co.uk".
+     * @param hostname The hostname, as returned by url::hostname(). A single
+     * trailing dot is ignored.
+     * @param include_private Whether the rules of the private section apply.
+     * @returns A view into hostname, empty if hostname is itself a public
+     * suffix, an IP address or has empty labels.
+     */
+    std::string_view registrable_domain(std::string_view hostname,
+                                        bool include_private = true) const;
+
+    /**
+     * @brief empty returns whether no rules are loaded.
+     */
+    bool empty() const;
+
+    /**
+     * @brief size returns the number of rules loaded.
+     */
+    std::size_t size() const;
+
+  private:
+    // The number of labels of the public suffix of hostname, 0 if hostname
+    // can't have one.
+    std::size_t suffix_labels(std::string_view hostname,
+                              bool include_private) const;
+
+  private:
+    internal::label_trie trie_;
+    std::size_t size_;
+};
+
+} // namespace net
+
+} // namespace batteries
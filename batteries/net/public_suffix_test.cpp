@@ -0,0 +1,129 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "public_suffix.hpp"
+
+#include "url.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using batteries::net::public_suffix;
+using batteries::net::url;
+
+class PublicSuffixTest : public ::testing::Test {
+  protected:
+    const public_suffix& list_ = public_suffix::default_list();
+};
+
+TEST_F(PublicSuffixTest, Loaded) {
+    EXPECT_FALSE(list_.empty());
+    EXPECT_GT(list_.size(), 9000u);
+
+    // The embedded list is the vendored file
+    public_suffix file;
+    auto err = file.load_file(BATT_PUBLIC_SUFFIX_LIST);
+    ASSERT_FALSE(err) << err;
+    EXPECT_EQ(file.size(), list_.size());
+    EXPECT_EQ(&public_suffix::default_list(), &list_);
+}
+
+TEST_F(PublicSuffixTest, RegistrableDomain) {
+    struct test_case {
+        std::string_view host;
+        std::string_view suffix;
+        std::string_view domain;
+    };
+    const test_case tests[] = {
+        // Default rule
+        {"example", "example", ""},
+        {"example.example", "example", "example.example"},
+        {"b.example.example", "example", "example.example"},
+        // Plain rules
+        {"com", "com", ""},
+        {"example.com", "com", "example.com"},
+        {"www.example.com", "com", "example.com"},
+        {"a.b.example.co.uk", "co.uk", "example.co.uk"},
+        {"co.uk", "co.uk", ""},
+        {"WWW.Example.CO.UK", "CO.UK", "Example.CO.UK"},
+        {"www.example.com.", "com", "example.com"},
+        // Wildcard and exception rules
+        {"ck", "ck", ""},
+        {"test.ck", "test.ck", ""},
+        {"b.test.ck", "test.ck", "b.test.ck"},
+        {"www.ck", "ck", "www.ck"},
+        {"www.www.ck", "ck", "www.ck"},
+        {"city.kawasaki.jp", "kawasaki.jp", "city.kawasaki.jp"},
+        {"foo.kawasaki.jp", "foo.kawasaki.jp", ""},
+        {"a.foo.kawasaki.jp", "foo.kawasaki.jp", "a.foo.kawasaki.jp"},
+        // Private section
+        {"foo.github.io", "github.io", "foo.github.io"},
+        {"a.b.blogspot.co.uk", "blogspot.co.uk", "b.blogspot.co.uk"},
+        // Internationalized rules
+        {"食狮.公司.cn", "公司.cn", "食狮.公司.cn"},
+        {"a.xn--55qx5d.cn", "xn--55qx5d.cn", "a.xn--55qx5d.cn"},
+        {"xn--55qx5d.cn", "xn--55qx5d.cn", ""},
+        {"A.XN--55QX5D.CN", "XN--55QX5D.CN", "A.XN--55QX5D.CN"},
+        {"www.example.xn--fiqs8s", "xn--fiqs8s", "example.xn--fiqs8s"},
+        {"a.b.xn--lesund-hua.no", "xn--lesund-hua.no", "b.xn--lesund-hua.no"},
+        // Not domain names
+        {"", "", ""},
+        {".", "", ""},
+        {".com", "", ""},
+        {"a..com", "", ""},
+        {"192.168.0.1", "", ""},
+        {"::1", "", ""},
+    };
+
+    for (const auto& test : tests) {
+        EXPECT_EQ(list_.suffix(test.host), test.suffix) << test.host;
+        EXPECT_EQ(list_.registrable_domain(test.host), test.domain)
+            << test.host;
+    }
+}
+
+TEST_F(PublicSuffixTest, IcannOnly) {
+    EXPECT_EQ(list_.suffix("foo.github.io", false), "io");
+    EXPECT_EQ(list_.registrable_domain("foo.github.io", false), "github.io");
+    EXPECT_EQ(list_.registrable_domain("a.b.blogspot.co.uk", false),
+              "blogspot.co.uk");
+}
+
+TEST_F(PublicSuffixTest, UrlHostname) {
+    url u("https://user@www.example.co.uk:8080/path?q=1");
+    EXPECT_EQ(list_.registrable_domain(u.hostname()), "example.co.uk");
+}
+
+TEST(PublicSuffix, Load) {
+    public_suffix list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.registrable_domain("www.example.com"), "example.com");
+
+    EXPECT_TRUE(list.load("// only comments\n\n"));
+    EXPECT_TRUE(list.empty());
+
+    ASSERT_FALSE(list.load("com\r\nexample.com trailing text\n!www.ck\n*.ck"));
+    EXPECT_EQ(list.size(), 4u);
+    EXPECT_EQ(list.registrable_domain("a.b.example.com"), "b.example.com");
+    EXPECT_EQ(list.registrable_domain("www.ck"), "www.ck");
+    EXPECT_EQ(list.registrable_domain("a.b.ck"), "a.b.ck");
+
+    // A failed load keeps the current rules
+    EXPECT_TRUE(list.load_file("/nonexistent/public_suffix_list.dat"));
+    EXPECT_EQ(list.size(), 4u);
+}
+
+} // namespace
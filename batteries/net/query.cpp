@@ -15,121 +15,510 @@
 #include "query.hpp"
 
 #include <algorithm>
-
-#include <absl/strings/str_cat.h>
-#include <absl/strings/str_split.h>
+#include <functional>
+#include <utility>
 
 namespace batteries {
 
 namespace net {
 
+namespace detail {
+
+inline std::size_t hash_key(std::string_view key) {
+    return std::hash<std::string_view>{}(key);
+}
+
+inline uint64_t fnv1a_64(std::string_view s) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (byte c : s) {
+        hash = (hash ^ c) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+inline absl::uint128 fnv1a_128(std::string_view s) {
+    const absl::uint128 prime = absl::MakeUint128(0x1000000, 0x13b);
+    absl::uint128 hash =
+        absl::MakeUint128(0x6c62272e07bb0142ull, 0x62b821756295c58dull);
+    for (byte c : s) {
+        hash = (hash ^ c) * prime;
+    }
+    return hash;
+}
+
+} // namespace detail
+
 query::query()
-    : query_()
+    : values_()
+    , index_()
     , raw_query_()
+    , structure_()
     , force_query_(false)
-    , raw_query_dirty_(false) {}
+    , raw_query_dirty_(false)
+    , raw_query_appendable_(true)
+    , values_decoded_(true) {}
 
 query::query(std::string query)
-    : query_()
+    : values_()
+    , index_()
     , raw_query_()
+    , structure_()
     , force_query_(false)
-    , raw_query_dirty_(false) {
+    , raw_query_dirty_(false)
+    , raw_query_appendable_(true)
+    , values_decoded_(true) {
     parse(query);
 }
 
 query::query(const query_values& values)
-    : query_()
+    : values_(values.cbegin(), values.cend())
+    , index_()
     , raw_query_()
+    , structure_()
     , force_query_(false)
-    , raw_query_dirty_(false) {
-    for (auto& value : values) {
-        query_.emplace(value);
-    }
+    , raw_query_dirty_(false)
+    , raw_query_appendable_(true)
+    , values_decoded_(true) {
+    reindex();
     raw_query_ = internal::build_query(values.cbegin(), values.cend());
 }
 
-error query::parse(std::string query) {
-    raw_query_ = std::move(query);
-    query_.clear();
-    error err;
-    std::tie(query_, err) = internal::parse_query(raw_query_);
+query::query(const query& other)
+    : values_()
+    , index_()
+    , raw_query_()
+    , structure_()
+    , force_query_(false)
+    , raw_query_dirty_(false)
+    , raw_query_appendable_(true)
+    , values_decoded_(true) {
+    *this = other;
+}
+
+query::query(query&& other)
+    : values_()
+    , index_()
+    , raw_query_()
+    , structure_()
+    , force_query_(false)
+    , raw_query_dirty_(false)
+    , raw_query_appendable_(true)
+    , values_decoded_(true) {
+    *this = std::move(other);
+}
+
+query& query::operator=(const query& other) {
+    if (this == &other) {
+        return *this;
+    }
+    // Another thread may be decoding other, copy it before or after
+    std::lock_guard<std::mutex> lock(other.lazy_mutex_);
+    values_ = other.values_;
+    index_ = other.index_;
+    raw_query_ = other.raw_query_;
+    structure_ = other.structure_;
+    force_query_ = other.force_query_;
+    raw_query_dirty_ = other.raw_query_dirty_.load();
+    raw_query_appendable_ = other.raw_query_appendable_;
+    values_decoded_ = other.values_decoded_.load();
+    return *this;
+}
 
+query& query::operator=(query&& other) {
+    if (this == &other) {
+        return *this;
+    }
+    values_ = std::move(other.values_);
+    index_ = std::move(other.index_);
+    raw_query_ = std::move(other.raw_query_);
+    structure_ = std::move(other.structure_);
+    force_query_ = other.force_query_;
+    raw_query_dirty_ = other.raw_query_dirty_.load();
+    raw_query_appendable_ = other.raw_query_appendable_;
+    values_decoded_ = other.values_decoded_.load();
+    other.reset();
+    return *this;
+}
+
+error query::parse(std::string_view query, const parse_limits& limits) {
+    auto err = parse_query(query, limits);
+    errors::count_error(err);
     return err;
 }
 
-std::string query::to_string() const {
-    if (raw_query_dirty_) { // Rebuild raw query
-        const_cast<query*>(this)->raw_query_ =
-            internal::build_query(query_.cbegin(), query_.cend());
-        const_cast<query*>(this)->raw_query_dirty_ = false;
+error query::parse_query(std::string_view query, const parse_limits& limits) {
+    reset();
+    error err = internal::check_query_limits(query, limits);
+    if (err != errors::no_error) {
+        return err;
     }
+    raw_query_.assign(query);
+    return index_raw_query();
+}
 
-    if (raw_query_.empty()) {
-        // if forced return the question mark
-        if (force_query_) {
-            return "?";
+error query::index_raw_query() {
+    values_decoded_ = false;
+    error err;
+    if (raw_query_.length() >= internal::query_index_min_length) {
+        err = structure_.build(raw_query_);
+    } else {
+        err = internal::validate_query(raw_query_);
+    }
+    if (err.error_code() == url_error_code::parse_error) {
+        err = error(url_error_code::parse_error, 0, raw_query_);
+    }
+    raw_query_appendable_ = !err;
+    return err;
+}
+
+void query::reset() {
+    values_.clear();
+    index_.clear();
+    raw_query_.clear();
+    structure_.clear();
+    force_query_ = false;
+    raw_query_dirty_ = false;
+    raw_query_appendable_ = true;
+    values_decoded_ = true;
+}
+
+std::string_view query::raw_query() const {
+    if (raw_query_dirty_.load(std::memory_order_acquire)) {
+        // Only changes, which decode first, make the raw query dirty, so
+        // values_ is decoded and stays unchanged while it is rebuilt.
+        std::lock_guard<std::mutex> lock(lazy_mutex_);
+        if (raw_query_dirty_.load(std::memory_order_relaxed)) {
+            raw_query_ =
+                internal::build_query(values_.cbegin(), values_.cend());
+            raw_query_appendable_ = true;
+            raw_query_dirty_.store(false, std::memory_order_release);
         }
-        // return empty string
-        return raw_query_;
     }
 
-    // Return with question mark
-    return absl::StrCat("?", raw_query_);
+    return raw_query_;
+}
+
+std::string query::to_string() const {
+    std::string result;
+    append_to(&result);
+    return result;
+}
+
+std::string query::to_string(const query_format& format) const {
+    decode();
+    std::string result;
+    if (!values_.empty() || force_query_) {
+        result.push_back('?');
+    }
+    internal::append_query(&result, values_.cbegin(), values_.cend(), format);
+    return result;
+}
+
+void query::append_to(std::string* dest) const {
+    auto raw = raw_query();
+    dest->reserve(dest->length() + raw.length() + 1);
+    if (!raw.empty() || force_query_) {
+        dest->push_back('?');
+    }
+    dest->append(raw.data(), raw.length());
 }
 
 void query::set_force_query(bool force) { force_query_ = force; }
 
+std::optional<std::string_view> query::find_raw(std::string_view key) const {
+    std::string_view rest = raw_query();
+    while (!rest.empty()) {
+        auto separator = rest.find_first_of("&;");
+        auto pair = rest.substr(0, separator);
+        rest = separator == rest.npos ? std::string_view()
+                                      : rest.substr(separator + 1);
+
+        auto equals = pair.find('=');
+        if (equals != pair.npos &&
+            internal::escaped_equals(pair.substr(0, equals), key)) {
+            return pair.substr(equals + 1);
+        }
+    }
+    return std::nullopt;
+}
+
 bool query::force_query() const { return force_query_; }
 
 void query::set(std::string key, std::string value) {
+    decode();
+    auto found = find(key);
+    if (found.empty()) {
+        add(std::move(key), std::move(value));
+        return;
+    }
+
     raw_query_dirty_ = true;
-    query_.erase(key);
-    query_.insert(std::make_pair(key, value));
+    values_[found[0]].second = std::move(value);
+    if (found.size() > 1) {
+        found.erase(found.begin());
+        erase(found);
+    }
 }
 
 void query::add(query_value value) {
-    raw_query_dirty_ = true;
-    query_.insert(value);
+    if (!raw_query_dirty_ && (raw_query_appendable_ || raw_query_.empty())) {
+        append_raw(value);
+        if (!values_decoded_) {
+            // Decoded with the rest of the raw query
+            return;
+        }
+    } else {
+        decode();
+        raw_query_dirty_ = true;
+    }
+    values_.push_back(std::move(value));
+
+    if (values_.size() == index_threshold + 1) {
+        reindex();
+    } else if (values_.size() > index_threshold) {
+        index_[detail::hash_key(values_.back().first)].push_back(
+            static_cast<uint32_t>(values_.size() - 1));
+    }
 }
 
 void query::add(std::string key, std::string value) {
-    raw_query_dirty_ = true;
-    query_.insert(std::make_pair(key, value));
+    add(query_value(std::move(key), std::move(value)));
 }
 
 void query::del(std::string key) {
-    raw_query_dirty_ = true;
-    query_.erase(key);
+    decode();
+    auto found = find(key);
+    if (!found.empty()) {
+        raw_query_dirty_ = true;
+        erase(found);
+    }
 }
 
 query_values query::values() const {
-    query_values values;
-    for (auto& elem : query_) {
-        values.push_back(elem);
-    }
-    return values;
+    decode();
+    return query_values(values_.cbegin(), values_.cend());
 }
 
 query_values query::get(std::string key) const {
+    decode();
     query_values values;
-    auto it = query_.find(key);
-    while (it != query_.end()) {
-        values.push_back(*it++);
+    for (auto position : find(key)) {
+        values.push_back(values_[position]);
     }
 
     return values;
 }
 
-bool query::empty() const { return query_.empty(); }
+result<std::size_t> query::rewrite(const query_rewriter& rewriter) {
+    raw_query();
+    std::size_t changed = rewriter.rewrite(&raw_query_);
+    if (changed == 0) {
+        return changed;
+    }
+
+    values_.clear();
+    index_.clear();
+    structure_.clear();
+    // Every parameter was removed, which leaves a valid empty query
+    if (raw_query_.empty()) {
+        raw_query_appendable_ = true;
+        values_decoded_ = true;
+        return changed;
+    }
+    auto err = index_raw_query();
+    if (err) {
+        return err;
+    }
+    return changed;
+}
+
+std::string_view query::cache_key(const query_filter& filter,
+                                  std::string* buffer) const {
+    decode();
+    absl::InlinedVector<const query_value*, 16> selected;
+    for (const auto& value : values_) {
+        if (filter.selects(value.first)) {
+            selected.push_back(&value);
+        }
+    }
+    std::stable_sort(selected.begin(), selected.end(),
+                     [](const query_value* a, const query_value* b) {
+                         return a->first < b->first;
+                     });
+
+    buffer->resize(internal::query_length(selected.cbegin(), selected.cend()));
+    internal::write_query(selected.cbegin(), selected.cend(), '&',
+                          &(*buffer)[0]);
+    return *buffer;
+}
+
+uint64_t query::cache_key_hash(const query_filter& filter,
+                               std::string* buffer) const {
+    return detail::fnv1a_64(cache_key(filter, buffer));
+}
+
+absl::uint128 query::cache_key_hash128(const query_filter& filter,
+                                       std::string* buffer) const {
+    return detail::fnv1a_128(cache_key(filter, buffer));
+}
+
+bool query::empty() const {
+    decode();
+    return values_.empty();
+}
 
-std::size_t query::size() const { return query_.size(); }
+std::size_t query::size() const {
+    decode();
+    return values_.size();
+}
 
 bool query::operator==(const query& rhs) const {
-    return (query_ == rhs.query_);
+    decode();
+    rhs.decode();
+    if (values_.size() != rhs.values_.size()) {
+        return false;
+    }
+
+    // Compare the values grouped by key, keeping their order within a key
+    auto by_key = [](const storage& values) {
+        std::vector<const query_value*> sorted;
+        sorted.reserve(values.size());
+        for (auto& value : values) {
+            sorted.push_back(&value);
+        }
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const query_value* lhs, const query_value* rhs) {
+                             return lhs->first < rhs->first;
+                         });
+        return sorted;
+    };
+    auto lhs_sorted = by_key(values_);
+    auto rhs_sorted = by_key(rhs.values_);
+    return std::equal(lhs_sorted.begin(), lhs_sorted.end(), rhs_sorted.begin(),
+                      [](const query_value* lhs, const query_value* rhs) {
+                          return *lhs == *rhs;
+                      });
 }
 
 bool query::operator!=(const query& rhs) const { return !(*this == rhs); }
 
+query::positions query::find(std::string_view key) const {
+    positions found;
+    if (index_.empty()) {
+        for (std::size_t i = 0; i < values_.size(); i++) {
+            if (values_[i].first == key) {
+                found.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        return found;
+    }
+
+    auto it = index_.find(detail::hash_key(key));
+    if (it != index_.end()) {
+        // Skip the keys that only share the hash
+        for (auto position : it->second) {
+            if (values_[position].first == key) {
+                found.push_back(position);
+            }
+        }
+    }
+    return found;
+}
+
+void query::erase(const positions& erased) {
+    std::size_t next = 0;
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < values_.size(); i++) {
+        if (next < erased.size() && erased[next] == i) {
+            next++;
+            continue;
+        }
+        if (out != i) {
+            values_[out] = std::move(values_[i]);
+        }
+        out++;
+    }
+    values_.erase(values_.begin() + out, values_.end());
+    reindex();
+}
+
+void query::decode() const {
+    if (values_decoded_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(lazy_mutex_);
+    if (!values_decoded_.load(std::memory_order_relaxed)) {
+        decode_locked();
+    }
+}
+
+void query::decode_locked() const {
+    const auto& spans = structure_.spans();
+    if (!spans.empty()) {
+        values_.resize(spans.size());
+        internal::decode_spans(raw_query_, spans, values_.data());
+        structure_.clear();
+        reindex();
+        values_decoded_.store(true, std::memory_order_release);
+        return;
+    }
+
+    auto err = internal::decode_query(
+        raw_query_, [this](std::string key, std::string value) {
+            values_.emplace_back(std::move(key), std::move(value));
+        });
+    if (err.error_code() == url_error_code::parse_error) {
+        // A malformed query has no values, see internal::parse_query
+        values_.clear();
+    }
+    reindex();
+    values_decoded_.store(true, std::memory_order_release);
+}
+
+void query::decode(const internal::executor& run, std::size_t chunks) {
+    const auto& spans = structure_.spans();
+    if (values_decoded_ ||
+        spans.size() < internal::parallel_decode_min_pairs) {
+        decode();
+        return;
+    }
+
+    values_.resize(spans.size());
+    internal::decode_spans(raw_query_, spans, values_.data(), run, chunks);
+    structure_.clear();
+    reindex();
+    values_decoded_ = true;
+}
+
+void query::append_raw(const query_value& value) {
+    if (!raw_query_.empty()) {
+        raw_query_.push_back('&');
+    }
+    auto first = raw_query_.length();
+    internal::append_escaped(&raw_query_, value.first,
+                             internal::encoding::encodeQueryComponent);
+    raw_query_.push_back('=');
+    internal::append_escaped(&raw_query_, value.second,
+                             internal::encoding::encodeQueryComponent);
+    raw_query_appendable_ = true;
+
+    if (!structure_.spans().empty() && structure_.append(raw_query_, first)) {
+        // Decode without the index rather than miss the pair
+        structure_.clear();
+    }
+}
+
+void query::reindex() const {
+    index_.clear();
+    if (values_.size() <= index_threshold) {
+        return;
+    }
+    for (std::size_t i = 0; i < values_.size(); i++) {
+        index_[detail::hash_key(values_[i].first)].push_back(
+            static_cast<uint32_t>(i));
+    }
+}
+
 } // namespace net
 
-} // namespace batteries
\ No newline at end of file
+} // namespace batteries
@@ -14,27 +14,65 @@
 
 #pragma once
 
-#include <map>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/inlined_vector.h>
+#include <absl/numeric/int128.h>
 #include <absl/strings/string_view.h>
 
 #include "base.hpp"
 #include "batteries/errors/error.hpp"
+#include "batteries/errors/result.hpp"
 #include "internal/escape.hpp"
 #include "internal/parse.hpp"
+#include "internal/query_index.hpp"
+#include "query_filter.hpp"
+#include "query_rewriter.hpp"
 
 namespace batteries {
 
 namespace net {
 
+class url;
+
+/**
+ * A query holds the parameters of a URL query in the order they were added
+ * or parsed. The parameters are stored contiguously with room for a few of
+ * them inline, so small queries need no allocation besides their strings and
+ * are searched with a linear scan. Queries with more than index_threshold
+ * parameters also keep a hashed index of the positions of each key.
+ *
+ * A parsed query is only validated; its parameters are decoded on the first
+ * access to them, so a query that is never looked at costs a single scan.
+ * find_raw looks up a single key without decoding anything. Long queries
+ * are indexed while they are validated and decoded from the index on the
+ * calling thread; decode with an executor decodes them in parallel.
+ *
+ * Decoding and rebuilding the raw query after a change both happen inside
+ * const members. They run at most once, under a lock that the members only
+ * take while there is work left, so const members may be called from several
+ * threads at once like those of any standard container.
+ */
 class query {
 
   public:
+    // Queries with more parameters than this are indexed by key
+    static constexpr std::size_t index_threshold = 16;
+
     query();
     query(std::string query);
     query(const query_values& values);
+    query(const query& other);
+    query(query&& other);
+    query& operator=(const query& other);
+    query& operator=(query&& other);
 
     /**
      * @brief parse parses the URL-encoded query string and returns
@@ -47,9 +85,41 @@ class query {
      * ampersands or semicolons. A setting without an equals sign is
      * interpreted as a key set to an empty value.
      *
+     * The query is validated but its parameters are decoded lazily, on the
+     * first call that needs them.
+     *
+     * The query is reset before parsing so no values from a previous parse
+     * survive, but the storage already allocated for the raw query is reused.
+     *
      * @param query The raw query string to parse.
+     * @param limits The limits to enforce, the query is left empty if one is
+     * crossed.
+     */
+    error parse(std::string_view query, const parse_limits& limits = {});
+
+    /**
+     * @brief decode decodes the parsed parameters now rather than on first
+     * access, on the calling thread. Does nothing if they are already
+     * decoded.
+     */
+    void decode() const;
+
+    /**
+     * @brief decode decodes the parsed parameters now rather than on first
+     * access, splitting the pairs of an indexed query with at least
+     * internal::parallel_decode_min_pairs parameters into chunks run by run.
+     * Accessors never start threads themselves. Does nothing if the
+     * parameters are already decoded.
+     * @param run The executor that runs the chunks.
+     * @param chunks The number of chunks to split the pairs into.
      */
-    error parse(std::string query);
+    void decode(const internal::executor& run, std::size_t chunks);
+
+    /**
+     * @brief reset clears all values and flags of the query. The capacity of
+     * the raw query string is kept so that the object can be reused.
+     */
+    void reset();
 
     /**
      * @brief to_string returns the query in raw string form.
@@ -57,6 +127,36 @@ class query {
      */
     std::string to_string() const;
 
+    /**
+     * @brief to_string returns the query re-encoded from its parameters.
+     * @param format The separator and order of the parameters.
+     * @returns The query in raw string form.
+     */
+    std::string to_string(const query_format& format) const;
+
+    /**
+     * @brief append_to appends the query as to_string returns it to dest,
+     * growing dest at most once.
+     * @param dest The string the query is appended to.
+     */
+    void append_to(std::string* dest) const;
+
+    /**
+     * @brief raw_query returns the encoded query without the leading '?'. The
+     * view is valid until the query is modified or destroyed.
+     * @returns The encoded query.
+     */
+    std::string_view raw_query() const;
+
+    /**
+     * @brief find_raw finds the first value of key by scanning the encoded
+     * query. Nothing is decoded or allocated.
+     * @param key The decoded key.
+     * @returns The encoded value, or nothing if key isn't in the query. The
+     * view is valid until the query is modified or destroyed.
+     */
+    std::optional<std::string_view> find_raw(std::string_view key) const;
+
     /**
      * @brief set_force_query Allows the user to force a null query when the
      * query values are empty.
@@ -73,25 +173,185 @@ class query {
     bool force_query() const;
 
     // query functions
+
+    /**
+     * @brief set replaces the values of key with value. The value takes the
+     * position of the first value of key, or is added if there is none.
+     */
     void set(std::string key, std::string value);
+
+    /**
+     * @brief add adds a value after all others. The escaped pair is appended
+     * to the raw query when it is up to date, so adding to a long query
+     * doesn't re-encode it.
+     */
     void add(query_value value);
     void add(std::string key, std::string value);
+
+    /**
+     * @brief del deletes all values of key.
+     */
     void del(std::string key);
+
+    /**
+     * @brief values returns all values in order.
+     */
     query_values values() const;
+
+    /**
+     * @brief get returns the values of key in order.
+     */
     query_values get(std::string key) const;
 
+    /**
+     * @brief get_as converts the first value of key to T, which is bool or
+     * an arithmetic type, without copying it.
+     * @param key The decoded key.
+     * @returns The value, or url_error_code::not_found if key has no value or
+     * the error of internal::parse_value if it doesn't convert. Neither error
+     * allocates; not_found doesn't repeat the key.
+     */
+    template <typename T> result<T> get_as(std::string_view key) const {
+        decode();
+        auto found = find(key);
+        if (found.empty()) {
+            return error(url_error_code::not_found,
+                         errors::static_message{"query key has no value"});
+        }
+        T value{};
+        auto err = internal::parse_value(values_[found[0]].second, &value);
+        if (err) {
+            return err;
+        }
+        return value;
+    }
+
+    /**
+     * @brief get_all_as converts every value of key to T in order.
+     * @param key The decoded key.
+     * @returns The values, empty if key has none, or the error of the first
+     * value that doesn't convert.
+     */
+    template <typename T>
+    result<std::vector<T>> get_all_as(std::string_view key) const {
+        decode();
+        std::vector<T> values;
+        auto found = find(key);
+        values.reserve(found.size());
+        for (auto position : found) {
+            T value{};
+            auto err = internal::parse_value(values_[position].second, &value);
+            if (err) {
+                return err;
+            }
+            values.push_back(value);
+        }
+        return values;
+    }
+
+    /**
+     * @brief rewrite removes and renames parameters by rewriting the raw
+     * query in place; see query_rewriter. The rewritten query is validated
+     * like a parsed one and its parameters are decoded again when they are
+     * next accessed.
+     * @param rewriter The parameters to remove and rename.
+     * @returns The number of parameters removed or renamed, or the error
+     * parse would return for the rewritten query, such as that of a
+     * malformed pair the rewriter kept.
+     */
+    result<std::size_t> rewrite(const query_rewriter& rewriter);
+
+    /**
+     * @brief cache_key writes a canonical key of the parameters selected by
+     * filter to buffer. The parameters are sorted by key, values of the same
+     * key keep their order, and every key and value is escaped the way
+     * to_string escapes them. Queries that compare equal give identical keys
+     * whatever their original order or escaping.
+     * @param filter The parameters that are part of the key.
+     * @param buffer The buffer the key is written to. Its previous contents
+     * are replaced and its capacity is reused.
+     * @returns A view of buffer.
+     */
+    std::string_view cache_key(const query_filter& filter,
+                               std::string* buffer) const;
+
+    /**
+     * @brief cache_key_hash returns the 64-bit FNV-1a hash of cache_key.
+     * The hash is stable across processes and platforms.
+     * @param filter The parameters that are part of the key.
+     * @param buffer A scratch buffer that is reused between calls.
+     */
+    uint64_t cache_key_hash(const query_filter& filter,
+                            std::string* buffer) const;
+
+    /**
+     * @brief cache_key_hash128 returns the 128-bit FNV-1a hash of cache_key.
+     * The hash is stable across processes and platforms.
+     * @param filter The parameters that are part of the key.
+     * @param buffer A scratch buffer that is reused between calls.
+     */
+    absl::uint128 cache_key_hash128(const query_filter& filter,
+                                    std::string* buffer) const;
+
     bool empty() const;
     std::size_t size() const;
 
     // Operators
+
+    /**
+     * @brief Two queries are equal if they hold the same values for each key
+     * in the same order; the order of different keys doesn't matter.
+     */
     bool operator==(const query& rhs) const;
     bool operator!=(const query& rhs) const;
 
   private:
-    std::multimap<std::string, std::string> query_;
-    std::string raw_query_;
+    friend class url;
+
+    using storage = absl::InlinedVector<query_value, 4>;
+    using positions = absl::InlinedVector<uint32_t, 4>;
+
+    // Returns the positions of the values of key in ascending order.
+    positions find(std::string_view key) const;
+
+    // Erases the values at the ascending positions.
+    void erase(const positions& erased);
+
+    // Parses query without counting the error, for callers that count their
+    // own, see errors::count_error.
+    error parse_query(std::string_view query, const parse_limits& limits);
+
+    // Validates raw_query_, indexing long queries, and leaves its parameters
+    // to be decoded.
+    error index_raw_query();
+
+    // Rebuilds the index from scratch, or drops it for small queries.
+    void reindex() const;
+
+    // Decodes values_ from raw_query_, with lazy_mutex_ held by const callers.
+    void decode_locked() const;
+
+    // Appends the escaped pair to raw_query_, which must be up to date.
+    void append_raw(const query_value& value);
+
+  private:
+    // The members that const members decode or rebuild are mutable. Const
+    // members only write them with lazy_mutex_ held, and only while
+    // values_decoded_ or raw_query_dirty_ say there is work left.
+    mutable storage values_;
+    // The positions of the values by the hash of their key
+    mutable absl::flat_hash_map<std::size_t, absl::InlinedVector<uint32_t, 2>>
+        index_;
+    mutable std::string raw_query_;
+    // The structure of long parsed queries until they are decoded
+    mutable internal::query_index structure_;
     bool force_query_;
-    bool raw_query_dirty_;
+    mutable std::atomic<bool> raw_query_dirty_;
+    // Whether raw_query_ is a valid query that pairs can be appended to
+    mutable bool raw_query_appendable_;
+    // Whether values_ holds the parameters of raw_query_
+    mutable std::atomic<bool> values_decoded_;
+    mutable std::mutex lazy_mutex_;
 };
 
 } // namespace net
@@ -0,0 +1,68 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "query_filter.hpp"
+
+#include <absl/strings/match.h>
+
+namespace batteries {
+
+namespace net {
+
+query_filter::query_filter()
+    : mode_(mode::deny)
+    , keys_()
+    , prefixes_() {}
+
+query_filter::query_filter(mode mode, absl::Span<const std::string_view> keys)
+    : mode_(mode)
+    , keys_()
+    , prefixes_() {
+    for (auto key : keys) {
+        if (absl::EndsWith(key, "*")) {
+            key.remove_suffix(1);
+            prefixes_.emplace_back(key);
+        } else {
+            keys_.emplace(key);
+        }
+    }
+}
+
+query_filter query_filter::allow(absl::Span<const std::string_view> keys) {
+    return query_filter(mode::allow, keys);
+}
+
+query_filter query_filter::deny(absl::Span<const std::string_view> keys) {
+    return query_filter(mode::deny, keys);
+}
+
+bool query_filter::selects(std::string_view key) const {
+    return listed(key) == (mode_ == mode::allow);
+}
+
+bool query_filter::listed(std::string_view key) const {
+    if (keys_.contains(key)) {
+        return true;
+    }
+    for (const auto& prefix : prefixes_) {
+        if (absl::StartsWith(key, prefix)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,88 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <absl/container/flat_hash_set.h>
+#include <absl/types/span.h>
+
+#include "base.hpp"
+
+namespace batteries {
+
+namespace net {
+
+/**
+ * A query_filter selects query parameters by their decoded key, either the
+ * keys of an allow list or every key but those of a deny list. A key that
+ * ends with '*', such as "utm_*", is a prefix pattern that matches every key
+ * starting with "utm_". It is compiled once and can then be shared by any
+ * number of threads.
+ */
+class query_filter {
+
+  public:
+    enum class mode : uint8_t {
+        // Only the listed keys are selected
+        allow,
+        // Every key but the listed keys is selected
+        deny,
+    };
+
+    /**
+     * @brief The default filter selects every key.
+     */
+    query_filter();
+
+    /**
+     * @brief Compiles a filter.
+     * @param mode Whether keys are the keys to select or to leave out.
+     * @param keys The decoded keys and prefix patterns.
+     */
+    query_filter(mode mode, absl::Span<const std::string_view> keys);
+
+    /**
+     * @brief allow returns a filter that selects only keys.
+     */
+    static query_filter allow(absl::Span<const std::string_view> keys);
+
+    /**
+     * @brief deny returns a filter that selects every key but keys.
+     */
+    static query_filter deny(absl::Span<const std::string_view> keys);
+
+    /**
+     * @brief selects returns whether the filter selects key.
+     * @param key The decoded key.
+     */
+    bool selects(std::string_view key) const;
+
+  private:
+    // Whether key is listed or matches a listed prefix
+    bool listed(std::string_view key) const;
+
+  private:
+    mode mode_;
+    absl::flat_hash_set<std::string> keys_;
+    std::vector<std::string> prefixes_;
+};
+
+} // namespace net
+
+} // namespace batteries
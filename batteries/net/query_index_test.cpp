@@ -0,0 +1,148 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "internal/query_index.hpp"
+
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+
+#include "internal/parse.hpp"
+#include "query.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using batteries::net::query_value;
+using batteries::net::query_values;
+using batteries::net::internal::decode_query;
+using batteries::net::internal::decode_spans;
+using batteries::net::internal::query_index;
+using batteries::net::internal::query_span;
+using batteries::net::internal::validate_query;
+
+query_values decode_serial(std::string_view raw) {
+    query_values values;
+    decode_query(raw, [&](std::string key, std::string value) {
+        values.emplace_back(std::move(key), std::move(value));
+    });
+    return values;
+}
+
+TEST(QueryIndex, Spans) {
+    query_index index;
+    std::string_view raw = "a=1&b%20c=d+e;=&f=%41%42";
+    ASSERT_FALSE(index.build(raw));
+    ASSERT_EQ(index.spans().size(), 4u);
+
+    const auto& span = index.spans()[1];
+    EXPECT_EQ(raw.substr(span.key, span.equals - span.key), "b%20c");
+    EXPECT_EQ(raw.substr(span.equals + 1, span.end - span.equals - 1), "d+e");
+    EXPECT_EQ(span.flags, query_span::key_escaped | query_span::value_escaped);
+    EXPECT_EQ(index.spans()[0].flags, 0);
+
+    query_values values(index.spans().size());
+    decode_spans(raw, index.spans(), values.data());
+    EXPECT_EQ(values, decode_serial(raw));
+}
+
+TEST(QueryIndex, MatchesValidateQuery) {
+    // Short and long inputs so both the block and the tail paths are used
+    const std::string padding(40, 'x');
+    for (std::string_view raw :
+         {"a=1", "", "a", "=", "a==1", "a=1&", "&a=1", "a=1;;b=2", "a=%",
+          "a=%4", "a=%4g", "a=%g4", "a%=1", "a%4=1", "a=%41%", "%zz=1=2",
+          "a=%2=b", "a=1&b=%zz&c", "a=b+c%20d"}) {
+        for (const auto& input :
+             {std::string(raw), absl::StrCat(padding, "=1&", raw),
+              absl::StrCat(raw, "&", padding, "=1")}) {
+            query_index index;
+            auto expected = validate_query(input);
+            auto err = index.build(input);
+            EXPECT_EQ(err.error_code(), expected.error_code()) << input;
+            if (!err) {
+                query_values values(index.spans().size());
+                decode_spans(input, index.spans(), values.data());
+                EXPECT_EQ(values, decode_serial(input)) << input;
+            } else {
+                EXPECT_TRUE(index.spans().empty());
+            }
+        }
+    }
+}
+
+TEST(QueryIndex, ParallelDecode) {
+    std::mt19937 rng(42);
+    std::string raw;
+    for (int i = 0; i < 10000; i++) {
+        absl::StrAppend(&raw, i == 0 ? "" : (rng() % 2 ? "&" : ";"), "k", i,
+                        rng() % 3 ? "" : "%20", "=v", rng() % 1000,
+                        rng() % 4 ? "" : "+x");
+    }
+    query_index index;
+    ASSERT_FALSE(index.build(raw));
+    ASSERT_EQ(index.spans().size(), 10000u);
+
+    // Runs every chunk on its own thread
+    batteries::net::internal::executor threads =
+        [](std::size_t count, const std::function<void(std::size_t)>& task) {
+            std::vector<std::thread> workers;
+            for (std::size_t i = 0; i < count; i++) {
+                workers.emplace_back(task, i);
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        };
+
+    query_values serial(index.spans().size());
+    decode_spans(raw, index.spans(), serial.data());
+    query_values parallel(index.spans().size());
+    decode_spans(raw, index.spans(), parallel.data(), threads, 8);
+    EXPECT_EQ(serial, decode_serial(raw));
+    EXPECT_EQ(parallel, serial);
+
+    // Accessors decode on the calling thread
+    batteries::net::query lazy;
+    ASSERT_FALSE(lazy.parse(raw));
+    EXPECT_EQ(lazy.values(), serial);
+    EXPECT_EQ(lazy.get(serial[7].first).front(), serial[7]);
+
+    std::size_t chunks = 0;
+    batteries::net::internal::executor counted =
+        [&](std::size_t count, const std::function<void(std::size_t)>& task) {
+            chunks = count;
+            threads(count, task);
+        };
+    batteries::net::query query;
+    ASSERT_FALSE(query.parse(raw));
+    query.decode(counted, 4);
+    EXPECT_EQ(chunks, 4u);
+    EXPECT_EQ(query.values(), serial);
+    EXPECT_EQ(query.get(serial[7].first).front(), serial[7]);
+
+    // Short queries are decoded serially
+    chunks = 0;
+    ASSERT_FALSE(query.parse("a=1&b=2"));
+    query.decode(counted, 4);
+    EXPECT_EQ(chunks, 0u);
+    EXPECT_EQ(query.size(), 2u);
+}
+
+} // namespace
@@ -0,0 +1,146 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "query_rewriter.hpp"
+
+#include <cstring>
+
+#include "internal/escape.hpp"
+
+namespace batteries {
+
+namespace net {
+
+namespace detail {
+
+// Calls visit(separator, pair, key) for each pair of a raw query, where
+// separator is the byte before the pair or 0 for the first pair.
+template <typename F> void for_each_pair(std::string_view query, F&& visit) {
+    char separator = 0;
+    while (true) {
+        auto end = query.find_first_of("&;");
+        auto pair = query.substr(0, end);
+        visit(separator, pair, pair.substr(0, pair.find('=')));
+        if (end == query.npos) {
+            return;
+        }
+        separator = query[end];
+        query.remove_prefix(end + 1);
+    }
+}
+
+// Rewrites the pairs of query and passes the pieces of the result to write
+// in order. Returns the number of pairs removed or renamed.
+template <typename F>
+std::size_t rewrite_pairs(
+    const query_filter& keep,
+    const absl::flat_hash_map<std::string, std::string>& renames,
+    std::string_view query, F&& write) {
+    std::size_t changed = 0;
+    bool first = true;
+    std::string scratch;
+
+    for_each_pair(query, [&](char separator, std::string_view pair,
+                             std::string_view raw_key) {
+        std::string_view key = raw_key;
+        if (raw_key.find_first_of("%+") != raw_key.npos) {
+            auto unescaped = internal::unescape(
+                raw_key, internal::encoding::encodeQueryComponent);
+            if (unescaped) {
+                scratch = *std::move(unescaped);
+                key = scratch;
+            }
+        }
+
+        if (!keep.selects(key)) {
+            changed++;
+            return;
+        }
+        if (!first) {
+            write(std::string_view(&separator, 1));
+        }
+        first = false;
+
+        auto renamed = renames.find(key);
+        if (renamed == renames.end()) {
+            write(pair);
+            return;
+        }
+        changed++;
+        write(std::string_view(renamed->second));
+        write(pair.substr(raw_key.length()));
+    });
+
+    return changed;
+}
+
+} // namespace detail
+
+query_rewriter::query_rewriter()
+    : keep_()
+    , renames_()
+    , grows_(false) {}
+
+query_rewriter::query_rewriter(query_filter keep)
+    : keep_(std::move(keep))
+    , renames_()
+    , grows_(false) {}
+
+void query_rewriter::rename(std::string_view from, std::string_view to) {
+    auto escaped =
+        internal::escape(to, internal::encoding::encodeQueryComponent);
+    // Every decoded byte of a key takes at least a byte in a query
+    grows_ = grows_ || escaped.length() > from.length();
+    renames_[std::string(from)] = std::move(escaped);
+}
+
+std::size_t query_rewriter::rewrite(std::string* query) const {
+    if (query->empty()) {
+        return 0;
+    }
+    if (grows_) {
+        std::string out;
+        auto changed = rewrite(*query, &out);
+        query->swap(out);
+        return changed;
+    }
+
+    // The output never overtakes the pair being read
+    char* out = &(*query)[0];
+    std::size_t length = 0;
+    auto changed = detail::rewrite_pairs(
+        keep_, renames_, *query, [out, &length](std::string_view piece) {
+            std::memmove(out + length, piece.data(), piece.length());
+            length += piece.length();
+        });
+    query->resize(length);
+    return changed;
+}
+
+std::size_t query_rewriter::rewrite(std::string_view query,
+                                    std::string* out) const {
+    out->clear();
+    if (query.empty()) {
+        return 0;
+    }
+    out->reserve(query.length());
+    return detail::rewrite_pairs(keep_, renames_, query,
+                                 [out](std::string_view piece) {
+                                     out->append(piece.data(), piece.length());
+                                 });
+}
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,89 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <absl/container/flat_hash_map.h>
+
+#include "base.hpp"
+#include "query_filter.hpp"
+
+namespace batteries {
+
+namespace net {
+
+/**
+ * A query_rewriter removes and renames parameters of raw queries without
+ * decoding them, e.g. to strip tracking parameters such as "utm_*" from
+ * links. It makes a single pass over the query: pairs that are kept are
+ * copied byte for byte, so the order, separators and escaping of the
+ * untouched parameters are preserved, and only the keys of renamed pairs are
+ * re-escaped.
+ *
+ * Keys are matched decoded; a key is only unescaped when it contains '%' or
+ * '+'. Pairs without '=' are matched by the whole pair. A rewriter is
+ * compiled once and can then be shared by any number of threads.
+ */
+class query_rewriter {
+
+  public:
+    /**
+     * @brief The default rewriter keeps every parameter as it is.
+     */
+    query_rewriter();
+
+    /**
+     * @brief Compiles a rewriter.
+     * @param keep The parameters that are kept, such as
+     * query_filter::deny({"utm_*", "fbclid", "gclid"}).
+     */
+    explicit query_rewriter(query_filter keep);
+
+    /**
+     * @brief rename renames every kept parameter with key from to to.
+     * @param from The decoded key to rename.
+     * @param to The decoded new key.
+     */
+    void rename(std::string_view from, std::string_view to);
+
+    /**
+     * @brief rewrite rewrites a raw query in place. No memory is allocated
+     * unless a rename makes the query longer.
+     * @param query The raw query without the leading '?'.
+     * @returns The number of parameters removed or renamed.
+     */
+    std::size_t rewrite(std::string* query) const;
+
+    /**
+     * @brief rewrite writes the rewritten form of a raw query to out.
+     * @param query The raw query without the leading '?'.
+     * @param out The string the rewritten query replaces the contents of.
+     * @returns The number of parameters removed or renamed.
+     */
+    std::size_t rewrite(std::string_view query, std::string* out) const;
+
+  private:
+    query_filter keep_;
+    // The escaped new key by decoded old key
+    absl::flat_hash_map<std::string, std::string> renames_;
+    // Whether a rename can make a key longer than it is in a query
+    bool grows_;
+};
+
+} // namespace net
+
+} // namespace batteries
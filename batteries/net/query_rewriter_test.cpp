@@ -0,0 +1,131 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "query_rewriter.hpp"
+
+#include <string>
+
+#include "query.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using batteries::net::query_filter;
+using batteries::net::query_rewriter;
+
+query_rewriter tracking() {
+    return query_rewriter(query_filter::deny({"utm_*", "fbclid", "gclid"}));
+}
+
+TEST(QueryFilterTest, Prefixes) {
+    auto filter = query_filter::allow({"utm_*", "id"});
+    EXPECT_TRUE(filter.selects("utm_"));
+    EXPECT_TRUE(filter.selects("utm_source"));
+    EXPECT_TRUE(filter.selects("id"));
+    EXPECT_FALSE(filter.selects("utm"));
+    EXPECT_FALSE(filter.selects("ids"));
+    EXPECT_FALSE(query_filter::deny({"*"}).selects(""));
+}
+
+TEST(QueryRewriterTest, Strip) {
+    auto rewriter = tracking();
+    std::string out;
+
+    struct {
+        std::string_view in;
+        std::string_view out;
+        std::size_t changed;
+    } tests[] = {
+        {"", "", 0},
+        {"a=1", "a=1", 0},
+        {"utm_source=x", "", 1},
+        {"utm_source=x&a=1", "a=1", 1},
+        {"a=1&utm_source=x", "a=1", 1},
+        {"a=%41+b;utm_medium=y&fbclid=1&b=a%3Db&gclid", "a=%41+b&b=a%3Db", 3},
+        {"utm%5Fsource=x&utm+x=1&b=2", "utm+x=1&b=2", 1},
+        {"a=1&&b=2;", "a=1&&b=2;", 0},
+        {"%zz=1&fbclid=2", "%zz=1", 1},
+    };
+    for (const auto& test : tests) {
+        EXPECT_EQ(rewriter.rewrite(test.in, &out), test.changed) << test.in;
+        EXPECT_EQ(out, test.out) << test.in;
+
+        std::string in_place(test.in);
+        EXPECT_EQ(rewriter.rewrite(&in_place), test.changed) << test.in;
+        EXPECT_EQ(in_place, test.out) << test.in;
+    }
+}
+
+TEST(QueryRewriterTest, Rename) {
+    auto rewriter = tracking();
+    rewriter.rename("q", "query");
+    rewriter.rename("page number", "p");
+
+    std::string in = "page+number=2&q=a+b&utm_id=3&page%20number=4";
+    EXPECT_EQ(rewriter.rewrite(&in), 4u);
+    EXPECT_EQ(in, "p=2&query=a+b&p=4");
+
+    // Renames that don't grow keys run in place
+    query_rewriter shrink;
+    shrink.rename("long", "l");
+    in = "long=1;x=2;long=3";
+    auto data = in.data();
+    EXPECT_EQ(shrink.rewrite(&in), 2u);
+    EXPECT_EQ(in, "l=1;x=2;l=3");
+    EXPECT_EQ(in.data(), data);
+}
+
+TEST(QueryRewriterTest, Query) {
+    batteries::net::query query("b=1&utm_source=x&a=%20");
+    EXPECT_EQ(query.size(), 3u);
+    EXPECT_EQ(query.rewrite(tracking()).value(), 1u);
+    EXPECT_EQ(query.raw_query(), "b=1&a=%20");
+    EXPECT_EQ(query.values(),
+              (batteries::net::query_values{{"b", "1"}, {"a", " "}}));
+
+    query.add("utm_term", "z");
+    EXPECT_EQ(query.rewrite(tracking()).value(), 1u);
+    EXPECT_EQ(query.to_string(), "?b=1&a=%20");
+    EXPECT_EQ(query.rewrite(tracking()).value(), 0u);
+
+    // Appended to afterwards like a parsed query
+    query.add("c", "2");
+    EXPECT_EQ(query.raw_query(), "b=1&a=%20&c=2");
+
+    // Removing every parameter leaves an empty query
+    batteries::net::query tracked("utm_source=x&fbclid=y");
+    EXPECT_EQ(tracked.rewrite(tracking()).value(), 2u);
+    EXPECT_TRUE(tracked.empty());
+    tracked.add("a", "1");
+    EXPECT_EQ(tracked.raw_query(), "a=1");
+}
+
+TEST(QueryRewriterTest, MalformedQuery) {
+    // The rewritten query is still malformed, like the parsed one
+    batteries::net::query query;
+    EXPECT_TRUE(query.parse("%zz=1&fbclid=2"));
+    auto changed = query.rewrite(tracking());
+    EXPECT_EQ(changed.error().error_code(),
+              batteries::net::make_error_code(
+                  batteries::net::url_error_code::escape_error));
+    EXPECT_EQ(query.raw_query(), "%zz=1");
+
+    // It is rebuilt rather than appended to
+    query.add("a", "1");
+    EXPECT_EQ(query.raw_query(), "a=1");
+}
+
+} // namespace
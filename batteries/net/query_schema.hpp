@@ -0,0 +1,315 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "base.hpp"
+#include "internal/escape.hpp"
+#include "internal/parse.hpp"
+
+namespace batteries {
+
+namespace net {
+
+// What query_schema::decode does with a key that isn't in the schema
+enum class unknown_key_policy : uint8_t {
+    ignore,
+    reject,
+};
+
+// What query_schema::decode does with a key that appears more than once
+enum class duplicate_key_policy : uint8_t {
+    keep_first,
+    keep_last,
+    reject,
+};
+
+struct query_schema_policy {
+    unknown_key_policy unknown = unknown_key_policy::ignore;
+    duplicate_key_policy duplicates = duplicate_key_policy::reject;
+};
+
+/**
+ * A query_field binds a decoded query key to a member of S. The member is a
+ * std::string, a bool or an arithmetic type.
+ */
+template <typename S, typename T> struct query_field {
+    std::string_view key;
+    T S::*member;
+};
+
+template <typename S, typename T>
+constexpr query_field<S, T> field(std::string_view key, T S::*member) {
+    return query_field<S, T>{key, member};
+}
+
+namespace detail {
+
+// A seeded 32-bit FNV-1a with a final mix so that different seeds spread the
+// same keys differently.
+constexpr uint32_t schema_hash(std::string_view key, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ (seed * 0x9e3779b9u);
+    for (char c : key) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x7feb352du;
+    hash ^= hash >> 15;
+    return hash;
+}
+
+// A power of two large enough that a collision-free seed is found after a
+// few tries.
+constexpr std::size_t schema_table_size(std::size_t n) {
+    std::size_t size = 1;
+    while (size < 4 * n || size < n * n / 4) {
+        size *= 2;
+    }
+    return size;
+}
+
+// Decodes the query component s into out, which has room for s.length()
+// bytes, with the two passes of internal::unescape.
+inline error unescape_component(std::string_view s, char* out,
+                                std::size_t* length) {
+    constexpr auto mode = internal::encoding::encodeQueryComponent;
+    bool changes;
+    auto err = internal::check_escapes(s, mode, &changes);
+    if (err) {
+        return err;
+    }
+    *length = internal::decode_escapes(s, mode, out) - out;
+    return errors::no_error;
+}
+
+template <typename T> error assign_value(std::string_view raw, T* value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        // Decoded straight into the member
+        value->resize(raw.length());
+        std::size_t length = 0;
+        auto err = unescape_component(raw, &(*value)[0], &length);
+        value->resize(length);
+        return err;
+    } else {
+        if (raw.find_first_of("%+") == raw.npos) {
+            return internal::parse_value(raw, value);
+        }
+        std::array<char, 64> buffer;
+        std::string long_buffer;
+        char* out = buffer.data();
+        if (raw.length() > buffer.size()) {
+            long_buffer.resize(raw.length());
+            out = &long_buffer[0];
+        }
+        std::size_t length = 0;
+        auto err = unescape_component(raw, out, &length);
+        if (err) {
+            return err;
+        }
+        return internal::parse_value(std::string_view(out, length), value);
+    }
+}
+
+} // namespace detail
+
+/**
+ * A query_schema decodes a raw query straight into the members of a struct.
+ * Declared constexpr, the keys are compiled into a perfect hash table so
+ * that every pair of the query costs one hash and one comparison:
+ *
+ *   struct page { int64_t limit = 20; std::string cursor; bool desc; };
+ *   constexpr auto page_schema = make_query_schema(
+ *       field("limit", &page::limit), field("cursor", &page::cursor),
+ *       field("desc", &page::desc));
+ *   page p;
+ *   auto err = page_schema.decode("limit=50&desc=true", &p);
+ *
+ * Members whose key isn't in the query keep their value.
+ */
+template <typename S, typename... T> class query_schema {
+
+  public:
+    static constexpr std::size_t size = sizeof...(T);
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    static_assert(size <= 64, "query schemas have at most 64 keys");
+
+    constexpr explicit query_schema(query_field<S, T>... fields)
+        : fields_(fields...)
+        , keys_{fields.key...}
+        , seed_(0)
+        , perfect_(false)
+        , slots_() {
+        // Later duplicates of a key can't be looked up
+        for (uint32_t seed = 0; seed < (1u << 16) && !perfect_; seed++) {
+            perfect_ = true;
+            for (auto& slot : slots_) {
+                slot = 0;
+            }
+            for (std::size_t i = 0; i < size && perfect_; i++) {
+                auto& slot = slots_[slot_of(keys_[i], seed)];
+                if (slot == 0) {
+                    slot = static_cast<uint8_t>(i + 1);
+                } else if (keys_[slot - 1] != keys_[i]) {
+                    perfect_ = false;
+                }
+            }
+            seed_ = seed;
+        }
+    }
+
+    /**
+     * @brief find returns the index of the field bound to key.
+     * @param key The decoded key.
+     * @returns The index of the field, or npos if key isn't in the schema.
+     */
+    constexpr std::size_t find(std::string_view key) const {
+        if (!perfect_) {
+            for (std::size_t i = 0; i < size; i++) {
+                if (keys_[i] == key) {
+                    return i;
+                }
+            }
+            return npos;
+        }
+        auto slot = slots_[slot_of(key, seed_)];
+        return slot != 0 && keys_[slot - 1] == key ? slot - 1 : npos;
+    }
+
+    /**
+     * @brief decode decodes a raw query into out in one pass. Keys and values
+     * are unescaped into the members or into a stack buffer and numbers are
+     * converted with std::from_chars.
+     * @param query The raw query without the leading '?'.
+     * @param out The struct the values are decoded into.
+     * @param policy What to do with unknown and duplicate keys.
+     * @returns The errors of decode_query and internal::parse_value, or
+     * url_error_code::unknown_key or duplicate_key under a rejecting policy.
+     * Errors of a pair carry its offset in query and the start of the pair
+     * or key as context, without allocating. Decoding stops at the first
+     * error.
+     */
+    error decode(std::string_view query, S* out,
+                 const query_schema_policy& policy = {}) const {
+        uint64_t seen = 0;
+        std::array<char, 64> key_buffer;
+        std::string long_key;
+        const char* begin = query.data();
+
+        // Like decode_query an empty query or pair is malformed
+        bool done = false;
+        while (!done) {
+            auto separator = query.find_first_of("&;");
+            auto pair = query.substr(0, separator);
+            if (separator == query.npos) {
+                done = true;
+            } else {
+                query.remove_prefix(separator + 1);
+            }
+            std::size_t offset = pair.data() - begin;
+
+            auto equals = pair.find('=');
+            if (pair.empty() || equals == pair.npos ||
+                pair.find('=', equals + 1) != pair.npos) {
+                return error(url_error_code::parse_error, offset, pair);
+            }
+
+            auto key = pair.substr(0, equals);
+            if (key.find_first_of("%+") != key.npos) {
+                char* buffer = key_buffer.data();
+                if (key.length() > key_buffer.size()) {
+                    long_key.resize(key.length());
+                    buffer = &long_key[0];
+                }
+                std::size_t length = 0;
+                auto err = detail::unescape_component(key, buffer, &length);
+                if (err) {
+                    return err;
+                }
+                key = std::string_view(buffer, length);
+            }
+
+            auto index = find(key);
+            if (index == npos) {
+                if (policy.unknown == unknown_key_policy::reject) {
+                    return error(url_error_code::unknown_key, offset, key);
+                }
+                continue;
+            }
+            uint64_t bit = uint64_t(1) << index;
+            if (seen & bit) {
+                if (policy.duplicates == duplicate_key_policy::reject) {
+                    return error(url_error_code::duplicate_key, offset,
+                                 key);
+                }
+                if (policy.duplicates == duplicate_key_policy::keep_first) {
+                    continue;
+                }
+            }
+            seen |= bit;
+
+            auto err = assign(index, pair.substr(equals + 1), out,
+                              std::index_sequence_for<T...>());
+            if (err) {
+                return err;
+            }
+        }
+        return errors::no_error;
+    }
+
+  private:
+    static constexpr std::size_t table_size = detail::schema_table_size(size);
+
+    static constexpr std::size_t slot_of(std::string_view key,
+                                         uint32_t seed) {
+        return detail::schema_hash(key, seed) & (table_size - 1);
+    }
+
+    template <std::size_t... I>
+    error assign(std::size_t index, std::string_view raw, S* out,
+                 std::index_sequence<I...>) const {
+        error err;
+        ((index == I ? (err = detail::assign_value(
+                            raw, &(out->*std::get<I>(fields_).member)),
+                        true)
+                     : false) ||
+         ...);
+        return err;
+    }
+
+  private:
+    std::tuple<query_field<S, T>...> fields_;
+    std::array<std::string_view, size> keys_;
+    uint32_t seed_;
+    bool perfect_;
+    // The index + 1 of the field whose key hashes to each slot, 0 if none
+    std::array<uint8_t, table_size> slots_;
+};
+
+template <typename S, typename... T>
+constexpr query_schema<S, T...>
+make_query_schema(query_field<S, T>... fields) {
+    return query_schema<S, T...>(fields...);
+}
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,155 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "query_schema.hpp"
+
+#include <string>
+
+#include <absl/strings/str_cat.h>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using batteries::net::duplicate_key_policy;
+using batteries::net::field;
+using batteries::net::make_error_code;
+using batteries::net::make_query_schema;
+using batteries::net::query_schema_policy;
+using batteries::net::unknown_key_policy;
+using batteries::net::url_error_code;
+
+struct page {
+    int64_t limit = 20;
+    uint32_t offset = 0;
+    double ratio = 1;
+    bool desc = false;
+    std::string cursor;
+};
+
+constexpr auto page_schema = make_query_schema(
+    field("limit", &page::limit), field("offset", &page::offset),
+    field("ratio", &page::ratio), field("desc", &page::desc),
+    field("cursor", &page::cursor));
+
+static_assert(page_schema.find("limit") == 0);
+static_assert(page_schema.find("cursor") == 4);
+static_assert(page_schema.find("cursors") == page_schema.npos);
+
+TEST(QuerySchemaTest, Decode) {
+    page p;
+    EXPECT_FALSE(page_schema.decode(
+        "limit=50&cursor=a%2Fb+c;desc=true&ratio=0.25&other=x", &p));
+    EXPECT_EQ(p.limit, 50);
+    EXPECT_EQ(p.offset, 0u);
+    EXPECT_EQ(p.ratio, 0.25);
+    EXPECT_TRUE(p.desc);
+    EXPECT_EQ(p.cursor, "a/b c");
+
+    // Escaped keys and numbers
+    page q;
+    EXPECT_FALSE(page_schema.decode("li%6Dit=%31%32&offset=7", &q));
+    EXPECT_EQ(q.limit, 12);
+    EXPECT_EQ(q.offset, 7u);
+}
+
+TEST(QuerySchemaTest, Errors) {
+    page p;
+    EXPECT_EQ(page_schema.decode("limit=1&&desc=1", &p).error_code(),
+              make_error_code(url_error_code::parse_error));
+    EXPECT_EQ(page_schema.decode("limit", &p).error_code(),
+              make_error_code(url_error_code::parse_error));
+    // Rejected like decode_query does
+    EXPECT_EQ(page_schema.decode("", &p).error_code(),
+              make_error_code(url_error_code::parse_error));
+    EXPECT_EQ(page_schema.decode("limit=1&", &p).error_code(),
+              make_error_code(url_error_code::parse_error));
+    EXPECT_EQ(page_schema.decode("limit=1;", &p).error_code(),
+              make_error_code(url_error_code::parse_error));
+    EXPECT_EQ(page_schema.decode("limit=x", &p).error_code(),
+              make_error_code(url_error_code::conversion_error));
+    EXPECT_EQ(page_schema.decode("offset=-1", &p).error_code(),
+              make_error_code(url_error_code::conversion_error));
+    EXPECT_EQ(page_schema.decode("offset=99999999999", &p).error_code(),
+              make_error_code(url_error_code::out_of_range));
+    EXPECT_EQ(page_schema.decode("cursor=%zz", &p).error_code(),
+              make_error_code(url_error_code::escape_error));
+    EXPECT_EQ(page_schema.decode("cursor=%4", &p).error_code(),
+              make_error_code(url_error_code::range_error));
+}
+
+TEST(QuerySchemaTest, Policies) {
+    page p;
+    EXPECT_EQ(page_schema.decode("limit=1&limit=2", &p).error_code(),
+              make_error_code(url_error_code::duplicate_key));
+
+    query_schema_policy policy;
+    policy.duplicates = duplicate_key_policy::keep_first;
+    EXPECT_FALSE(page_schema.decode("limit=1&limit=2", &p, policy));
+    EXPECT_EQ(p.limit, 1);
+    policy.duplicates = duplicate_key_policy::keep_last;
+    EXPECT_FALSE(page_schema.decode("limit=1&limit=2", &p, policy));
+    EXPECT_EQ(p.limit, 2);
+
+    EXPECT_FALSE(page_schema.decode("utm_source=x", &p));
+    policy.unknown = unknown_key_policy::reject;
+    EXPECT_EQ(page_schema.decode("utm_source=x", &p, policy).error_code(),
+              make_error_code(url_error_code::unknown_key));
+}
+
+TEST(QuerySchemaTest, ErrorContext) {
+    // Errors point into the query and keep a bounded context
+    page p;
+    std::string long_key(1000, 'k');
+    auto err = page_schema.decode("limit=1&" + long_key + "==", &p);
+    EXPECT_EQ(err.offset(), 8u);
+    EXPECT_LT(err.message().length(), 100u);
+
+    query_schema_policy policy;
+    policy.unknown = unknown_key_policy::reject;
+    err = page_schema.decode("limit=1&" + long_key + "=x", &p, policy);
+    EXPECT_EQ(err.error_code(), make_error_code(url_error_code::unknown_key));
+    EXPECT_EQ(err.offset(), 8u);
+    EXPECT_LT(err.message().length(), 100u);
+
+    err = page_schema.decode("desc=1&limit=1&limit=2", &p);
+    EXPECT_EQ(err.error_code(),
+              make_error_code(url_error_code::duplicate_key));
+    EXPECT_EQ(err.offset(), 15u);
+}
+
+struct wide {
+    int a;
+};
+
+TEST(QuerySchemaTest, PerfectHash) {
+    // Every key of a larger schema finds its own field
+    constexpr auto schema = make_query_schema(
+        field("k0", &wide::a), field("k1", &wide::a), field("k2", &wide::a),
+        field("k3", &wide::a), field("k4", &wide::a), field("k5", &wide::a),
+        field("k6", &wide::a), field("k7", &wide::a), field("k8", &wide::a),
+        field("k9", &wide::a), field("k10", &wide::a),
+        field("k11", &wide::a), field("k12", &wide::a),
+        field("k13", &wide::a), field("k14", &wide::a),
+        field("k15", &wide::a), field("k16", &wide::a),
+        field("k17", &wide::a), field("k18", &wide::a),
+        field("k19", &wide::a));
+    for (std::size_t i = 0; i < schema.size; i++) {
+        EXPECT_EQ(schema.find(absl::StrCat("k", i)), i);
+    }
+    EXPECT_EQ(schema.find("k20"), schema.npos);
+}
+
+} // namespace
@@ -15,6 +15,10 @@
 #include "batteries/errors/error.hpp"
 #include "query.hpp"
 
+#include <thread>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
 #include <absl/strings/str_replace.h>
 
 #include "gmock/gmock.h"
@@ -37,12 +41,9 @@ class MultipleParseQueryTests
     : public ::testing::TestWithParam<ParseQueryTest> {};
 
 TEST_P(MultipleParseQueryTests, EscapeQuery) {
-    query_map map;
-    error err;
-    std::tie(map, err) =
-        batteries::net::internal::parse_query(GetParam().query);
-    EXPECT_EQ(GetParam().err, err);
-    EXPECT_EQ(GetParam().map, map);
+    auto map = batteries::net::internal::parse_query(GetParam().query);
+    EXPECT_EQ(GetParam().err, map.error());
+    EXPECT_EQ(GetParam().map, map.value_or(query_map()));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -94,6 +95,7 @@ TEST_P(MultipleBuildQueryTests, EscapeQuery) {
 INSTANTIATE_TEST_SUITE_P(
     QueryTests, MultipleBuildQueryTests,
     ::testing::Values(
+        BuildQueryTest{"", query_map{}},
         BuildQueryTest{"a=1&b=2", query_map{{"a", "1"}, {"b", "2"}}},
         BuildQueryTest{"a=1&a=2&a=banana",
                        query_map{{"a", "1"}, {"a", "2"}, {"a", "banana"}}},
@@ -140,4 +142,523 @@ INSTANTIATE_TEST_SUITE_P(
                                                        {"ba", "2"},
                                                        {"ba", "banana"}}}));
 
+// Test storage
+
+TEST(QueryStorageTest, KeepsOrder) {
+    batteries::net::query query("z=1&a=2&z=3&m=4");
+    EXPECT_EQ(query.values(),
+              (batteries::net::query_values{
+                  {"z", "1"}, {"a", "2"}, {"z", "3"}, {"m", "4"}}));
+    EXPECT_EQ(query.get("z"),
+              (batteries::net::query_values{{"z", "1"}, {"z", "3"}}));
+    EXPECT_EQ(query.get("a"), (batteries::net::query_values{{"a", "2"}}));
+    EXPECT_TRUE(query.get("b").empty());
+
+    query.set("z", "5");
+    query.add("b", "6");
+    EXPECT_EQ(query.to_string(), "?z=5&a=2&m=4&b=6");
+    query.del("a");
+    EXPECT_EQ(query.to_string(), "?z=5&m=4&b=6");
+    query.set("c", "7");
+    EXPECT_EQ(query.to_string(), "?z=5&m=4&b=6&c=7");
+}
+
+TEST(QueryStorageTest, Indexed) {
+    const std::size_t count = 3 * batteries::net::query::index_threshold;
+    batteries::net::query query;
+    batteries::net::query_values expected;
+    for (std::size_t i = 0; i < count; i++) {
+        auto key = absl::StrCat("k", i % 10);
+        auto value = absl::StrCat(i);
+        query.add(key, value);
+        expected.emplace_back(key, value);
+    }
+    EXPECT_EQ(query.size(), count);
+    EXPECT_EQ(query.values(), expected);
+    EXPECT_EQ(query.get("k3").size(), 5u);
+    EXPECT_EQ(query.get("k3")[1], (batteries::net::query_value{"k3", "13"}));
+
+    query.set("k3", "x");
+    EXPECT_EQ(query.get("k3"), (batteries::net::query_values{{"k3", "x"}}));
+    EXPECT_EQ(query.values()[3], (batteries::net::query_value{"k3", "x"}));
+    EXPECT_EQ(query.values()[4], (batteries::net::query_value{"k4", "4"}));
+
+    for (int i = 0; i < 10; i++) {
+        if (i != 5) {
+            query.del(absl::StrCat("k", i));
+        }
+    }
+    EXPECT_EQ(query.get("k5").size(), 5u);
+    EXPECT_EQ(query.to_string(), "?k5=5&k5=15&k5=25&k5=35&k5=45");
+
+    batteries::net::query parsed(query.to_string().substr(1));
+    EXPECT_EQ(parsed, query);
+}
+
+TEST(QueryStorageTest, Equality) {
+    EXPECT_EQ(batteries::net::query("a=1&b=2"),
+              batteries::net::query("b=2&a=1"));
+    EXPECT_NE(batteries::net::query("a=1&a=2"),
+              batteries::net::query("a=2&a=1"));
+    EXPECT_NE(batteries::net::query("a=1"), batteries::net::query("a=1&a=1"));
+}
+
+// Test serialization
+
+TEST(QuerySerializeTest, ExactLength) {
+    using batteries::net::internal::encoding;
+    batteries::net::query_values values{
+        {"a b", "<key: 0x90>"}, {"", ""}, {"\xff\x01", "~-._"}, {"k", "v"}};
+    auto built = batteries::net::internal::build_query(values.cbegin(),
+                                                       values.cend());
+    EXPECT_EQ(built, "a+b=%3Ckey%3A+0x90%3E&=&%FF%01=~-._&k=v");
+    EXPECT_EQ(batteries::net::internal::query_length(values.cbegin(),
+                                                     values.cend()),
+              built.length());
+
+    for (auto mode :
+         {encoding::encodePath, encoding::encodePathSegment,
+          encoding::encodeHost, encoding::encodeZone,
+          encoding::encodeUserPassword, encoding::encodeQueryComponent,
+          encoding::encodeFragment}) {
+        std::string all;
+        for (int c = 0; c < 256; c++) {
+            all.push_back(static_cast<char>(c));
+        }
+        EXPECT_EQ(batteries::net::internal::escaped_length(all, mode),
+                  batteries::net::internal::escape(all, mode).length());
+    }
+}
+
+TEST(QuerySerializeTest, Format) {
+    batteries::net::query_values values{
+        {"z", "1"}, {"a", "2"}, {"z", "3"}, {"m", "4"}};
+    std::string dest = "prefix?";
+    batteries::net::internal::append_query(&dest, values.cbegin(),
+                                           values.cend(), {';', true});
+    EXPECT_EQ(dest, "prefix?a=2;m=4;z=1;z=3");
+
+    batteries::net::query query(values);
+    EXPECT_EQ(query.to_string(), "?z=1&a=2&z=3&m=4");
+    EXPECT_EQ(query.to_string({'&', true}), "?a=2&m=4&z=1&z=3");
+    EXPECT_EQ(query.to_string({';', false}), "?z=1;a=2;z=3;m=4");
+
+    batteries::net::query parsed("b=1;a=2");
+    EXPECT_EQ(parsed.to_string(), "?b=1;a=2");
+    EXPECT_EQ(parsed.to_string({'&', true}), "?a=2&b=1");
+
+    batteries::net::query empty;
+    EXPECT_EQ(empty.to_string({'&', true}), "");
+    empty.set_force_query(true);
+    EXPECT_EQ(empty.to_string({'&', true}), "?");
+    dest.clear();
+    empty.append_to(&dest);
+    EXPECT_EQ(dest, "?");
+}
+
+// Test appending
+
+TEST(QueryAppendTest, AppendsToRawQuery) {
+    // A rebuilt query would re-escape %41 as A
+    batteries::net::query query("a=%41;b=1");
+    query.add("c d", "e&f");
+    EXPECT_EQ(query.raw_query(), "a=%41;b=1&c+d=e%26f");
+    EXPECT_EQ(query.get("c d"),
+              (batteries::net::query_values{{"c d", "e&f"}}));
+    query.add("g", "");
+    EXPECT_EQ(query.to_string(), "?a=%41;b=1&c+d=e%26f&g=");
+    EXPECT_EQ(query.size(), 4u);
+
+    // Rebuilt once modified otherwise, then appended to again
+    query.del("b");
+    query.add("h", "1");
+    EXPECT_EQ(query.raw_query(), "a=A&c+d=e%26f&g=&h=1");
+    query.add("i", "2");
+    EXPECT_EQ(query.raw_query(), "a=A&c+d=e%26f&g=&h=1&i=2");
+
+    batteries::net::query empty;
+    empty.add("a", "1");
+    EXPECT_EQ(empty.raw_query(), "a=1");
+}
+
+TEST(QueryAppendTest, Undecoded) {
+    std::string raw;
+    batteries::net::query_values expected;
+    for (int i = 0; i < 200; i++) {
+        absl::StrAppend(&raw, i == 0 ? "" : "&", "k", i, "=%76", i);
+        expected.emplace_back(absl::StrCat("k", i), absl::StrCat("v", i));
+    }
+    ASSERT_GE(raw.length(), batteries::net::internal::query_index_min_length);
+
+    batteries::net::query query(raw);
+    query.add("x", "1 2");
+    query.set("y", "3");
+    expected.emplace_back("x", "1 2");
+    expected.emplace_back("y", "3");
+    EXPECT_EQ(query.raw_query(), absl::StrCat(raw, "&x=1+2&y=3"));
+    EXPECT_EQ(query.values(), expected);
+}
+
+TEST(QueryAppendTest, AppendsInPlace) {
+    // Each rebuild writes a new raw query, while appending only moves it
+    // when the string grows, a logarithmic number of times
+    std::string raw;
+    for (int i = 0; i < 500; i++) {
+        absl::StrAppend(&raw, i == 0 ? "" : "&", "k", i, "=v", i);
+    }
+    auto moves = [&raw](bool rebuild) {
+        batteries::net::query query(raw);
+        const char* buffer = query.raw_query().data();
+        int count = 0;
+        for (int i = 0; i < 1000; i++) {
+            if (rebuild) {
+                query.set("k0", absl::StrCat(i));
+            } else {
+                query.add(absl::StrCat("x", i), "1");
+            }
+            auto data = query.raw_query().data();
+            if (data != buffer) {
+                buffer = data;
+                count++;
+            }
+        }
+        return count;
+    };
+    EXPECT_LE(moves(false), 8);
+    EXPECT_EQ(moves(true), 1000);
+}
+
+TEST(QueryAppendTest, InvalidQueryIsRebuilt) {
+    batteries::net::query query;
+    EXPECT_TRUE(query.parse("a=1&b=%zz"));
+    query.add("c", "2");
+    EXPECT_EQ(query.raw_query(), "a=1&c=2");
+}
+
+// Test typed accessors
+
+TEST(QueryTypedTest, GetAs) {
+    using batteries::net::url_error_code;
+    batteries::net::query query(
+        "limit=25&offset=-3&ratio=0.5&on=true&off=F&big=99999999999&bad=1x"
+        "&sp=%2042&ids=1&ids=2&ids=3");
+
+    auto limit = query.get_as<int64_t>("limit");
+    ASSERT_TRUE(limit);
+    EXPECT_FALSE(limit.error());
+    EXPECT_EQ(*limit, 25);
+    EXPECT_EQ(query.get_as<int>("offset").value_or(0), -3);
+    EXPECT_EQ(query.get_as<double>("ratio").value_or(0), 0.5);
+    EXPECT_EQ(query.get_as<bool>("on").value_or(false), true);
+    EXPECT_EQ(query.get_as<bool>("off").value_or(true), false);
+    EXPECT_EQ(query.get_as<int>("ids").value_or(0), 1);
+
+    // not_found doesn't hold the key, however long
+    auto missing = query.get_as<int>("a-key-longer-than-the-inline-context");
+    EXPECT_FALSE(missing);
+    EXPECT_EQ(missing.error().error_code(),
+              batteries::net::make_error_code(url_error_code::not_found));
+    EXPECT_EQ(missing.error().message().find("a-key"), std::string::npos);
+
+    EXPECT_EQ(query.get_as<int32_t>("big").error().error_code(),
+              batteries::net::make_error_code(url_error_code::out_of_range));
+    EXPECT_EQ(query.get_as<int64_t>("big").value_or(0), 99999999999);
+    EXPECT_EQ(
+        query.get_as<int>("bad").error().error_code(),
+        batteries::net::make_error_code(url_error_code::conversion_error));
+    EXPECT_EQ(
+        query.get_as<unsigned>("offset").error().error_code(),
+        batteries::net::make_error_code(url_error_code::conversion_error));
+    EXPECT_EQ(
+        query.get_as<int>("sp").error().error_code(),
+        batteries::net::make_error_code(url_error_code::conversion_error));
+    EXPECT_EQ(
+        query.get_as<bool>("limit").error().error_code(),
+        batteries::net::make_error_code(url_error_code::conversion_error));
+}
+
+TEST(QueryTypedTest, GetAllAs) {
+    using batteries::net::url_error_code;
+    batteries::net::query query("ids=1&x=y&ids=2&ids=3&n=4&n=z&n=6");
+
+    auto ids = query.get_all_as<uint16_t>("ids");
+    ASSERT_TRUE(ids);
+    EXPECT_EQ(*ids, (std::vector<uint16_t>{1, 2, 3}));
+
+    auto n = query.get_all_as<int>("n");
+    EXPECT_FALSE(n);
+    EXPECT_EQ(n.error().error_code(), batteries::net::make_error_code(
+                                          url_error_code::conversion_error));
+
+    auto missing = query.get_all_as<int>("missing");
+    ASSERT_TRUE(missing);
+    EXPECT_TRUE(missing->empty());
+}
+
+// Test cache keys
+
+TEST(QueryCacheKeyTest, Filter) {
+    auto allow = batteries::net::query_filter::allow({"a", "b c"});
+    EXPECT_TRUE(allow.selects("a"));
+    EXPECT_TRUE(allow.selects("b c"));
+    EXPECT_FALSE(allow.selects("b"));
+
+    auto deny = batteries::net::query_filter::deny({"a"});
+    EXPECT_FALSE(deny.selects("a"));
+    EXPECT_TRUE(deny.selects("b"));
+    EXPECT_TRUE(batteries::net::query_filter().selects("a"));
+}
+
+TEST(QueryCacheKeyTest, Canonical) {
+    auto filter = batteries::net::query_filter::deny({"utm_source", "sid"});
+    std::string buffer;
+
+    batteries::net::query query(
+        "z=1&utm_source=x&b+c=%7e&a=2&z=0&sid=9&a=1");
+    EXPECT_EQ(query.cache_key(filter, &buffer), "a=2&a=1&b+c=~&z=1&z=0");
+
+    // Same parameters in another order and escaping
+    batteries::net::query same("a=2&b%20c=~&sid=1&z=1&a=1&z=0");
+    EXPECT_EQ(same.cache_key(filter, &buffer), "a=2&a=1&b+c=~&z=1&z=0");
+    std::string other;
+    EXPECT_EQ(query.cache_key_hash(filter, &buffer),
+              same.cache_key_hash(filter, &other));
+    EXPECT_EQ(query.cache_key_hash128(filter, &buffer),
+              same.cache_key_hash128(filter, &other));
+
+    // Values of the same key keep their order
+    batteries::net::query swapped("a=1&a=2");
+    EXPECT_NE(swapped.cache_key_hash(filter, &buffer),
+              query.cache_key_hash(filter, &other));
+
+    auto allow = batteries::net::query_filter::allow({"z"});
+    EXPECT_EQ(query.cache_key(allow, &buffer), "z=1&z=0");
+    EXPECT_EQ(batteries::net::query().cache_key(allow, &buffer), "");
+
+    // FNV-1a of the empty string
+    EXPECT_EQ(batteries::net::query().cache_key_hash(allow, &buffer),
+              0xcbf29ce484222325ull);
+    EXPECT_EQ(batteries::net::query("z=a").cache_key_hash(allow, &buffer),
+              0xcf500319884a8563ull);
+}
+
+// Test lazy decoding
+
+TEST(QueryLazyTest, FindRaw) {
+    batteries::net::query query;
+    EXPECT_FALSE(query.parse("a=1&b+c=%20x&a%3D=2;d="));
+    EXPECT_EQ(query.find_raw("a"), std::optional<std::string_view>("1"));
+    EXPECT_EQ(query.find_raw("b c"), std::optional<std::string_view>("%20x"));
+    EXPECT_EQ(query.find_raw("a="), std::optional<std::string_view>("2"));
+    EXPECT_EQ(query.find_raw("d"), std::optional<std::string_view>(""));
+    EXPECT_EQ(query.find_raw("b"), std::nullopt);
+    EXPECT_EQ(query.find_raw("a%3D"), std::nullopt);
+
+    // Decoding on first access gives the same values
+    EXPECT_EQ(query.size(), 4u);
+    EXPECT_EQ(query.get("b c"),
+              (batteries::net::query_values{{"b c", " x"}}));
+
+    query.set("a", "x y");
+    EXPECT_EQ(query.find_raw("a"), std::optional<std::string_view>("x+y"));
+}
+
+TEST(QueryLazyTest, ErrorsAreEager) {
+    using batteries::net::url_error_code;
+    batteries::net::query query;
+
+    EXPECT_EQ(query.parse("a=1&b=%zz").error_code(),
+              batteries::net::make_error_code(url_error_code::escape_error));
+    EXPECT_EQ(query.values(), (batteries::net::query_values{{"a", "1"}}));
+
+    EXPECT_EQ(query.parse("a=1&b=%2").error_code(),
+              batteries::net::make_error_code(url_error_code::range_error));
+    EXPECT_EQ(query.parse("a=1&&b=%zz").error_code(),
+              batteries::net::make_error_code(url_error_code::parse_error));
+    EXPECT_TRUE(query.empty());
+    EXPECT_EQ(query.find_raw("a"), std::optional<std::string_view>("1"));
+
+    // Every parse error matches parse_query
+    for (std::string_view raw : {"a=1", "a", "=", "a=%", "%4=a", "a=%41%",
+                                 "a=b=c", "a=1;", "%zz=1&&"}) {
+        auto map = batteries::net::internal::parse_query(raw);
+        EXPECT_EQ(query.parse(raw).error_code(), map.error().error_code())
+            << raw;
+        EXPECT_EQ(query.size(),
+                  map.value_or(batteries::net::internal::query_map()).size())
+            << raw;
+    }
+}
+
+TEST(QueryLazyTest, SharedAfterDecode) {
+    std::string raw;
+    for (int i = 0; i < 2000; i++) {
+        absl::StrAppend(&raw, i == 0 ? "" : "&", "k", i, "=v%20", i);
+    }
+    batteries::net::query query;
+    ASSERT_FALSE(query.parse(raw));
+    query.add("k", "v");
+
+    // Once decoded and rebuilt, const members only read
+    query.decode();
+    query.raw_query();
+    const auto& shared = query;
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; t++) {
+        readers.emplace_back([&shared, t] {
+            for (int i = t; i < 2000; i += 4) {
+                auto key = absl::StrCat("k", i);
+                EXPECT_EQ(shared.get(key).front().second,
+                          absl::StrCat("v ", i));
+            }
+            EXPECT_EQ(shared.size(), 2001u);
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+}
+
+TEST(QueryLazyTest, SharedBeforeDecode) {
+    std::string raw;
+    for (int i = 0; i < 2000; i++) {
+        absl::StrAppend(&raw, i == 0 ? "" : "&", "k", i, "=v%20", i);
+    }
+
+    // Readers race to decode a parsed query and to rebuild a changed one
+    for (bool changed : {false, true}) {
+        batteries::net::query query;
+        ASSERT_FALSE(query.parse(raw));
+        if (changed) {
+            query.set("k0", "v 0");
+        }
+        const auto& shared = query;
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; t++) {
+            readers.emplace_back([&shared, changed, t] {
+                batteries::net::query copy = shared;
+                EXPECT_EQ(copy.size(), 2000u);
+                // The rebuilt raw query escapes spaces as '+'
+                EXPECT_EQ(shared.find_raw("k1999"),
+                          changed ? "v+1999" : "v%201999");
+                for (int i = t; i < 2000; i += 4) {
+                    auto key = absl::StrCat("k", i);
+                    EXPECT_EQ(shared.get(key).front().second,
+                              absl::StrCat("v ", i));
+                }
+            });
+        }
+        for (auto& reader : readers) {
+            reader.join();
+        }
+    }
+}
+
+TEST(QueryLazyTest, CopyAndMove) {
+    batteries::net::query query;
+    ASSERT_FALSE(query.parse("a=1&b=%20"));
+
+    batteries::net::query copy(query);
+    EXPECT_EQ(copy.get("b").front().second, " ");
+    EXPECT_EQ(query.raw_query(), "a=1&b=%20");
+
+    batteries::net::query moved(std::move(query));
+    EXPECT_EQ(moved.size(), 2u);
+    EXPECT_TRUE(query.empty());
+
+    query = moved;
+    query.add("c", "3");
+    EXPECT_EQ(query.raw_query(), "a=1&b=%20&c=3");
+    moved = std::move(query);
+    EXPECT_EQ(moved.get("c").front().second, "3");
+    EXPECT_EQ(moved, batteries::net::query("a=1&b=%20&c=3"));
+}
+
+// Test parse limits
+
+TEST(ParseLimitsTest, Query) {
+    using batteries::net::parse_limits;
+    using batteries::net::url_error_code;
+
+    const auto limit_exceeded =
+        batteries::net::make_error_code(url_error_code::limit_exceeded);
+    batteries::net::query query;
+
+    parse_limits limits;
+    EXPECT_FALSE(query.parse("a=1&b=%20&c=3", limits));
+    EXPECT_EQ(query.size(), 3u);
+
+    limits.max_length = 12;
+    EXPECT_EQ(query.parse("a=1&b=%20&c=3", limits).error_code(),
+              limit_exceeded);
+    EXPECT_TRUE(query.empty());
+    EXPECT_EQ(query.raw_query(), "");
+
+    limits = parse_limits();
+    limits.max_params = 2;
+    EXPECT_FALSE(query.parse("a=1;b=2", limits));
+    EXPECT_EQ(query.parse("a=1;b=2&c=3", limits).error_code(),
+              limit_exceeded);
+
+    limits = parse_limits();
+    limits.max_key_length = 3;
+    EXPECT_FALSE(query.parse("abc=12345", limits));
+    EXPECT_EQ(query.parse("abc=1&abcd=1", limits).error_code(),
+              limit_exceeded);
+
+    limits = parse_limits();
+    limits.max_value_length = 3;
+    EXPECT_FALSE(query.parse("abcdef=123", limits));
+    EXPECT_EQ(query.parse("a=123&b=1234", limits).error_code(),
+              limit_exceeded);
+
+    limits = parse_limits();
+    limits.max_escapes = 1;
+    EXPECT_FALSE(query.parse("a=%20", limits));
+    EXPECT_EQ(query.parse("a=%20&b=%20", limits).error_code(),
+              limit_exceeded);
+}
+
+TEST(ParseLimitsTest, FailsBeforeDecoding) {
+    batteries::net::parse_limits limits;
+    limits.max_params = 1000;
+
+    // Both the parse error and the limit are in the query, the limit wins
+    std::string hostile = "a==b";
+    for (int i = 0; i < 100000; i++) {
+        hostile += "&k=v";
+    }
+    auto map = batteries::net::internal::parse_query(hostile, limits);
+    EXPECT_EQ(map.error().error_code(),
+              batteries::net::make_error_code(
+                  batteries::net::url_error_code::limit_exceeded));
+    EXPECT_FALSE(map.has_value());
+}
+
+TEST(ParseLimitsTest, StopsAtTheLimit) {
+    // The check returns where a limit is crossed, so the parameters after
+    // the limit are never looked at: the later, longer key isn't reported
+    batteries::net::parse_limits limits;
+    limits.max_params = 1000;
+    limits.max_key_length = 64;
+    std::string hostile;
+    for (int i = 0; i < 2000; i++) {
+        hostile += "k=v&";
+    }
+    hostile += std::string(100000, 'k');
+
+    batteries::net::query query;
+    auto err = query.parse(hostile, limits);
+    EXPECT_EQ(err.error_code(),
+              batteries::net::make_error_code(
+                  batteries::net::url_error_code::limit_exceeded));
+    EXPECT_THAT(err.message(),
+                ::testing::HasSubstr("too many query parameters"));
+
+    // The length is checked before scanning at all
+    limits.max_length = 1000;
+    EXPECT_THAT(query.parse(hostile, limits).message(),
+                ::testing::HasSubstr("query too long"));
+}
+
 } // namespace
\ No newline at end of file
@@ -27,7 +27,7 @@ SOFTWARE.
 
 #include "url.hpp"
 
-#include <sstream>
+#include <algorithm>
 #include <tuple>
 
 #include <absl/strings/ascii.h>
@@ -42,11 +42,13 @@ namespace batteries {
 namespace net {
 
 std::tuple<std::string, error> unescape_path(std::string_view path) {
-    return internal::unescape(path, internal::encoding::encodePathSegment);
+    return internal::unescape(path, internal::encoding::encodePathSegment)
+        .to_tuple();
 }
 
 std::tuple<std::string, error> unescape_query(std::string_view query) {
-    return internal::unescape(query, internal::encoding::encodeQueryComponent);
+    return internal::unescape(query, internal::encoding::encodeQueryComponent)
+        .to_tuple();
 }
 
 std::string escape_path(std::string_view path) {
@@ -86,22 +88,48 @@ url::url(std::string rawurl)
     parse(rawurl);
 }
 
-error url::parse(std::string_view rawUrl) { return parse(rawUrl, false); }
-error url::parse_uri(std::string_view rawUrl) { return parse(rawUrl, true); }
+error url::parse(std::string_view rawUrl) {
+    return parse(rawUrl, false, parse_limits());
+}
+
+error url::parse(std::string_view rawUrl, const parse_limits& limits) {
+    return parse(rawUrl, false, limits);
+}
+
+error url::parse_uri(std::string_view rawUrl) {
+    return parse(rawUrl, true, parse_limits());
+}
 
-std::string url::scheme() const { return scheme_; }
+error url::parse_uri(std::string_view rawUrl, const parse_limits& limits) {
+    return parse(rawUrl, true, limits);
+}
+
+void url::reset() {
+    scheme_.clear();
+    opaque_.clear();
+    username_.clear();
+    password_.clear();
+    host_.clear();
+    port_.clear();
+    path_.clear();
+    raw_path_.clear();
+    query_.reset();
+    fragment_.clear();
+}
+
+const std::string& url::scheme() const { return scheme_; }
 
 void url::set_scheme(std::string scheme) { scheme_ = scheme; }
 
-std::string url::opaque() const { return opaque_; }
+const std::string& url::opaque() const { return opaque_; }
 
 void url::set_opaque(std::string opaque) { opaque_ = opaque; }
 
-std::string url::username() const { return username_; }
+const std::string& url::username() const { return username_; }
 
 void url::set_username(std::string username) { username_ = username; }
 
-std::string url::password() const { return password_; }
+const std::string& url::password() const { return password_; }
 
 void url::set_password(std::string password) { password_ = password; }
 
@@ -114,42 +142,55 @@ std::string url::host() const {
 }
 
 error url::set_host(std::string host) {
-    error err;
-    std::tie(host_, port_, err) = internal::parse_host(host);
-    return err;
+    auto parts = internal::parse_host(host);
+    if (!parts) {
+        host_.clear();
+        port_.clear();
+        return parts.error();
+    }
+    host_ = std::move(parts->hostname);
+    port_ = std::move(parts->port);
+    return errors::no_error;
 }
 
-std::string url::hostname() const { return host_; }
+const std::string& url::hostname() const { return host_; }
 
 void url::set_hostname(std::string hostname) { host_ = hostname; }
 
-std::string url::port() const { return port_; }
+const std::string& url::port() const { return port_; }
 
 void url::set_port(uint16_t port) { port_ = absl::StrCat(port); }
 
-std::string url::path() const { return path_; }
+const std::string& url::path() const { return path_; }
 
-std::string url::raw_path() const { return raw_path_; }
+const std::string& url::raw_path() const { return raw_path_; }
 
 error url::set_path(std::string_view path) {
-    error err;
-    std::tie(path_, err) =
-        internal::unescape(path, internal::encoding::encodePath);
-    if (err != errors::no_error) {
-        return err;
+    auto unescaped = internal::unescape(path, internal::encoding::encodePath);
+    if (!unescaped) {
+        path_.clear();
+        return unescaped.error();
     }
+    path_ = *std::move(unescaped);
 
     std::string escaped_path =
         internal::escape(path_, internal::encoding::encodePath);
-    if (path_ == escaped_path) {
+    if (path_ == escaped_path && escaped_path == path) {
         // Default encoding is fine.
-        raw_path_ = "";
+        raw_path_.clear();
     } else {
-        raw_path_ = (std::string)path;
+        raw_path_.assign(path);
     }
     return errors::no_error;
 }
 
+net::path_segments url::path_segments() const {
+    if (raw_path_.empty()) {
+        return net::path_segments(path_);
+    }
+    return net::path_segments(raw_path_);
+}
+
 net::query url::query() const { return query_; }
 
 void url::set_query(const net::query& query) { query_ = query; }
@@ -159,11 +200,10 @@ std::string url::fragment() const {
 }
 
 error url::set_fragment(std::string fragment) {
-    error err;
-    std::tie(fragment_, err) =
+    auto unescaped =
         internal::unescape(fragment, internal::encoding::encodeFragment);
-
-    return err;
+    fragment_ = std::move(unescaped).value_or(std::string());
+    return unescaped.error();
 }
 
 // Conveniance functions
@@ -172,40 +212,41 @@ bool url::has_username() const { return !username_.empty(); }
 bool url::has_password() const { return !password_.empty(); }
 
 std::string url::to_string() const {
-    std::ostringstream buf;
-
     if (path_ == "*") {
         return "*";
     }
+
+    std::string result;
     if (!scheme_.empty()) {
-        buf << scheme_ << ':';
+        absl::StrAppend(&result, scheme_, ":");
     }
     if (!opaque_.empty()) {
-        buf << opaque_;
+        result.append(opaque_);
     } else {
         if (!scheme_.empty() || !host_.empty() || !username_.empty()) {
             if (!host_.empty() || !path_.empty() || !username_.empty()) {
-                buf << "//";
+                result.append("//");
             }
             if (!username_.empty()) {
-                buf << username_;
+                result.append(username_);
                 if (!password_.empty()) {
-                    buf << ":" << password_;
+                    absl::StrAppend(&result, ":", password_);
                 }
-                buf << '@';
+                result.push_back('@');
             }
             if (!host_.empty()) {
-                buf << internal::escape(host_, internal::encoding::encodeHost);
+                internal::append_escaped(&result, host_,
+                                         internal::encoding::encodeHost);
                 if (!port_.empty()) {
-                    buf << ":" << port_;
+                    absl::StrAppend(&result, ":", port_);
                 }
             }
         }
         auto path = escaped_path();
         if (!path.empty() && path[0] != '/' && !host_.empty()) {
-            buf << '/';
+            result.push_back('/');
         }
-        if (buf.tellp() == 0) {
+        if (result.empty()) {
             // RFC 3986 §4.2
             // A path segment that contains a colon character (e.g.,
             // "this:that") cannot be used as the first segment of a
@@ -214,19 +255,77 @@ std::string url::to_string() const {
             // "./this:that") to make a relative- path reference.
             auto i = path.find(':');
             if (i != path.npos && path.substr(0, i).find('/') != path.npos) {
-                buf << "./";
+                result.append("./");
             }
         }
-        buf << path;
+        result.append(path);
     }
 
-    buf << query_.to_string();
+    query_.append_to(&result);
 
     if (!fragment_.empty()) {
-        buf << '#'
-            << internal::escape(fragment_, internal::encoding::encodeFragment);
+        result.push_back('#');
+        internal::append_escaped(&result, fragment_,
+                                 internal::encoding::encodeFragment);
+    }
+    return result;
+}
+
+void url::to_pieces(url_pieces* pieces) const {
+    pieces->clear();
+
+    if (path_ == "*") {
+        pieces->append(path_);
+        return;
+    }
+    if (!scheme_.empty()) {
+        pieces->append(scheme_);
+        pieces->append(":");
+    }
+    if (!opaque_.empty()) {
+        pieces->append(opaque_);
+    } else {
+        if (!scheme_.empty() || !host_.empty() || !username_.empty()) {
+            if (!host_.empty() || !path_.empty() || !username_.empty()) {
+                pieces->append("//");
+            }
+            if (!username_.empty()) {
+                pieces->append(username_);
+                if (!password_.empty()) {
+                    pieces->append(":");
+                    pieces->append(password_);
+                }
+                pieces->append("@");
+            }
+            if (!host_.empty()) {
+                pieces->append_escaped(host_, internal::encoding::encodeHost);
+                if (!port_.empty()) {
+                    pieces->append(":");
+                    pieces->append(port_);
+                }
+            }
+        }
+        // Escaping the path never adds or removes '/' or ':' so the checks
+        // made by to_string can be made on the unescaped path.
+        if (!path_.empty() && path_[0] != '/' && !host_.empty()) {
+            pieces->append("/");
+        }
+        if (pieces->empty()) {
+            // RFC 3986 §4.2, see to_string.
+            auto i = path_.find(':');
+            if (i != path_.npos && path_.substr(0, i).find('/') != path_.npos) {
+                pieces->append("./");
+            }
+        }
+        pieces->append_escaped(path_, internal::encoding::encodePath);
+    }
+
+    query_pieces(pieces);
+
+    if (!fragment_.empty()) {
+        pieces->append("#");
+        pieces->append_escaped(fragment_, internal::encoding::encodeFragment);
     }
-    return buf.str();
 }
 
 std::string url::request_uri() const {
@@ -241,11 +340,31 @@ std::string url::request_uri() const {
             result = scheme_ + ":" + result;
         }
     }
-    absl::StrAppend(&result, query_.to_string());
+    query_.append_to(&result);
 
     return result;
 }
 
+void url::request_uri_pieces(url_pieces* pieces) const {
+    pieces->clear();
+
+    if (opaque_.empty()) {
+        if (path_.empty()) {
+            pieces->append("/");
+        } else {
+            pieces->append_escaped(path_, internal::encoding::encodePath);
+        }
+    } else {
+        if (absl::StartsWith(opaque_, "//")) {
+            pieces->append(scheme_);
+            pieces->append(":");
+        }
+        pieces->append(opaque_);
+    }
+
+    query_pieces(pieces);
+}
+
 std::string url::escaped_path() const {
     return internal::escape(path_, internal::encoding::encodePath);
 }
@@ -265,17 +384,50 @@ bool url::operator==(const url& rhs) const {
 
 bool url::operator!=(const url& rhs) const { return !(*this == rhs); }
 
-error url::parse(std::string_view rawurl, bool viaRequest) {
+void url::query_pieces(url_pieces* pieces) const {
+    auto raw_query = query_.raw_query();
+    if (!raw_query.empty()) {
+        pieces->append("?");
+        pieces->append(raw_query);
+    } else if (query_.force_query()) {
+        pieces->append("?");
+    }
+}
+
+error url::parse(std::string_view rawurl, bool viaRequest,
+                 const parse_limits& limits) {
+    auto err = parse_url(rawurl, viaRequest, limits);
+    errors::count_error(err);
+    return err;
+}
+
+error url::parse_url(std::string_view rawurl, bool viaRequest,
+                     const parse_limits& limits) {
     std::string_view rest;
     error err;
 
+    reset();
+
+    if (rawurl.length() > limits.max_length) {
+        return error(url_error_code::limit_exceeded,
+                     errors::static_message{"url too long"});
+    }
+    if (limits.max_escapes < rawurl.length() &&
+        static_cast<std::size_t>(std::count(rawurl.begin(), rawurl.end(),
+                                            '%')) > limits.max_escapes) {
+        return error(url_error_code::limit_exceeded,
+                     errors::static_message{"too many escapes in url"});
+    }
+
     if (strings::contains_ctl_char(rawurl)) {
-        return error(url_error_code::parse_error,
-                     "invalid control character in URL");
+        return error(
+            url_error_code::parse_error,
+            errors::static_message{"invalid control character in URL"});
     }
 
     if (rawurl.empty() && viaRequest) {
-        return error(url_error_code::parse_error, "empty url");
+        return error(url_error_code::parse_error,
+                     errors::static_message{"empty url"});
     }
 
     if (rawurl == "*") {
@@ -284,16 +436,21 @@ error url::parse(std::string_view rawurl, bool viaRequest) {
     }
 
     // Split off fragment
-    std::tie(fragment_, rest, err) = internal::parse_fragment(rawurl);
+    auto fragment = internal::parse_fragment(rawurl);
+    if (!fragment) {
+        return fragment.error();
+    }
+    fragment_ = std::move(fragment->fragment);
 
     // Split off possible leading "http:", "mailto:", etc.
     // Cannot contain escaped characters.
-    std::string_view scheme;
-    std::tie(scheme, rest, err) = internal::parse_scheme(rest);
-    if (err != errors::no_error) {
-        return err;
+    auto scheme = internal::parse_scheme(fragment->rest);
+    if (!scheme) {
+        return scheme.error();
     }
-    scheme_ = absl::AsciiStrToLower(scheme);
+    scheme_ = std::move(scheme->scheme);
+    rest = scheme->rest;
+    absl::AsciiStrToLower(&scheme_);
 
     if (absl::EndsWith(rest, "?") && strings::count(rest, "?") == 1) {
         query_.set_force_query(true);
@@ -301,18 +458,26 @@ error url::parse(std::string_view rawurl, bool viaRequest) {
     } else {
         std::string_view rawQuery;
         std::tie(rest, rawQuery) = internal::split(rest, "?", true);
-        query_.parse((std::string)rawQuery);
+        // Only limit errors are reported, see query::parse. An empty query
+        // is left as reset() left it rather than parsed, which would fail.
+        if (!rawQuery.empty()) {
+            // Only the outcome of url::parse is counted
+            err = query_.parse_query(rawQuery, limits);
+            if (err.error_code() == url_error_code::limit_exceeded) {
+                return err;
+            }
+        }
     }
 
     if (!absl::StartsWith(rest, "/")) {
         if (scheme_.empty()) {
             // We consider rootless paths per RFC 3986 as opaque.
-            opaque_ = (std::string)rest;
+            opaque_.assign(rest);
             return errors::no_error;
         }
         if (viaRequest) {
             return error(url_error_code::parse_error,
-                         "invalid URI for request");
+                         errors::static_message{"invalid URI for request"});
         }
 
         // Avoid confusion with malformed schemes, like cache_object:foo/bar.
@@ -327,30 +492,34 @@ error url::parse(std::string_view rawurl, bool viaRequest) {
         if (colon >= 0 && (slash < 0 || colon < slash)) {
             // First path segment has colon. Not allowed in relative URL.
             return error(url_error_code::parse_error,
-                         "first path segment in URL cannot contain colon");
+                         errors::static_message{
+                             "first path segment in URL cannot contain colon"});
         }
     }
 
-    if (!scheme_.empty() || !viaRequest && !absl::StartsWith(rest, "///") &&
-                                absl::StartsWith(rest, "//")) {
+    if ((!scheme_.empty() ||
+         (!viaRequest && !absl::StartsWith(rest, "///"))) &&
+        absl::StartsWith(rest, "//")) {
         std::string_view authority;
-        std::string_view host;
 
         // Separate authority@host from the path
         std::tie(authority, rest) = internal::split(rest.substr(2), "/", false);
 
         // Parse the username and password
-        std::tie(username_, password_, host, err) =
-            internal::parse_authority(authority);
-        if (err != errors::no_error) {
-            return err;
+        auto userinfo = internal::parse_authority(authority);
+        if (!userinfo) {
+            return userinfo.error();
         }
+        username_ = std::move(userinfo->username);
+        password_ = std::move(userinfo->password);
 
         // Parse the host
-        std::tie(host_, port_, err) = internal::parse_host(host);
-        if (err != errors::no_error) {
-            return err;
+        auto parts = internal::parse_host(userinfo->host);
+        if (!parts) {
+            return parts.error();
         }
+        host_ = std::move(parts->hostname);
+        port_ = std::move(parts->port);
     }
     // Set Path and, optionally, RawPath.
     // RawPath is a hint of the encoding of Path. We don't want to set it if
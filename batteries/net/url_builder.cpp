@@ -0,0 +1,125 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "url_builder.hpp"
+
+#include <absl/strings/str_cat.h>
+
+namespace batteries {
+
+namespace net {
+
+url_builder::url_builder()
+    : buf_()
+    , has_authority_(false)
+    , has_query_(false) {}
+
+url_builder::url_builder(std::size_t size_hint)
+    : buf_()
+    , has_authority_(false)
+    , has_query_(false) {
+    buf_.reserve(size_hint);
+}
+
+url_builder& url_builder::scheme(std::string_view scheme) {
+    absl::StrAppend(&buf_, scheme, ":");
+    return *this;
+}
+
+url_builder& url_builder::userinfo(std::string_view username,
+                                   std::string_view password) {
+    begin_authority();
+    internal::append_escaped(&buf_, username,
+                             internal::encoding::encodeUserPassword);
+    if (!password.empty()) {
+        buf_.push_back(':');
+        internal::append_escaped(&buf_, password,
+                                 internal::encoding::encodeUserPassword);
+    }
+    buf_.push_back('@');
+    return *this;
+}
+
+url_builder& url_builder::host(std::string_view host) {
+    begin_authority();
+    internal::append_escaped(&buf_, host, internal::encoding::encodeHost);
+    return *this;
+}
+
+url_builder& url_builder::port(uint16_t port) {
+    absl::StrAppend(&buf_, ":", port);
+    return *this;
+}
+
+url_builder& url_builder::path(std::string_view path) {
+    if (has_authority_ && !path.empty() && path[0] != '/') {
+        buf_.push_back('/');
+    }
+    internal::append_escaped(&buf_, path, internal::encoding::encodePath);
+    return *this;
+}
+
+url_builder& url_builder::segment(std::string_view segment) {
+    buf_.push_back('/');
+    internal::append_escaped(&buf_, segment,
+                             internal::encoding::encodePathSegment);
+    return *this;
+}
+
+url_builder& url_builder::query(std::string_view key, std::string_view value) {
+    buf_.push_back(has_query_ ? '&' : '?');
+    has_query_ = true;
+    internal::append_escaped(&buf_, key,
+                             internal::encoding::encodeQueryComponent);
+    buf_.push_back('=');
+    internal::append_escaped(&buf_, value,
+                             internal::encoding::encodeQueryComponent);
+    return *this;
+}
+
+url_builder& url_builder::fragment(std::string_view fragment) {
+    buf_.push_back('#');
+    internal::append_escaped(&buf_, fragment,
+                             internal::encoding::encodeFragment);
+    return *this;
+}
+
+void url_builder::reserve(std::size_t size) { buf_.reserve(size); }
+
+void url_builder::clear() {
+    buf_.clear();
+    has_authority_ = false;
+    has_query_ = false;
+}
+
+std::string_view url_builder::view() const { return buf_; }
+
+std::string url_builder::str() const& { return buf_; }
+
+std::string url_builder::str() && {
+    has_authority_ = false;
+    has_query_ = false;
+    return std::move(buf_);
+}
+
+void url_builder::begin_authority() {
+    if (!has_authority_) {
+        buf_.append("//");
+        has_authority_ = true;
+    }
+}
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,152 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "base.hpp"
+#include "internal/escape.hpp"
+
+namespace batteries {
+
+namespace net {
+
+/**
+ * A url_builder assembles an escaped URL string directly into a single
+ * buffer without creating an intermediate url. Components are appended in
+ * the order they appear in a URL:
+ *
+ *	scheme://userinfo@host:port/path?query#fragment
+ *
+ * so calls must be made in that order. Every component is optional.
+ */
+class url_builder {
+
+  public:
+    /**
+     * @brief Initializes an empty builder.
+     */
+    url_builder();
+
+    /**
+     * @brief Initializes an empty builder and reserves size_hint bytes for
+     * the resulting URL.
+     * @param size_hint The expected length of the URL.
+     */
+    explicit url_builder(std::size_t size_hint);
+
+    /**
+     * @brief scheme appends the scheme followed by ':'.
+     * Example: scheme("https") produces 'https:'.
+     * @param scheme The scheme of the url. It is not escaped.
+     */
+    url_builder& scheme(std::string_view scheme);
+
+    /**
+     * @brief userinfo appends the escaped username and, if not empty, the
+     * escaped password followed by '@'.
+     * @param username The name of the user.
+     * @param password The password of the user.
+     */
+    url_builder& userinfo(std::string_view username,
+                          std::string_view password = {});
+
+    /**
+     * @brief host appends the escaped hostname.
+     * @param host The hostname, an IPv6 literal must include the '[]'.
+     */
+    url_builder& host(std::string_view host);
+
+    /**
+     * @brief port appends ':' followed by the port number.
+     * @param port The port number.
+     */
+    url_builder& port(uint16_t port);
+
+    /**
+     * @brief path appends a path escaped as a whole, i.e. '/' is kept. A
+     * leading '/' is added when an authority has been written and path does
+     * not start with one.
+     * @param path The unescaped path.
+     */
+    url_builder& path(std::string_view path);
+
+    /**
+     * @brief segment appends '/' followed by a single escaped path segment.
+     * Any '/' in segment is escaped.
+     * @param segment The unescaped path segment.
+     */
+    url_builder& segment(std::string_view segment);
+
+    /**
+     * @brief query appends an escaped key=value pair, preceded by '?' for the
+     * first pair and '&' for the following pairs.
+     * @param key The unescaped key.
+     * @param value The unescaped value.
+     */
+    url_builder& query(std::string_view key, std::string_view value);
+
+    /**
+     * @brief fragment appends '#' followed by the escaped fragment.
+     * @param fragment The unescaped fragment.
+     */
+    url_builder& fragment(std::string_view fragment);
+
+    /**
+     * @brief reserve reserves space for at least size bytes.
+     * @param size The expected length of the URL.
+     */
+    void reserve(std::size_t size);
+
+    /**
+     * @brief clear empties the builder but keeps its capacity so it can be
+     * used to build another URL.
+     */
+    void clear();
+
+    /**
+     * @brief view returns the URL built so far. The view is valid until the
+     * builder is modified or destroyed.
+     * @returns The URL built so far.
+     */
+    std::string_view view() const;
+
+    /**
+     * @brief str returns the URL built so far.
+     * @returns A copy of the URL built so far.
+     */
+    std::string str() const&;
+
+    /**
+     * @brief str returns the URL built so far by moving the buffer out of the
+     * builder.
+     * @returns The URL built so far.
+     */
+    std::string str() &&;
+
+  private:
+    void begin_authority();
+
+  private:
+    std::string buf_;
+    bool has_authority_;
+    bool has_query_;
+};
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,105 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "url_pieces.hpp"
+
+#include <cassert>
+
+namespace batteries {
+
+namespace net {
+
+url_pieces::url_pieces()
+    : pieces_()
+    , offsets_()
+    , size_(0)
+    , scratch_() {}
+
+void url_pieces::clear() {
+    size_ = 0;
+    scratch_.clear();
+}
+
+url_pieces::const_iterator url_pieces::begin() const { return pieces_.data(); }
+
+url_pieces::const_iterator url_pieces::end() const {
+    return pieces_.data() + size_;
+}
+
+std::size_t url_pieces::size() const { return size_; }
+
+bool url_pieces::empty() const { return size_ == 0; }
+
+const std::string_view& url_pieces::operator[](std::size_t i) const {
+    return pieces_[i];
+}
+
+std::size_t url_pieces::length() const {
+    std::size_t length = 0;
+    for (auto& piece : *this) {
+        length += piece.length();
+    }
+    return length;
+}
+
+std::string url_pieces::to_string() const {
+    std::string retVal;
+    retVal.reserve(length());
+    for (auto& piece : *this) {
+        retVal.append(piece.data(), piece.length());
+    }
+    return retVal;
+}
+
+void url_pieces::append(std::string_view s) {
+    if (s.empty()) {
+        return;
+    }
+    // url::to_pieces adds at most max_pieces, see PiecesTest.MostPieces
+    assert(size_ < max_pieces);
+    pieces_[size_] = s;
+    offsets_[size_] = std::string::npos;
+    size_++;
+}
+
+void url_pieces::append_escaped(std::string_view s, internal::encoding mode) {
+    if (!internal::needs_escape(s, mode)) {
+        append(s);
+        return;
+    }
+
+    assert(size_ < max_pieces);
+    const char* data = scratch_.data();
+    auto offset = scratch_.length();
+    internal::append_escaped(&scratch_, s, mode);
+
+    // The scratch buffer moved, repoint the pieces that live in it.
+    if (data != scratch_.data()) {
+        for (std::size_t i = 0; i < size_; i++) {
+            if (offsets_[i] != std::string::npos) {
+                pieces_[i] = std::string_view(scratch_.data() + offsets_[i],
+                                              pieces_[i].length());
+            }
+        }
+    }
+
+    pieces_[size_] = std::string_view(scratch_.data() + offset,
+                                      scratch_.length() - offset);
+    offsets_[size_] = offset;
+    size_++;
+}
+
+} // namespace net
+
+} // namespace batteries
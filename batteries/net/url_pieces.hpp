@@ -0,0 +1,102 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include "base.hpp"
+#include "internal/escape.hpp"
+
+namespace batteries {
+
+namespace net {
+
+class url;
+
+/**
+ * A url_pieces holds a serialized URL as an ordered list of string pieces
+ * that concatenate to the full string. Pieces that need no escaping point
+ * directly at the buffers of the url they were taken from; escaped pieces are
+ * written to a scratch buffer owned by the url_pieces. Each piece maps onto
+ * one iovec so the URL can be written with writev without concatenation.
+ *
+ * The pieces are valid until the url is modified or destroyed, or until the
+ * url_pieces is filled again. The scratch buffer keeps its capacity between
+ * uses.
+ */
+class url_pieces {
+
+  public:
+    // The largest number of pieces a URL can be split into: a url with a
+    // scheme, userinfo, port, a relative path, a query and a fragment.
+    static constexpr std::size_t max_pieces = 16;
+
+    using const_iterator = const std::string_view*;
+
+    url_pieces();
+
+    // Pieces may point into the scratch buffer
+    url_pieces(const url_pieces&) = delete;
+    url_pieces& operator=(const url_pieces&) = delete;
+
+    /**
+     * @brief clear removes all pieces while keeping the scratch capacity.
+     */
+    void clear();
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    std::size_t size() const;
+    bool empty() const;
+    const std::string_view& operator[](std::size_t i) const;
+
+    /**
+     * @brief length returns the combined length of all the pieces.
+     * @returns The length of the serialized URL.
+     */
+    std::size_t length() const;
+
+    /**
+     * @brief to_string concatenates the pieces.
+     * @returns The serialized URL.
+     */
+    std::string to_string() const;
+
+  private:
+    friend class url;
+
+    // Adds a piece that refers to s directly.
+    void append(std::string_view s);
+
+    // Adds s escaped according to mode. If s needs no escaping the piece
+    // refers to s directly, otherwise the escaped form is written to the
+    // scratch buffer.
+    void append_escaped(std::string_view s, internal::encoding mode);
+
+  private:
+    std::array<std::string_view, max_pieces> pieces_;
+    // Start of each piece within the scratch buffer or npos if the piece
+    // refers to the url directly. Used to repoint the pieces when the scratch
+    // buffer grows.
+    std::array<std::size_t, max_pieces> offsets_;
+    std::size_t size_;
+    std::string scratch_;
+};
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,236 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "validate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <absl/strings/ascii.h>
+#include <absl/strings/match.h>
+
+#include "url.hpp"
+
+namespace batteries {
+
+namespace net {
+
+namespace detail {
+
+// Character classes of the bytes of a URL. A URL made only of plain bytes
+// can't fail to unescape anywhere, so only its structure has to be checked.
+enum char_class : uint8_t {
+    plain = 0,
+    // Rejected by url::parse before anything else.
+    control = 1,
+    // Escapes, userinfo, IP literals, non-ASCII and bytes a host may not
+    // contain. These URLs are validated by url::parse.
+    slow = 2,
+};
+
+constexpr std::array<uint8_t, 256> make_char_classes() {
+    std::array<uint8_t, 256> classes{};
+    for (int c = 0; c < 256; c++) {
+        if (c < 0x20 || c == 0x7f) {
+            classes[c] = control;
+        } else if (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') ||
+                   ('0' <= c && c <= '9')) {
+            classes[c] = plain;
+        } else {
+            classes[c] = slow;
+        }
+    }
+    for (byte c : std::string_view("-._~/:?#&=+,;!$'()*")) {
+        classes[c] = plain;
+    }
+    return classes;
+}
+
+constexpr std::array<uint8_t, 256> char_classes = make_char_classes();
+
+constexpr std::size_t block_size = 16;
+
+#if defined(__SSE2__)
+// The lanes of v that are in [lo, hi], compared unsigned.
+inline __m128i in_range(__m128i v, char lo, char hi) {
+    __m128i offset = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(
+        _mm_min_epu8(offset, _mm_set1_epi8(static_cast<char>(hi - lo))),
+        offset);
+}
+
+// The lanes of v that are control bytes, see make_char_classes.
+inline __m128i control_lanes(__m128i v) {
+    return _mm_or_si128(in_range(v, 0x00, 0x1f),
+                        _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7f)));
+}
+
+// The lanes of v that are slow ASCII bytes, see make_char_classes. Non-ASCII
+// bytes are only marked by their sign bit.
+inline __m128i slow_lanes(__m128i v) {
+    __m128i m = _mm_or_si128(in_range(v, '[', '^'), in_range(v, '{', '}'));
+    m = _mm_or_si128(m, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                                     _mm_cmpeq_epi8(v, _mm_set1_epi8('"'))));
+    m = _mm_or_si128(m, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('%')),
+                                     _mm_cmpeq_epi8(v, _mm_set1_epi8('<'))));
+    m = _mm_or_si128(m, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('>')),
+                                     _mm_cmpeq_epi8(v, _mm_set1_epi8('@'))));
+    return _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('`')));
+}
+#endif
+
+// The union of the classes of every byte of s. Whole blocks are classified
+// 16 bytes at a time and the rest through the table. There is no early exit
+// so the loops have no data dependent branches.
+inline uint8_t classify(std::string_view s) {
+    uint8_t flags = plain;
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    __m128i control_acc = _mm_setzero_si128();
+    __m128i slow_acc = _mm_setzero_si128();
+    for (; i + block_size <= s.length(); i += block_size) {
+        __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + i));
+        control_acc = _mm_or_si128(control_acc, control_lanes(v));
+        // The sign bits of v mark the non-ASCII bytes
+        slow_acc = _mm_or_si128(slow_acc, _mm_or_si128(slow_lanes(v), v));
+    }
+    if (_mm_movemask_epi8(control_acc) != 0) {
+        flags |= control;
+    }
+    if (_mm_movemask_epi8(slow_acc) != 0) {
+        flags |= slow;
+    }
+#endif
+    for (; i < s.length(); i++) {
+        flags |= char_classes[static_cast<byte>(s[i])];
+    }
+    return flags;
+}
+
+// Validates the structure of a URL made only of plain bytes the same way
+// url::parse does. Such a URL has no userinfo, no IP literal and nothing to
+// unescape, so the only failures are a missing scheme, a colon in the first
+// segment of a relative path and an invalid port.
+static std::error_code validate_plain(std::string_view rawurl) {
+    if (rawurl == "*") {
+        return errors::no_error.error_code();
+    }
+
+    // Split off the fragment
+    std::string_view rest = rawurl.substr(0, rawurl.find('#'));
+
+    // See internal::parse_scheme
+    bool has_scheme = false;
+    for (std::size_t i = 0; i < rest.length(); i++) {
+        byte c = rest[i];
+        if (absl::ascii_isalpha(c)) {
+            continue;
+        }
+        if (c == ':') {
+            if (i == 0) {
+                return make_error_code(url_error_code::parse_error);
+            }
+            has_scheme = true;
+            rest = rest.substr(i + 1);
+        }
+        break;
+    }
+
+    // Split off the query
+    rest = rest.substr(0, rest.find('?'));
+
+    if (!absl::StartsWith(rest, "/")) {
+        if (!has_scheme) {
+            // opaque
+            return errors::no_error.error_code();
+        }
+        auto colon = rest.find(':');
+        if (colon != rest.npos && colon < rest.find('/')) {
+            return make_error_code(url_error_code::parse_error);
+        }
+    }
+
+    if ((has_scheme || !absl::StartsWith(rest, "///")) &&
+        absl::StartsWith(rest, "//")) {
+        std::string_view host = rest.substr(2);
+        host = host.substr(0, host.find('/'));
+        auto i = host.rfind(':');
+        if (i != host.npos) {
+            for (byte c : host.substr(i + 1)) {
+                if (!absl::ascii_isdigit(c)) {
+                    return make_error_code(url_error_code::parse_error);
+                }
+            }
+        }
+    }
+
+    return errors::no_error.error_code();
+}
+
+} // namespace detail
+
+std::error_code validate(std::string_view rawurl) {
+    auto flags = detail::classify(rawurl);
+    if (flags & detail::control) {
+        return make_error_code(url_error_code::parse_error);
+    }
+    if (flags & detail::slow) {
+        url u;
+        return u.parse(rawurl).error_code();
+    }
+    return detail::validate_plain(rawurl);
+}
+
+std::size_t validate_batch(absl::Span<const std::string_view> urls,
+                           absl::Span<std::error_code> results) {
+    constexpr std::size_t chunk_size = 64;
+    std::array<uint8_t, chunk_size> flags;
+    std::size_t invalid = 0;
+    url fallback;
+
+    for (std::size_t chunk = 0; chunk < urls.size(); chunk += chunk_size) {
+        std::size_t count = std::min(chunk_size, urls.size() - chunk);
+
+        // Classify the bytes of the whole chunk first
+        for (std::size_t i = 0; i < count; i++) {
+            flags[i] = detail::classify(urls[chunk + i]);
+        }
+
+        for (std::size_t i = 0; i < count; i++) {
+            auto& result = results[chunk + i];
+            if (flags[i] == detail::plain) {
+                result = detail::validate_plain(urls[chunk + i]);
+            } else if (flags[i] & detail::control) {
+                result = make_error_code(url_error_code::parse_error);
+            } else {
+                result = fallback.parse(urls[chunk + i]).error_code();
+            }
+            if (result) {
+                invalid++;
+            }
+        }
+    }
+
+    return invalid;
+}
+
+} // namespace net
+
+} // namespace batteries
@@ -0,0 +1,52 @@
+// Copyright 2019 The Batteries Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//	  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string_view>
+#include <system_error>
+
+#include <absl/types/span.h>
+
+#include "base.hpp"
+
+namespace batteries {
+
+namespace net {
+
+/**
+ * @brief validate reports whether url::parse would accept rawurl without
+ * building a url. Most URLs are decided by a single allocation-free scan;
+ * URLs with escapes, userinfo or IP literals fall back to url::parse.
+ * @param rawurl The URL to validate.
+ * @returns The error code url::parse would return.
+ */
+std::error_code validate(std::string_view rawurl);
+
+/**
+ * @brief validate_batch validates many URLs at once. The character classes of
+ * all URLs are computed first in a tight loop, then the URLs are checked for
+ * structure, and only the URLs that contain escapes, userinfo or IP literals
+ * are handed to url::parse, which reuses a single url for all of them.
+ * @param urls The URLs to validate.
+ * @param results The error code for each URL, it must be at least as large as
+ * urls.
+ * @returns The number of invalid URLs.
+ */
+std::size_t validate_batch(absl::Span<const std::string_view> urls,
+                           absl::Span<std::error_code> results);
+
+} // namespace net
+
+} // namespace batteries
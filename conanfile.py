@@ -37,8 +37,11 @@ class BatteriesConan(ConanFile):
     requires = "abseil/20211102.0"
     build_requires = "gtest/cci.20210126"
     options = {"cxx_standard": [17, 20], "build_testing": [
-        True, False], "fPIC": [True, False]}
-    default_options = {"cxx_standard": 20, "build_testing": True, "fPIC": True}
+        True, False], "exceptions": [True, False],
+        "error_counters": [True, False], "fPIC": [True, False]}
+    default_options = {"cxx_standard": 20, "build_testing": True,
+                       "exceptions": True, "error_counters": False,
+                       "fPIC": True}
 
     def config_options(self):
         if self.settings.os == "Windows":
@@ -67,6 +70,9 @@ class BatteriesConan(ConanFile):
         cmake.definitions["BATT_RUN_TESTS"] = self.options.build_testing
         cmake.definitions["BUILD_TESTING"] = self.options.build_testing
         cmake.definitions["CMAKE_CXX_STANDARD"] = self.options.cxx_standard
+        cmake.definitions["BATT_USE_EXCEPTIONS"] = self.options.exceptions
+        cmake.definitions["BATT_ENABLE_ERROR_COUNTERS"] = \
+            self.options.error_counters
         cmake.configure()
         cmake.build()
         cmake.test()
@@ -84,3 +90,5 @@ class BatteriesConan(ConanFile):
         self.cpp_info.libs.extend(tools.collect_libs(self))
         if self.settings.os == "Linux":
             self.cpp_info.libs.extend(["-Wl,--end-group", "pthread"])
+        if self.options.error_counters:
+            self.cpp_info.defines.append("BATT_ERROR_COUNTERS")